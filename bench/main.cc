@@ -0,0 +1,409 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/lbs_discrete_ordinates_solver.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/iterative_methods/sweep_wgs_context.h"
+#include "framework/materials/material.h"
+#include "framework/materials/multi_group_xs/multi_group_xs.h"
+#include "framework/math/quadratures/angular/product_quadrature.h"
+#include "framework/mesh/mesh.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/mesh/mesh_generator/mesh_generator.h"
+#include "framework/object_factory.h"
+#include "framework/logging/log.h"
+#include "framework/utils/timer.h"
+#include "framework/runtime.h"
+#include "caliper/cali.h"
+#include "cxxopts/cxxopts.h"
+#include "petsc.h"
+#include <sys/resource.h>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+namespace mpi = mpicpp_lite;
+using namespace opensn;
+
+namespace
+{
+
+/**Settings shared by all benchmark cases.*/
+struct BenchmarkOptions
+{
+  size_t num_cells_per_dim = 16;
+  size_t num_groups = 16;
+  int num_azimuthal_angles = 8;
+  int num_polar_angles = 4;
+  int scattering_order = 1;
+  size_t num_sweeps = 10;
+  size_t num_warmup_sweeps = 1;
+  int num_sweep_threads = 1;
+};
+
+/**Result of one benchmark case, reduced over all locations.*/
+struct BenchmarkResult
+{
+  std::string mesh_type;
+  std::string sweep_type;
+  size_t num_cells = 0;
+  size_t num_angles = 0;
+  size_t num_groups = 0;
+  size_t num_moments = 0;
+  /// Maximum over locations of the local number of cells divided by the average.
+  double cell_imbalance = 1.0;
+  /// Wall time of one sweep, in seconds, averaged over the timed sweeps.
+  double sweep_time = 0.0;
+  /// Cells times angles times groups swept per second.
+  double rate = 0.0;
+  /// Resident set size high-water marks, in MB, maximum and sum over locations.
+  double max_memory = 0.0;
+  double total_memory = 0.0;
+};
+
+/**Returns the resident set size high-water mark of this process in MB.*/
+double
+MemoryHighWaterMark()
+{
+  rusage usage{};
+  getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+  // Reported in bytes
+  return static_cast<double>(usage.ru_maxrss) / (1024.0 * 1024.0);
+#else
+  // Reported in kilobytes
+  return static_cast<double>(usage.ru_maxrss) / 1024.0;
+#endif
+}
+
+/**Returns `num_cells + 1` equally spaced nodes spanning [0, 1].*/
+std::vector<double>
+UniformNodes(size_t num_cells)
+{
+  std::vector<double> nodes(num_cells + 1);
+  for (size_t i = 0; i <= num_cells; ++i)
+    nodes[i] = static_cast<double>(i) / static_cast<double>(num_cells);
+  return nodes;
+}
+
+/**Returns the parameters of an OrthogonalMeshGenerator with `dimension` node sets.*/
+ParameterBlock
+OrthogonalMeshParameters(size_t num_cells_per_dim, int dimension)
+{
+  ParameterBlock node_sets("node_sets");
+  node_sets.ChangeToArray();
+  for (int d = 0; d < dimension; ++d)
+    node_sets.AddParameter(ParameterBlock(std::to_string(d), UniformNodes(num_cells_per_dim)));
+
+  ParameterBlock params;
+  params.AddParameter(node_sets);
+  return params;
+}
+
+/**
+ * Generates the unit cube with `num_cells_per_dim` cells per dimension and makes it the current
+ * mesh. "orthogonal" meshes are generated directly by an OrthogonalMeshGenerator. "extruded"
+ * meshes extrude an orthogonal 2D mesh along z, which yields polyhedral cells that are swept
+ * with the unstructured cell mappings.
+ */
+void
+GenerateMesh(const std::string& mesh_type, size_t num_cells_per_dim)
+{
+  auto& factory = ObjectFactory::GetInstance();
+
+  size_t generator_handle;
+  if (mesh_type == "orthogonal")
+    generator_handle = factory.MakeRegisteredObjectOfType(
+      "mesh::OrthogonalMeshGenerator", OrthogonalMeshParameters(num_cells_per_dim, 3));
+  else
+  {
+    const size_t input_handle = factory.MakeRegisteredObjectOfType(
+      "mesh::OrthogonalMeshGenerator", OrthogonalMeshParameters(num_cells_per_dim, 2));
+
+    ParameterBlock layer("0");
+    layer.AddParameter("h", 1.0);
+    layer.AddParameter("n", static_cast<int>(num_cells_per_dim));
+
+    ParameterBlock layers("layers");
+    layers.ChangeToArray();
+    layers.AddParameter(layer);
+
+    ParameterBlock params;
+    params.AddParameter(ParameterBlock("inputs", std::vector<size_t>{input_handle}));
+    params.AddParameter(layers);
+    generator_handle = factory.MakeRegisteredObjectOfType("mesh::ExtruderMeshGenerator", params);
+  }
+
+  auto& generator = GetStackItem<MeshGenerator>(object_stack, generator_handle, __FUNCTION__);
+  generator.Execute();
+  GetCurrentMesh()->SetUniformMaterialID(0);
+}
+
+/**
+ * Builds a discrete ordinates solver with a single groupset on the current mesh, sweeps
+ * `num_warmup_sweeps` times and then times `num_sweeps` sweeps of a uniform source.
+ */
+BenchmarkResult
+RunCase(const std::string& mesh_type,
+        const std::string& sweep_type,
+        size_t quadrature_handle,
+        const BenchmarkOptions& options)
+{
+  CALI_CXX_MARK_FUNCTION;
+
+  ParameterBlock groupset("0");
+  groupset.AddParameter("groups_from_to", std::vector<size_t>{0, options.num_groups - 1});
+  groupset.AddParameter("angular_quadrature_handle", quadrature_handle);
+
+  ParameterBlock groupsets("groupsets");
+  groupsets.ChangeToArray();
+  groupsets.AddParameter(groupset);
+
+  ParameterBlock solver_options("options");
+  solver_options.AddParameter("scattering_order", options.scattering_order);
+  solver_options.AddParameter("num_sweep_threads", options.num_sweep_threads);
+  solver_options.AddParameter("verbose_inner_iterations", false);
+  solver_options.AddParameter("verbose_outer_iterations", false);
+
+  ParameterBlock params;
+  params.AddParameter("num_groups", options.num_groups);
+  params.AddParameter(groupsets);
+  params.AddParameter(solver_options);
+  params.AddParameter("sweep_type", sweep_type);
+
+  auto& factory = ObjectFactory::GetInstance();
+  const size_t solver_handle =
+    factory.MakeRegisteredObjectOfType("lbs::DiscreteOrdinatesSolver", params);
+  auto& solver =
+    GetStackItem<lbs::DiscreteOrdinatesSolver>(object_stack, solver_handle, __FUNCTION__);
+  solver.Initialize();
+
+  auto& context = dynamic_cast<lbs::SweepWGSContext&>(solver.GetWGSContext(0));
+  auto& q_moments = solver.QMomentsLocal();
+  q_moments.assign(q_moments.size(), 1.0);
+
+  for (size_t s = 0; s < options.num_warmup_sweeps; ++s)
+    context.ApplyInverseTransportOperator(lbs::SourceFlags());
+
+  mpi_comm.barrier();
+  const auto start = std::chrono::high_resolution_clock::now();
+  for (size_t s = 0; s < options.num_sweeps; ++s)
+    context.ApplyInverseTransportOperator(lbs::SourceFlags());
+  const auto end = std::chrono::high_resolution_clock::now();
+  const double local_sweep_time =
+    std::chrono::duration<double>(end - start).count() / static_cast<double>(options.num_sweeps);
+
+  const auto& grid = *GetCurrentMesh();
+  const auto num_local_cells = static_cast<double>(grid.local_cells.size());
+  const double local_memory = MemoryHighWaterMark();
+
+  BenchmarkResult result;
+  result.mesh_type = mesh_type;
+  result.sweep_type = sweep_type;
+  result.num_cells = grid.GetGlobalNumberOfCells();
+  result.num_angles = context.groupset_.quadrature_->abscissae_.size();
+  result.num_groups = options.num_groups;
+  result.num_moments = solver.NumMoments();
+
+  double max_local_cells = 0.0;
+  mpi_comm.all_reduce(num_local_cells, max_local_cells, mpi::op::max<double>());
+  result.cell_imbalance =
+    max_local_cells * mpi_comm.size() / static_cast<double>(result.num_cells);
+
+  mpi_comm.all_reduce(local_sweep_time, result.sweep_time, mpi::op::max<double>());
+  result.rate = static_cast<double>(result.num_cells * result.num_angles * result.num_groups) /
+                result.sweep_time;
+
+  mpi_comm.all_reduce(local_memory, result.max_memory, mpi::op::max<double>());
+  mpi_comm.all_reduce(local_memory, result.total_memory, mpi::op::sum<double>());
+
+  // Release the solver before the next case
+  object_stack[solver_handle].reset();
+
+  return result;
+}
+
+/**Prints the results as a table followed by one comma-separated line per case.*/
+void
+ReportResults(const std::vector<BenchmarkResult>& results)
+{
+  if (mpi_comm.rank() != 0)
+    return;
+
+  const int num_locations = mpi_comm.size();
+
+  std::stringstream outstr;
+  outstr << "\nSweep benchmark results over " << num_locations << " location(s)\n"
+         << std::left << std::setw(12) << "mesh" << std::setw(6) << "sweep" << std::right
+         << std::setw(10) << "cells" << std::setw(8) << "angles" << std::setw(8) << "groups"
+         << std::setw(8) << "moments" << std::setw(14) << "sweep (s)" << std::setw(14)
+         << "rate (1/s)" << std::setw(14) << "rate/location" << std::setw(12) << "imbalance"
+         << std::setw(14) << "max mem (MB)" << std::setw(14) << "tot mem (MB)" << "\n";
+  for (const auto& result : results)
+    outstr << std::left << std::setw(12) << result.mesh_type << std::setw(6) << result.sweep_type
+           << std::right << std::setw(10) << result.num_cells << std::setw(8) << result.num_angles
+           << std::setw(8) << result.num_groups << std::setw(8) << result.num_moments
+           << std::setw(14) << std::setprecision(5) << result.sweep_time << std::setw(14)
+           << result.rate << std::setw(14) << result.rate / num_locations << std::setw(12)
+           << result.cell_imbalance << std::setw(14) << result.max_memory << std::setw(14)
+           << result.total_memory << "\n";
+
+  // Comma-separated lines are meant to be collected across runs with different location counts
+  outstr << "\n";
+  for (const auto& result : results)
+    outstr << "BENCH," << result.mesh_type << "," << result.sweep_type << "," << num_locations
+           << "," << result.num_cells << "," << result.num_angles << "," << result.num_groups
+           << "," << result.num_moments << "," << result.sweep_time << "," << result.rate << ","
+           << result.max_memory << "," << result.total_memory << "\n";
+
+  std::cout << outstr.str() << std::endl;
+}
+
+/**Splits a comma-separated list.*/
+std::vector<std::string>
+SplitList(const std::string& list)
+{
+  std::vector<std::string> items;
+  std::stringstream stream(list);
+  std::string item;
+  while (std::getline(stream, item, ','))
+    if (not item.empty())
+      items.push_back(item);
+  return items;
+}
+
+} // namespace
+
+/**
+ * Sweep micro-benchmark. Sweeps a uniform source on generated meshes of the unit cube for every
+ * combination of the requested mesh and sweep types and reports the sweep rate, in cells times
+ * angles times groups per second, and the memory high-water mark. Runs on any number of
+ * locations; comparing the rates per location of runs with different location counts gives the
+ * parallel scaling.
+ */
+int
+main(int argc, char** argv)
+{
+  mpi::Environment env(argc, argv);
+  opensn::mpi_comm = mpi::Communicator(MPI_COMM_WORLD);
+
+  BenchmarkOptions options;
+  std::vector<std::string> mesh_types;
+  std::vector<std::string> sweep_types;
+  try
+  {
+    cxxopts::Options cl_options("opensn-bench", "OpenSn sweep micro-benchmarks");
+
+    /* clang-format off */
+    cl_options.add_options()
+    ("h,help",             "Help message")
+    ("mesh",               "Comma-separated mesh types: orthogonal, extruded",
+      cxxopts::value<std::string>()->default_value("orthogonal,extruded"))
+    ("sweep-type",         "Comma-separated sweep types: AAH, CBC",
+      cxxopts::value<std::string>()->default_value("AAH,CBC"))
+    ("cells",              "Number of cells per dimension",
+      cxxopts::value<size_t>()->default_value("16"))
+    ("groups",             "Number of groups",
+      cxxopts::value<size_t>()->default_value("16"))
+    ("azimuthal-angles",   "Number of azimuthal angles of the product quadrature",
+      cxxopts::value<int>()->default_value("8"))
+    ("polar-angles",       "Number of polar angles of the product quadrature",
+      cxxopts::value<int>()->default_value("4"))
+    ("scattering-order",   "Scattering order, which sets the number of moments",
+      cxxopts::value<int>()->default_value("1"))
+    ("sweeps",             "Number of timed sweeps",
+      cxxopts::value<size_t>()->default_value("10"))
+    ("warmup-sweeps",      "Number of untimed sweeps before the timed ones",
+      cxxopts::value<size_t>()->default_value("1"))
+    ("sweep-threads",      "Number of sweep threads (AAH only)",
+      cxxopts::value<int>()->default_value("1"))
+    ("v,verbose",          "Verbosity level (0 to 3). Default is 0.", cxxopts::value<int>());
+    /* clang-format on */
+
+    auto result = cl_options.parse(argc, argv);
+
+    if (result.count("help"))
+    {
+      if (opensn::mpi_comm.rank() == 0)
+        std::cout << cl_options.help() << std::endl;
+      return 0;
+    }
+
+    mesh_types = SplitList(result["mesh"].as<std::string>());
+    sweep_types = SplitList(result["sweep-type"].as<std::string>());
+    options.num_cells_per_dim = result["cells"].as<size_t>();
+    options.num_groups = result["groups"].as<size_t>();
+    options.num_azimuthal_angles = result["azimuthal-angles"].as<int>();
+    options.num_polar_angles = result["polar-angles"].as<int>();
+    options.scattering_order = result["scattering-order"].as<int>();
+    options.num_sweeps = result["sweeps"].as<size_t>();
+    options.num_warmup_sweeps = result["warmup-sweeps"].as<size_t>();
+    options.num_sweep_threads = result["sweep-threads"].as<int>();
+
+    if (result.count("verbose"))
+      opensn::log.SetVerbosity(result["verbose"].as<int>());
+
+    for (const auto& mesh_type : mesh_types)
+      if (mesh_type != "orthogonal" and mesh_type != "extruded")
+        throw std::invalid_argument("Unknown mesh type \"" + mesh_type + "\"");
+    for (const auto& sweep_type : sweep_types)
+      if (sweep_type != "AAH" and sweep_type != "CBC")
+        throw std::invalid_argument("Unknown sweep type \"" + sweep_type + "\"");
+    if (options.num_cells_per_dim == 0 or options.num_groups == 0 or options.num_sweeps == 0)
+      throw std::invalid_argument("The numbers of cells, groups and sweeps must be positive");
+  }
+  catch (const std::exception& e)
+  {
+    if (opensn::mpi_comm.rank() == 0)
+      std::cerr << e.what() << std::endl;
+    return 1;
+  }
+
+  PetscOptionsInsertString(nullptr, "-error_output_stderr");
+  PetscOptionsInsertString(nullptr, "-no_signal_handler");
+  PetscCall(PetscInitialize(&argc, &argv, nullptr, nullptr));
+  opensn::Initialize();
+
+  int error_code = 0;
+  try
+  {
+    // A single material with identical, purely absorbing groups. Sweeps only depend on the total
+    // cross sections, so the scattering data does not matter.
+    auto xs = std::make_shared<MultiGroupXS>();
+    xs->Initialize(1.0, 0.0, options.num_groups);
+    auto material = std::make_shared<Material>();
+    material->name = "Benchmark Material";
+    material->properties.push_back(xs);
+    opensn::material_stack.push_back(material);
+    opensn::multigroup_xs_stack.push_back(xs);
+
+    opensn::angular_quadrature_stack.push_back(std::make_shared<AngularQuadratureProdGLC>(
+      options.num_azimuthal_angles, options.num_polar_angles));
+    const size_t quadrature_handle = opensn::angular_quadrature_stack.size() - 1;
+
+    std::vector<BenchmarkResult> results;
+    for (const auto& mesh_type : mesh_types)
+    {
+      GenerateMesh(mesh_type, options.num_cells_per_dim);
+      for (const auto& sweep_type : sweep_types)
+      {
+        opensn::log.Log() << program_timer.GetTimeString() << " Benchmarking " << sweep_type
+                          << " sweeps on the " << mesh_type << " mesh";
+        results.push_back(RunCase(mesh_type, sweep_type, quadrature_handle, options));
+      }
+    }
+
+    ReportResults(results);
+  }
+  catch (const std::exception& e)
+  {
+    opensn::log.LogAllError() << e.what();
+    error_code = 1;
+  }
+
+  opensn::Finalize();
+  PetscFinalize();
+  cali_mgr.flush();
+
+  return error_code;
+}
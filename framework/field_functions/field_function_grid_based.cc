@@ -313,66 +313,107 @@ FieldFunctionGridBased::GetGhostedFieldVector() const
 std::vector<double>
 FieldFunctionGridBased::GetPointValue(const Vector3& point) const
 {
-  typedef const int64_t cint64_t;
+  return GetPointValues({point}).front();
+}
+
+std::vector<std::vector<double>>
+FieldFunctionGridBased::GetPointValues(const std::vector<Vector3>& points) const
+{
   const auto& uk_man = GetUnknownManager();
   const size_t num_components = uk_man.GetTotalUnknownStructureSize();
-
-  size_t local_num_point_hits = 0;
-  std::vector<double> local_point_value(num_components, 0.0);
+  const size_t num_points = points.size();
 
   const auto& xyz_min = local_grid_bounding_box_.first;
   const auto& xyz_max = local_grid_bounding_box_.second;
 
-  const double xmin = xyz_min.x;
-  const double ymin = xyz_min.y;
-  const double zmin = xyz_min.z;
-
-  const double xmax = xyz_max.x;
-  const double ymax = xyz_max.y;
-  const double zmax = xyz_max.z;
-
+  const auto& grid = sdm_->Grid();
   const auto& field_vector = *ghosted_field_vector_;
 
-  if (point.x >= xmin and point.x <= xmax and point.y >= ymin and point.y <= ymax and
-      point.z >= zmin and point.z <= zmax)
+  // For each point, the component values summed over the local cells containing the point,
+  // followed by the number of such cells
+  const size_t stride = num_components + 1;
+  std::vector<double> local_point_data(num_points * stride, 0.0);
+
+  std::vector<double> shape_values;
+  std::vector<int64_t> dofs;
+  for (size_t p = 0; p < num_points; ++p)
   {
-    const auto& grid = sdm_->Grid();
-    for (const auto& cell : grid.local_cells)
-    {
-      if (grid.CheckPointInsideCell(cell, point))
-      {
-        const auto& cell_mapping = sdm_->GetCellMapping(cell);
-        std::vector<double> shape_values;
-        cell_mapping.ShapeValues(point, shape_values);
+    const auto& point = points[p];
+    if (point.x < xyz_min.x or point.x > xyz_max.x or point.y < xyz_min.y or
+        point.y > xyz_max.y or point.z < xyz_min.z or point.z > xyz_max.z)
+      continue;
 
-        local_num_point_hits += 1;
+    double* point_data = &local_point_data[p * stride];
+    for (uint64_t global_id : grid.FindCellsContainingPoint(point))
+    {
+      const auto& cell = grid.cells[global_id];
+      const auto& cell_mapping = sdm_->GetCellMapping(cell);
+      const size_t num_nodes = cell_mapping.NumNodes();
+      cell_mapping.ShapeValues(point, shape_values);
 
-        const size_t num_nodes = cell_mapping.NumNodes();
-        for (size_t c = 0; c < num_components; ++c)
-        {
-          for (size_t j = 0; j < num_nodes; ++j)
-          {
-            cint64_t dof_map_j = sdm_->MapDOFLocal(cell, j, uk_man, 0, c);
-            const double dof_value_j = field_vector[dof_map_j];
+      for (size_t c = 0; c < num_components; ++c)
+      {
+        sdm_->MapDOFsLocal(cell, uk_man, 0, c, dofs);
+        for (size_t j = 0; j < num_nodes; ++j)
+          point_data[c] += field_vector[dofs[j]] * shape_values[j];
+      }
+      point_data[num_components] += 1.0;
+    } // for cell
+  }   // for point p
+
+  std::vector<double> globl_point_data(local_point_data.size(), 0.0);
+  mpi_comm.all_reduce(local_point_data.data(),
+                      static_cast<int>(local_point_data.size()),
+                      globl_point_data.data(),
+                      mpi::op::sum<double>());
+
+  std::vector<std::vector<double>> point_values(num_points,
+                                                std::vector<double>(num_components, 0.0));
+  for (size_t p = 0; p < num_points; ++p)
+  {
+    const double* point_data = &globl_point_data[p * stride];
+    const double num_point_hits = point_data[num_components];
+    if (num_point_hits > 0.0)
+      for (size_t c = 0; c < num_components; ++c)
+        point_values[p][c] = point_data[c] / num_point_hits;
+  }
 
-            local_point_value[c] += dof_value_j * shape_values[j];
-          } // for node i
-        }   // for component c
-      }     // if inside cell
-    }       // for cell
-  }         // if in bounding box
+  return point_values;
+}
 
-  // Communicate number of point hits
-  size_t globl_num_point_hits;
-  mpi_comm.all_reduce(local_num_point_hits, globl_num_point_hits, mpi::op::sum<size_t>());
+std::vector<std::vector<double>>
+FieldFunctionGridBased::GetLineValues(const Vector3& p0, const Vector3& p1, size_t num_points) const
+{
+  OpenSnInvalidArgumentIf(num_points < 2, "A line must be sampled at two points or more.");
 
-  std::vector<double> globl_point_value(num_components, 0.0);
-  mpi_comm.all_reduce(
-    local_point_value.data(), 1, globl_point_value.data(), mpi::op::sum<double>());
+  std::vector<Vector3> points(num_points);
+  const Vector3 delta = (p1 - p0) / static_cast<double>(num_points - 1);
+  for (size_t p = 0; p < num_points; ++p)
+    points[p] = p0 + delta * static_cast<double>(p);
 
-  Scale(globl_point_value, 1.0 / static_cast<double>(globl_num_point_hits));
+  return GetPointValues(points);
+}
 
-  return globl_point_value;
+std::vector<std::vector<double>>
+FieldFunctionGridBased::GetPlaneValues(const Vector3& origin,
+                                       const Vector3& u,
+                                       const Vector3& v,
+                                       size_t num_u,
+                                       size_t num_v) const
+{
+  OpenSnInvalidArgumentIf(num_u < 2 or num_v < 2,
+                          "A plane must be sampled at two points or more in each direction.");
+
+  std::vector<Vector3> points;
+  points.reserve(num_u * num_v);
+  const Vector3 delta_u = u / static_cast<double>(num_u - 1);
+  const Vector3 delta_v = v / static_cast<double>(num_v - 1);
+  for (size_t j = 0; j < num_v; ++j)
+    for (size_t i = 0; i < num_u; ++i)
+      points.push_back(origin + delta_u * static_cast<double>(i) +
+                       delta_v * static_cast<double>(j));
+
+  return GetPointValues(points);
 }
 
 double
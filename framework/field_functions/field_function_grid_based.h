@@ -98,6 +98,33 @@ public:
    */
   virtual std::vector<double> GetPointValue(const Vector3& point) const;
 
+  /**
+   * Returns the component values at each of the requested points. The points are located with
+   * the grid's spatial index, and the contributions of all ranks are combined with a single
+   * reduction, so this is far cheaper than calling GetPointValue for every point. The value at a
+   * point that lies on several cells is averaged over those cells. Points outside the grid
+   * evaluate to zero. This must be called on all ranks with the same points.
+   */
+  std::vector<std::vector<double>> GetPointValues(const std::vector<Vector3>& points) const;
+
+  /**
+   * Returns the component values at `num_points` equally spaced points on the line from `p0` to
+   * `p1`, both end points included. The points are evaluated in one batch with GetPointValues.
+   */
+  std::vector<std::vector<double>>
+  GetLineValues(const Vector3& p0, const Vector3& p1, size_t num_points) const;
+
+  /**
+   * Returns the component values on a `num_u` by `num_v` grid of points spanning the
+   * parallelogram `origin + s * u + t * v` with `s` and `t` in [0, 1], edges included. The points
+   * are ordered with `s` varying fastest and are evaluated in one batch with GetPointValues.
+   */
+  std::vector<std::vector<double>> GetPlaneValues(const Vector3& origin,
+                                                  const Vector3& u,
+                                                  const Vector3& v,
+                                                  size_t num_u,
+                                                  size_t num_v) const;
+
   /**Evaluates the field function, on a cell, at the specified point.*/
   double Evaluate(const Cell& cell, const Vector3& position, unsigned int component) const override;
 
@@ -44,23 +44,32 @@ FieldFunctionInterpolationLine::Initialize()
     const auto& sdm = ff_context.ref_ff->GetSpatialDiscretization();
     const auto& grid = sdm.Grid();
 
+    // Field functions on the same grid share the homes of the points
+    if (ff > 0 and &ff_contexts_[ff - 1].ref_ff->GetSpatialDiscretization().Grid() == &grid)
+    {
+      const auto& prev_context = ff_contexts_[ff - 1];
+      ff_context.interpolation_points_ass_cell = prev_context.interpolation_points_ass_cell;
+      ff_context.interpolation_points_has_ass_cell = prev_context.interpolation_points_has_ass_cell;
+      continue;
+    }
+
     ff_context.interpolation_points_ass_cell.assign(number_of_points_, 0);
     ff_context.interpolation_points_has_ass_cell.assign(number_of_points_, false);
 
-    // Find a home for each point
-    for (const auto& cell : grid.local_cells)
+    // Find a home for each point. If a point is inside several local cells, the one with the
+    // highest local id is used.
+    for (int p = 0; p < number_of_points_; p++)
     {
-      for (int p = 0; p < number_of_points_; p++)
+      for (uint64_t global_id : grid.FindCellsContainingPoint(interpolation_points_[p]))
       {
-        const auto& point = interpolation_points_[p];
-        if (grid.CheckPointInsideCell(cell, point))
-        {
-          ff_context.interpolation_points_ass_cell[p] = cell.local_id_;
-          ff_context.interpolation_points_has_ass_cell[p] = true;
-        }
-      } // for point p
-    }   // for cell
-  }     // for ff
+        const auto local_id = grid.cells[global_id].local_id_;
+        auto& home = ff_context.interpolation_points_ass_cell[p];
+        if (not ff_context.interpolation_points_has_ass_cell[p] or local_id > home)
+          home = local_id;
+        ff_context.interpolation_points_has_ass_cell[p] = true;
+      }
+    } // for point p
+  }   // for ff
 
   log.Log0Verbose1() << "Finished initializing interpolator.";
 }
@@ -76,12 +85,7 @@ FieldFunctionInterpolationLine::Execute()
     const auto& sdm = ref_ff.GetSpatialDiscretization();
     const auto& grid = sdm.Grid();
 
-    const auto& uk_man = ref_ff.GetUnknownManager();
-    const auto uid = 0;
-    const auto cid = ref_component_;
-
-    const auto field_data = ref_ff.GetGhostedFieldVector();
-
+    // Evaluating directly from the field function avoids copying its ghosted field vector
     ff_ctx.interpolation_points_values.assign(number_of_points_, 0.0);
     for (int p = 0; p < number_of_points_; ++p)
     {
@@ -90,20 +94,8 @@ FieldFunctionInterpolationLine::Execute()
 
       const auto cell_local_index = ff_ctx.interpolation_points_ass_cell[p];
       const auto& cell = grid.local_cells[cell_local_index];
-      const auto& cell_mapping = sdm.GetCellMapping(cell);
-      const size_t num_nodes = cell_mapping.NumNodes();
-
-      std::vector<double> shape_function_vals(num_nodes, 0.0);
-      cell_mapping.ShapeValues(interpolation_points_[p], shape_function_vals);
-
-      double point_value = 0.0;
-      for (size_t i = 0; i < num_nodes; ++i)
-      {
-        const int64_t imap = sdm.MapDOFLocal(cell, i, uk_man, uid, cid);
-
-        point_value += shape_function_vals[i] * field_data[imap];
-      } // for node i
-      ff_ctx.interpolation_points_values[p] = point_value;
+      ff_ctx.interpolation_points_values[p] =
+        ref_ff.Evaluate(cell, interpolation_points_[p], ref_component_);
     } // for p
   }   // for ff
 }
@@ -17,9 +17,12 @@ FieldFunctionInterpolationPoint::Initialize()
   const std::string fname = "FieldFunctionInterpolationPoint::Initialize";
   const auto& grid = field_functions_.front()->GetSpatialDiscretization().Grid();
 
+  // The nudged point lies between the point and the cell centroid, so only cells whose bounding
+  // boxes contain the point itself need to be checked.
   std::vector<uint64_t> cells_potentially_owning_point;
-  for (const auto& cell : grid.local_cells)
+  for (uint64_t global_id : grid.FindCellsNearPoint(point_of_interest_))
   {
+    const auto& cell = grid.cells[global_id];
     const auto& vcc = cell.centroid_;
     const auto& poi = point_of_interest_;
     const auto nudged_point = poi + 1.0e-6 * (vcc - poi);
@@ -54,32 +57,11 @@ FieldFunctionInterpolationPoint::Execute()
     return;
 
   const auto& ref_ff = *field_functions_.front();
-  const auto& sdm = ref_ff.GetSpatialDiscretization();
-  const auto& grid = sdm.Grid();
-
-  const auto& uk_man = ref_ff.GetUnknownManager();
-  const auto uid = 0;
-  const auto cid = ref_component_;
-
-  const auto field_data = ref_ff.GetGhostedFieldVector();
+  const auto& grid = ref_ff.GetSpatialDiscretization().Grid();
 
+  // Evaluating directly from the field function avoids copying its ghosted field vector
   const auto& cell = grid.cells[owning_cell_gid_];
-  const auto& cell_mapping = sdm.GetCellMapping(cell);
-  const size_t num_nodes = cell_mapping.NumNodes();
-
-  std::vector<double> node_dof_values(num_nodes, 0.0);
-  for (size_t i = 0; i < num_nodes; ++i)
-  {
-    const int64_t imap = sdm.MapDOFLocal(cell, i, uk_man, uid, cid);
-    node_dof_values[i] = field_data[imap];
-  } // for i
-
-  std::vector<double> shape_values(num_nodes, 0.0);
-  cell_mapping.ShapeValues(point_of_interest_, shape_values);
-
-  point_value_ = 0.0;
-  for (size_t i = 0; i < num_nodes; ++i)
-    point_value_ += node_dof_values[i] * shape_values[i];
+  point_value_ = ref_ff.Evaluate(cell, point_of_interest_, ref_component_);
 }
 
 double
@@ -3,21 +3,25 @@
 
 #include "framework/materials/multi_group_xs/multi_group_xs.h"
 #include "framework/logging/log.h"
+#include <cmath>
+#include <numeric>
 
 namespace opensn
 {
 
 void
-MultiGroupXS::Initialize(double sigma_t, double c)
+MultiGroupXS::Initialize(double sigma_t, double c, size_t num_groups)
 {
+  OpenSnInvalidArgumentIf(num_groups == 0, "The number of groups must be positive.");
+
   Reset();
 
-  num_groups_ = 1;
+  num_groups_ = num_groups;
   sigma_t_.resize(num_groups_, sigma_t);
   sigma_a_.resize(num_groups_, sigma_t * (1.0 - c));
-  transfer_matrices_.emplace_back(num_groups_, num_groups_);
-  auto& S = transfer_matrices_.back();
+  SparseMatrix S(num_groups_, num_groups_);
   S.SetDiagonal(std::vector<double>(num_groups_, sigma_t * c));
+  SetTransferMatrices({S});
   ComputeDiffusionParameters();
 }
 
@@ -88,11 +92,12 @@ MultiGroupXS::Initialize(std::vector<std::pair<int, double>>& combinations)
   sigma_a_.assign(n_grps, 0.0);
 
   // Init transfer matrices only if at least one exists
+  std::vector<SparseMatrix> transfer_matrices;
   if (std::any_of(xsecs.begin(),
                   xsecs.end(),
                   [](const std::shared_ptr<MultiGroupXS>& x)
                   { return not x->TransferMatrices().empty(); }))
-    transfer_matrices_.assign(scattering_order_ + 1, SparseMatrix(num_groups_, num_groups_));
+    transfer_matrices.assign(scattering_order_ + 1, SparseMatrix(num_groups_, num_groups_));
 
   // Init fission data
   if (is_fissionable_)
@@ -189,19 +194,21 @@ MultiGroupXS::Initialize(std::vector<std::pair<int, double>>& combinations)
     {
       for (size_t m = 0; m < xsecs[x]->ScatteringOrder() + 1; ++m)
       {
-        auto& Sm = transfer_matrices_[m];
+        auto& Sm = transfer_matrices[m];
         const auto& Sm_other = xsecs[x]->TransferMatrix(m);
         for (size_t g = 0; g < num_groups_; ++g)
         {
-          const auto& cols = Sm_other.rowI_indices_[g];
-          const auto& vals = Sm_other.rowI_values_[g];
-          for (size_t t = 0; t < cols.size(); ++t)
+          const size_t row_size = Sm_other.RowSize(g);
+          const double* vals = Sm_other.RowValues(g);
+          for (size_t t = 0; t < row_size; ++t)
             Sm.InsertAdd(g, t, vals[t]);
         }
       }
     }
   } // for cross sections
 
+  SetTransferMatrices(transfer_matrices);
+  CompressProductionMatrix();
   ComputeDiffusionParameters();
 }
 
@@ -222,6 +229,9 @@ MultiGroupXS::Reset()
   nu_prompt_sigma_f_.clear();
   nu_delayed_sigma_f_.clear();
   production_matrix_.clear();
+  sparse_production_matrix_ = CompressedSparseMatrix();
+  production_spectrum_.clear();
+  production_weights_.clear();
   precursors_.clear();
 
   inv_velocity_.clear();
@@ -258,9 +268,10 @@ MultiGroupXS::ComputeAbsorption()
       double sigma_s = 0.0;
       for (size_t row = 0; row < S0.NumRows(); ++row)
       {
-        const auto& cols = S0.rowI_indices_[row];
-        const auto& vals = S0.rowI_values_[row];
-        for (size_t t = 0; t < cols.size(); ++t)
+        const size_t row_size = S0.RowSize(row);
+        const uint32_t* cols = S0.RowColumnIndices(row);
+        const double* vals = S0.RowValues(row);
+        for (size_t t = 0; t < row_size; ++t)
         {
           if (cols[t] == g)
           {
@@ -301,9 +312,10 @@ MultiGroupXS::ComputeDiffusionParameters()
     {
       for (size_t gp = 0; gp < num_groups_; ++gp)
       {
-        const auto& cols = S[1].rowI_indices_[gp];
-        const auto& vals = S[1].rowI_values_[gp];
-        for (size_t t = 0; t < cols.size(); ++t)
+        const size_t row_size = S[1].RowSize(gp);
+        const uint32_t* cols = S[1].RowColumnIndices(gp);
+        const double* vals = S[1].RowValues(gp);
+        for (size_t t = 0; t < row_size; ++t)
           if (cols[t] == g)
           {
             sigma_1 += vals[t];
@@ -330,9 +342,10 @@ MultiGroupXS::ComputeDiffusionParameters()
     // Determine within group scattering
     if (not S.empty())
     {
-      const auto& cols = S[0].rowI_indices_[g];
-      const auto& vals = S[0].rowI_values_[g];
-      for (size_t t = 0; t < cols.size(); ++t)
+      const size_t row_size = S[0].RowSize(g);
+      const uint32_t* cols = S[0].RowColumnIndices(g);
+      const double* vals = S[0].RowValues(g);
+      for (size_t t = 0; t < row_size; ++t)
       {
         if (cols[t] == g)
         {
@@ -378,9 +391,8 @@ MultiGroupXS::SetScalingFactor(const double factor)
 
   // Apply to transfer matrices
   for (auto& S_ell : transfer_matrices_)
-    for (size_t g = 0; g < num_groups_; ++g)
-      for (const auto& [_, gp, sig_ell] : S_ell.Row(g))
-        sig_ell *= m;
+    S_ell = S_ell.Scaled(m);
+  CompressProductionMatrix();
 
   // Reinitialize diffusion
   diffusion_initialized_ = false;
@@ -391,21 +403,8 @@ void
 MultiGroupXS::TransposeTransferAndProduction()
 {
   // Transpose transfer matrices
-  for (unsigned int ell = 0; ell <= scattering_order_; ++ell)
-  {
-    const auto& S_ell = transfer_matrices_[ell];
-    SparseMatrix S_ell_transpose(num_groups_, num_groups_);
-    for (size_t g = 0; g < num_groups_; ++g)
-    {
-      const size_t row_len = S_ell.rowI_indices_[g].size();
-      const size_t* col_ptr = S_ell.rowI_indices_[g].data();
-      const double* val_ptr = S_ell.rowI_values_[g].data();
-
-      for (size_t j = 0; j < row_len; ++j)
-        S_ell_transpose.Insert(*col_ptr++, g, *val_ptr++);
-    }
-    transposed_transfer_matrices_.push_back(S_ell_transpose);
-  } // for ell
+  for (const auto& S_ell : transfer_matrices_)
+    transposed_transfer_matrices_.push_back(S_ell.Transpose());
 
   // Transpose production matrices
   if (is_fissionable_)
@@ -416,7 +415,89 @@ MultiGroupXS::TransposeTransferAndProduction()
     for (size_t g = 0; g < num_groups_; ++g)
       for (size_t gp = 0; gp < num_groups_; ++gp)
         transposed_production_matrix_[g].push_back(F[gp][g]);
+    transposed_sparse_production_matrix_ = sparse_production_matrix_.Transpose();
+  }
+}
+
+void
+MultiGroupXS::SetTransferMatrices(const std::vector<SparseMatrix>& matrices)
+{
+  transfer_matrices_.clear();
+  transfer_matrices_.reserve(matrices.size());
+  for (const auto& matrix : matrices)
+    transfer_matrices_.emplace_back(matrix);
+}
+
+void
+MultiGroupXS::CompressProductionMatrix()
+{
+  if (production_matrix_.empty())
+  {
+    sparse_production_matrix_ = CompressedSparseMatrix();
+    production_spectrum_.clear();
+    production_weights_.clear();
+    return;
+  }
+
+  SparseMatrix F(num_groups_, num_groups_);
+  for (size_t g = 0; g < num_groups_; ++g)
+    for (size_t gp = 0; gp < num_groups_; ++gp)
+      if (production_matrix_[g][gp] != 0.0)
+        F.Insert(g, gp, production_matrix_[g][gp]);
+  sparse_production_matrix_ = CompressedSparseMatrix(F);
+
+  FactorProductionMatrix();
+}
+
+void
+MultiGroupXS::FactorProductionMatrix()
+{
+  production_spectrum_.clear();
+  production_weights_.clear();
+
+  const auto& F = production_matrix_;
+
+  // Pivot on the largest entry
+  size_t g_max = 0;
+  size_t gp_max = 0;
+  for (size_t g = 0; g < num_groups_; ++g)
+    for (size_t gp = 0; gp < num_groups_; ++gp)
+      if (std::fabs(F[g][gp]) > std::fabs(F[g_max][gp_max]))
+      {
+        g_max = g;
+        gp_max = gp;
+      }
+  const double F_max = F[g_max][gp_max];
+  if (F_max == 0.0)
+    return;
+
+  // Candidate factors: the pivot column and the pivot row, scaled by the pivot
+  std::vector<double> spectrum(num_groups_);
+  std::vector<double> weights(num_groups_);
+  for (size_t g = 0; g < num_groups_; ++g)
+    spectrum[g] = F[g][gp_max];
+  for (size_t gp = 0; gp < num_groups_; ++gp)
+    weights[gp] = F[g_max][gp] / F_max;
+
+  // The factors must reproduce every entry to round-off
+  const double tolerance = 1.0e-12 * std::fabs(F_max);
+  for (size_t g = 0; g < num_groups_; ++g)
+    for (size_t gp = 0; gp < num_groups_; ++gp)
+      if (std::fabs(F[g][gp] - spectrum[g] * weights[gp]) > tolerance)
+        return;
+
+  // Normalize the spectrum to unit sum
+  const double sum = std::accumulate(spectrum.begin(), spectrum.end(), 0.0);
+  if (sum != 0.0)
+  {
+    for (auto& x : spectrum)
+      x /= sum;
+    for (auto& x : weights)
+      x *= sum;
   }
+
+  production_spectrum_ = std::move(spectrum);
+  production_weights_ = std::move(weights);
 }
 
 } // namespace opensn
@@ -4,7 +4,7 @@
 #pragma once
 
 #include "framework/materials/material_property.h"
-#include "framework/math/sparse_matrix/math_sparse_matrix.h"
+#include "framework/math/sparse_matrix/compressed_sparse_matrix.h"
 
 namespace opensn
 {
@@ -25,9 +25,10 @@ public:
   }
 
   /**
-   * Makes a simple material with a 1-group cross-section set.
+   * Makes a simple material with `num_groups` identical groups, each with total cross section
+   * `sigma_t` and scattering ratio `c`. Scattering is isotropic and within-group only.
    */
-  void Initialize(double sigma_t, double c);
+  void Initialize(double sigma_t, double c, size_t num_groups = 1);
 
   /**
    * Populates the cross section from a combination of others.
@@ -97,14 +98,18 @@ public:
 
   const std::vector<double>& SigmaAbsorption() const { return sigma_a_; }
 
-  const std::vector<SparseMatrix>& TransferMatrices() const
+  /**
+   * Returns the transfer matrices, one per Legendre moment, in compressed sparse row form. Row `g`
+   * holds the transfer cross sections from groups `g'` into group `g`.
+   */
+  const std::vector<CompressedSparseMatrix>& TransferMatrices() const
   {
     if (adjoint_)
       return transposed_transfer_matrices_;
     return transfer_matrices_;
   }
 
-  const SparseMatrix& TransferMatrix(unsigned int ell) const
+  const CompressedSparseMatrix& TransferMatrix(unsigned int ell) const
   {
     if (adjoint_)
       return transposed_transfer_matrices_.at(ell);
@@ -126,6 +131,47 @@ public:
     return production_matrix_;
   }
 
+  /**
+   * Returns the production matrix in compressed sparse row form, without the zero entries. Empty
+   * for non-fissionable cross sections.
+   */
+  const CompressedSparseMatrix& SparseProductionMatrix() const
+  {
+    if (adjoint_)
+      return transposed_sparse_production_matrix_;
+    return sparse_production_matrix_;
+  }
+
+  /**
+   * Returns true if the production matrix is separable, i.e. of the form
+   * `F[g][g'] = ProductionSpectrum()[g] * ProductionWeights()[g']`. This is the case whenever all
+   * fission neutrons share a single emission spectrum, which allows fission sources to be formed
+   * from one weighted sum of the flux instead of a full matrix-vector product.
+   */
+  bool IsProductionSeparable() const { return not production_spectrum_.empty(); }
+
+  /**
+   * Returns the emission spectrum of a separable production matrix. In forward mode, the spectrum
+   * is normalized to unit sum. Empty if the production matrix is not separable.
+   */
+  const std::vector<double>& ProductionSpectrum() const
+  {
+    if (adjoint_)
+      return production_weights_;
+    return production_spectrum_;
+  }
+
+  /**
+   * Returns the group-wise production weights of a separable production matrix. Empty if the
+   * production matrix is not separable.
+   */
+  const std::vector<double>& ProductionWeights() const
+  {
+    if (adjoint_)
+      return production_spectrum_;
+    return production_weights_;
+  }
+
   const std::vector<Precursor>& Precursors() const { return precursors_; }
 
   const std::vector<double>& InverseVelocity() const { return inv_velocity_; }
@@ -157,10 +203,14 @@ private:
   std::vector<double> nu_delayed_sigma_f_; ///< Delayed neutron production due to fission
   std::vector<double> inv_velocity_;       ///< Inverse velocity
   std::vector<Precursor> precursors_;
-  std::vector<SparseMatrix> transfer_matrices_; ///< Sparse scattering matrix
-  std::vector<SparseMatrix> transposed_transfer_matrices_;
+  std::vector<CompressedSparseMatrix> transfer_matrices_; ///< Sparse scattering matrix
+  std::vector<CompressedSparseMatrix> transposed_transfer_matrices_;
   std::vector<std::vector<double>> production_matrix_; ///< Total neutron production matrix
   std::vector<std::vector<double>> transposed_production_matrix_;
+  CompressedSparseMatrix sparse_production_matrix_;
+  CompressedSparseMatrix transposed_sparse_production_matrix_;
+  std::vector<double> production_spectrum_; ///< Spectrum of a separable production matrix
+  std::vector<double> production_weights_;  ///< Weights of a separable production matrix
 
   // Diffusion quantities
   bool diffusion_initialized_;
@@ -177,6 +227,15 @@ private:
 
   void TransposeTransferAndProduction();
 
+  /**Sets the transfer matrices from their assembled form.*/
+  void SetTransferMatrices(const std::vector<SparseMatrix>& matrices);
+
+  /**Rebuilds the compressed production matrix and the separable factors from the dense one.*/
+  void CompressProductionMatrix();
+
+  /**Factors the production matrix into a spectrum and weights, if it is separable.*/
+  void FactorProductionMatrix();
+
   /// Check vector for all non-negative values
   bool IsNonNegative(const std::vector<double>& vec)
   {
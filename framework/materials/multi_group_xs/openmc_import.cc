@@ -95,7 +95,8 @@ MultiGroupXS::Initialize(const std::string& file_name,
   // Transfer
   if (H5Has(file, path + "scatter_data/scatter_matrix"))
   {
-    transfer_matrices_.assign(scattering_order_ + 1, SparseMatrix(num_groups_, num_groups_));
+    std::vector<SparseMatrix> transfer_matrices(scattering_order_ + 1,
+                                                SparseMatrix(num_groups_, num_groups_));
     auto flat_scatter_matrix = H5ReadDataset1D<double>(file, path + "scatter_data/scatter_matrix");
     auto g_min = H5ReadDataset1D<int>(file, path + "scatter_data/g_min");
     auto g_max = H5ReadDataset1D<int>(file, path + "scatter_data/g_max");
@@ -103,7 +104,8 @@ MultiGroupXS::Initialize(const std::string& file_name,
     for (int g = 0; g < num_groups_; ++g)
       for (int gp = g_min[g]; gp <= g_max[g]; ++gp)
         for (int n = 0; n < scattering_order_ + 1; ++n, ++fidx)
-          transfer_matrices_.at(n).Insert(g, gp - 1, flat_scatter_matrix[fidx]);
+          transfer_matrices.at(n).Insert(g, gp - 1, flat_scatter_matrix[fidx]);
+    SetTransferMatrices(transfer_matrices);
   }
 
   if (sigma_a_.empty())
@@ -192,6 +194,8 @@ MultiGroupXS::Initialize(const std::string& file_name,
     production_matrix_.clear();
     precursors_.clear();
   }
+
+  CompressProductionMatrix();
 }
 
 } // namespace opensn
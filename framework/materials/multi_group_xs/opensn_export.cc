@@ -139,13 +139,10 @@ MultiGroupXS::ExportToOpenSnXSFile(const std::string& file_name, const double fi
 
       const auto& matrix = TransferMatrix(ell);
 
-      for (size_t g = 0; g < matrix.rowI_values_.size(); ++g)
+      for (size_t g = 0; g < matrix.NumRows(); ++g)
       {
-        const auto& col_indices = matrix.rowI_indices_[g];
-        const auto& col_values = matrix.rowI_values_[g];
-        for (size_t k = 0; k < col_indices.size(); ++k)
-          ofile << "M_GPRIME_G_VAL " << ell << " " << col_indices[k] << " " << g << " "
-                << col_values[k] << "\n";
+        for (const auto& [_, gp, value] : matrix.Row(g))
+          ofile << "M_GPRIME_G_VAL " << ell << " " << gp << " " << g << " " << value << "\n";
       } // for g
 
       ofile << "\n";
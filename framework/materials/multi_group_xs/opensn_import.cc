@@ -486,8 +486,12 @@ MultiGroupXS::Initialize(const std::string& file_name)
       //
 
       if (fw == "TRANSFER_MOMENTS_BEGIN")
+      {
+        std::vector<SparseMatrix> transfer_matrices;
         ReadTransferMatrices(
-          "TRANSFER_MOMENTS", transfer_matrices_, scattering_order_ + 1, num_groups_, f, ls, ln);
+          "TRANSFER_MOMENTS", transfer_matrices, scattering_order_ + 1, num_groups_, f, ls, ln);
+        SetTransferMatrices(transfer_matrices);
+      }
 
       if (fw == "PRODUCTION_MATRIX_BEGIN")
         Read2DData("PRODUCTION_MATRIX",
@@ -704,6 +708,8 @@ MultiGroupXS::Initialize(const std::string& file_name)
     production_matrix_.clear();
     precursors_.clear();
   } // if not fissionable
+
+  CompressProductionMatrix();
 }
 
 } // namespace opensn
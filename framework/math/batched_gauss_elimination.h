@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+
+namespace opensn
+{
+
+/**
+ * Gauss elimination without pivoting for a batch of `num_systems` dense n x n systems that share
+ * the same size. The systems are stored interleaved, with the system index running fastest:
+ *
+ * - A(i,j) of system s is `A[(i * n + j) * num_systems + s]`
+ * - b(i) of system s is `b[i * num_systems + s]`
+ *
+ * All inner loops therefore run over contiguous memory across the batch and vectorize. A is
+ * destroyed and the solutions are returned in b. When `N` is non-zero the matrix size is a
+ * compile-time constant (and `n` is ignored), which lets the compiler fully unroll the row loops.
+ */
+template <int N>
+void
+BatchedGaussElimination(double* __restrict A, double* __restrict b, int n, size_t num_systems)
+{
+  const int nn = (N > 0) ? N : n;
+  const size_t ns = num_systems;
+
+  // Forward elimination. The reciprocal of each pivot is stored on the diagonal and the row
+  // multipliers are stored in the (no longer needed) lower triangle.
+  for (int i = 0; i < nn; ++i)
+  {
+    double* Aii = &A[(i * nn + i) * ns];
+    const double* bi = &b[i * ns];
+    for (size_t s = 0; s < ns; ++s)
+      Aii[s] = 1.0 / Aii[s];
+
+    for (int j = i + 1; j < nn; ++j)
+    {
+      double* Aji = &A[(j * nn + i) * ns];
+      double* bj = &b[j * ns];
+      for (size_t s = 0; s < ns; ++s)
+      {
+        Aji[s] *= Aii[s];
+        bj[s] -= Aji[s] * bi[s];
+      }
+      for (int k = i + 1; k < nn; ++k)
+      {
+        const double* Aik = &A[(i * nn + k) * ns];
+        double* Ajk = &A[(j * nn + k) * ns];
+        for (size_t s = 0; s < ns; ++s)
+          Ajk[s] -= Aji[s] * Aik[s];
+      }
+    }
+  }
+
+  // Back substitution
+  for (int i = nn - 1; i >= 0; --i)
+  {
+    double* bi = &b[i * ns];
+    for (int j = i + 1; j < nn; ++j)
+    {
+      const double* Aij = &A[(i * nn + j) * ns];
+      const double* bj = &b[j * ns];
+      for (size_t s = 0; s < ns; ++s)
+        bi[s] -= Aij[s] * bj[s];
+    }
+    const double* Aii = &A[(i * nn + i) * ns];
+    for (size_t s = 0; s < ns; ++s)
+      bi[s] *= Aii[s];
+  }
+}
+
+/**
+ * Dispatches BatchedGaussElimination to a fixed-size instantiation for the common cell node
+ * counts (triangles, quadrilaterals, tetrahedra, prisms and hexahedra) and to the general
+ * runtime-size version otherwise.
+ */
+inline void
+BatchedGaussElimination(double* A, double* b, int n, size_t num_systems)
+{
+  switch (n)
+  {
+    case 2:
+      BatchedGaussElimination<2>(A, b, n, num_systems);
+      break;
+    case 3:
+      BatchedGaussElimination<3>(A, b, n, num_systems);
+      break;
+    case 4:
+      BatchedGaussElimination<4>(A, b, n, num_systems);
+      break;
+    case 6:
+      BatchedGaussElimination<6>(A, b, n, num_systems);
+      break;
+    case 8:
+      BatchedGaussElimination<8>(A, b, n, num_systems);
+      break;
+    default:
+      BatchedGaussElimination<0>(A, b, n, num_systems);
+  }
+}
+
+} // namespace opensn
@@ -18,4 +18,14 @@ ScalarSpatialMaterialFunction::ScalarSpatialMaterialFunction(const InputParamete
 {
 }
 
+std::vector<double>
+ScalarSpatialMaterialFunction::EvaluateBatch(int mat_id, const std::vector<Vector3>& xyz) const
+{
+  std::vector<double> values;
+  values.reserve(xyz.size());
+  for (const auto& point : xyz)
+    values.push_back(Evaluate(mat_id, point));
+  return values;
+}
+
 } // namespace opensn
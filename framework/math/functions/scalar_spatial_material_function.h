@@ -26,6 +26,16 @@ public:
    * \return Function value
    */
   virtual double Evaluate(int mat_id, const Vector3& xyz) const = 0;
+
+  /**
+   * Evaluate this function at a batch of points of the same material. The default calls
+   * Evaluate once per point; functions with a per-call overhead override it.
+   *
+   * \param mat_id The material ID of the points
+   * \param xyz The xyz coordinates of the points
+   * \return One function value per point
+   */
+  virtual std::vector<double> EvaluateBatch(int mat_id, const std::vector<Vector3>& xyz) const;
 };
 
 } // namespace opensn
@@ -17,4 +17,19 @@ SpatialMaterialFunction::SpatialMaterialFunction(const InputParameters& params)
 {
 }
 
+std::vector<double>
+SpatialMaterialFunction::EvaluateBatch(const std::vector<Vector3>& xyz,
+                                       int mat_id,
+                                       int num_components) const
+{
+  std::vector<double> values;
+  values.reserve(xyz.size() * num_components);
+  for (const auto& point : xyz)
+  {
+    const auto point_values = Evaluate(point, mat_id, num_components);
+    values.insert(values.end(), point_values.begin(), point_values.end());
+  }
+  return values;
+}
+
 } // namespace opensn
@@ -28,6 +28,18 @@ public:
    */
   virtual std::vector<double>
   Evaluate(const Vector3& xyz, int mat_id, int num_components) const = 0;
+
+  /**
+   * Evaluate the function at a batch of points of the same material. The default calls Evaluate
+   * once per point; functions with a per-call overhead override it.
+   *
+   * \param xyz The xyz coordinates of the points
+   * \param mat_id Material ID of the points
+   * \param num_components Number of components
+   * \return The responses, point-major (`num_components` entries per point)
+   */
+  virtual std::vector<double>
+  EvaluateBatch(const std::vector<Vector3>& xyz, int mat_id, int num_components) const;
 };
 
 } // namespace opensn
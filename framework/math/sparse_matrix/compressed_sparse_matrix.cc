@@ -0,0 +1,179 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "framework/math/sparse_matrix/compressed_sparse_matrix.h"
+#include "framework/logging/log_exceptions.h"
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+
+namespace opensn
+{
+
+namespace
+{
+
+/**64-bit FNV-1a hash of a byte range, continued from `hash`.*/
+uint64_t
+HashBytes(const void* data, size_t num_bytes, uint64_t hash)
+{
+  const auto* bytes = static_cast<const unsigned char*>(data);
+  for (size_t i = 0; i < num_bytes; ++i)
+  {
+    hash ^= bytes[i];
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+} // namespace
+
+bool
+CompressedSparseMatrix::Storage::operator==(const Storage& other) const
+{
+  // Values are compared bitwise so that matrices only share storage when they are
+  // indistinguishable
+  return num_rows == other.num_rows and num_cols == other.num_cols and
+         row_offsets == other.row_offsets and column_indices == other.column_indices and
+         values.size() == other.values.size() and
+         std::memcmp(values.data(), other.values.data(), values.size() * sizeof(double)) == 0;
+}
+
+std::shared_ptr<const CompressedSparseMatrix::Storage>
+CompressedSparseMatrix::Share(Storage&& storage)
+{
+  // Matrices are registered by content hash. The registry only holds weak references, so storage
+  // is released with the last matrix that uses it.
+  static std::mutex registry_mutex;
+  static std::unordered_multimap<uint64_t, std::weak_ptr<const Storage>> registry;
+
+  uint64_t hash = 14695981039346656037ull;
+  hash = HashBytes(&storage.num_rows, sizeof(size_t), hash);
+  hash = HashBytes(&storage.num_cols, sizeof(size_t), hash);
+  hash = HashBytes(storage.row_offsets.data(), storage.row_offsets.size() * sizeof(uint32_t), hash);
+  hash = HashBytes(
+    storage.column_indices.data(), storage.column_indices.size() * sizeof(uint32_t), hash);
+  hash = HashBytes(storage.values.data(), storage.values.size() * sizeof(double), hash);
+
+  std::lock_guard<std::mutex> lock(registry_mutex);
+
+  auto [begin, end] = registry.equal_range(hash);
+  for (auto it = begin; it != end;)
+  {
+    if (auto existing = it->second.lock())
+    {
+      if (*existing == storage)
+        return existing;
+      ++it;
+    }
+    else
+      it = registry.erase(it);
+  }
+
+  auto shared = std::make_shared<const Storage>(std::move(storage));
+  registry.emplace(hash, shared);
+  return shared;
+}
+
+CompressedSparseMatrix::CompressedSparseMatrix() : CompressedSparseMatrix(Storage{0, 0, {0}, {}, {}})
+{
+}
+
+CompressedSparseMatrix::CompressedSparseMatrix(Storage&& storage)
+  : storage_(Share(std::move(storage)))
+{
+}
+
+CompressedSparseMatrix::CompressedSparseMatrix(const SparseMatrix& matrix)
+{
+  const size_t num_rows = matrix.NumRows();
+
+  size_t num_entries = 0;
+  for (size_t i = 0; i < num_rows; ++i)
+    num_entries += matrix.rowI_indices_[i].size();
+
+  constexpr size_t max_index = std::numeric_limits<uint32_t>::max();
+  OpenSnInvalidArgumentIf(matrix.NumCols() > max_index or num_entries > max_index,
+                          "The matrix is too large for 32-bit indices.");
+
+  Storage storage;
+  storage.num_rows = num_rows;
+  storage.num_cols = matrix.NumCols();
+  storage.row_offsets.reserve(num_rows + 1);
+  storage.column_indices.reserve(num_entries);
+  storage.values.reserve(num_entries);
+
+  storage.row_offsets.push_back(0);
+  for (size_t i = 0; i < num_rows; ++i)
+  {
+    for (const size_t j : matrix.rowI_indices_[i])
+      storage.column_indices.push_back(static_cast<uint32_t>(j));
+    storage.values.insert(
+      storage.values.end(), matrix.rowI_values_[i].begin(), matrix.rowI_values_[i].end());
+    storage.row_offsets.push_back(static_cast<uint32_t>(storage.values.size()));
+  }
+
+  storage_ = Share(std::move(storage));
+}
+
+double
+CompressedSparseMatrix::ValueIJ(size_t i, size_t j) const
+{
+  const size_t row_size = RowSize(i);
+  const uint32_t* column_indices = RowColumnIndices(i);
+  for (size_t k = 0; k < row_size; ++k)
+    if (column_indices[k] == j)
+      return RowValues(i)[k];
+  return 0.0;
+}
+
+CompressedSparseMatrix
+CompressedSparseMatrix::Transpose() const
+{
+  const auto& source = *storage_;
+
+  Storage storage;
+  storage.num_rows = source.num_cols;
+  storage.num_cols = source.num_rows;
+  storage.row_offsets.assign(storage.num_rows + 1, 0);
+  storage.column_indices.resize(source.column_indices.size());
+  storage.values.resize(source.values.size());
+
+  // Count, then scatter. Rows of the source are visited in order, so the entries of each row of
+  // the transpose are ordered by column.
+  for (const uint32_t j : source.column_indices)
+    ++storage.row_offsets[j + 1];
+  for (size_t j = 0; j < storage.num_rows; ++j)
+    storage.row_offsets[j + 1] += storage.row_offsets[j];
+
+  std::vector<uint32_t> next(storage.row_offsets.begin(), storage.row_offsets.end() - 1);
+  for (size_t i = 0; i < source.num_rows; ++i)
+    for (uint32_t k = source.row_offsets[i]; k < source.row_offsets[i + 1]; ++k)
+    {
+      const uint32_t dest = next[source.column_indices[k]]++;
+      storage.column_indices[dest] = static_cast<uint32_t>(i);
+      storage.values[dest] = source.values[k];
+    }
+
+  return CompressedSparseMatrix(std::move(storage));
+}
+
+CompressedSparseMatrix
+CompressedSparseMatrix::Scaled(double factor) const
+{
+  Storage storage = *storage_;
+  for (auto& value : storage.values)
+    value *= factor;
+  return CompressedSparseMatrix(std::move(storage));
+}
+
+size_t
+CompressedSparseMatrix::StorageSize() const
+{
+  return storage_->row_offsets.size() * sizeof(uint32_t) +
+         storage_->column_indices.size() * sizeof(uint32_t) +
+         storage_->values.size() * sizeof(double);
+}
+
+} // namespace opensn
@@ -0,0 +1,155 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "framework/math/sparse_matrix/math_sparse_matrix.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace opensn
+{
+
+/**
+ * Immutable compressed sparse row (CSR) matrix with 32-bit indices.
+ *
+ * The row offsets, column indices and values are stored in three flat arrays, so that looping
+ * over a row reads contiguous memory. Within a row, the entries keep the order of the SparseMatrix
+ * they were compressed from.
+ *
+ * The storage is shared: copies of a matrix are cheap handles to the same arrays, and matrices
+ * with identical contents (e.g. the transfer matrices of materials that share a cross-section
+ * set) are backed by a single copy of the arrays.
+ */
+class CompressedSparseMatrix
+{
+public:
+  /**Entry of a row, returned by value by the row iterators.*/
+  struct Entry
+  {
+    size_t row_index;
+    size_t column_index;
+    double value;
+  };
+
+  /**Range over the entries of a row.*/
+  class ConstRow
+  {
+  public:
+    class Iterator
+    {
+    public:
+      Iterator(size_t row, const uint32_t* column_index, const double* value)
+        : row_(row), column_index_(column_index), value_(value)
+      {
+      }
+
+      Iterator& operator++()
+      {
+        ++column_index_;
+        ++value_;
+        return *this;
+      }
+
+      Entry operator*() const { return {row_, *column_index_, *value_}; }
+
+      bool operator==(const Iterator& rhs) const { return value_ == rhs.value_; }
+      bool operator!=(const Iterator& rhs) const { return value_ != rhs.value_; }
+
+    private:
+      size_t row_;
+      const uint32_t* column_index_;
+      const double* value_;
+    };
+
+    ConstRow(size_t row, const uint32_t* column_indices, const double* values, size_t size)
+      : row_(row), column_indices_(column_indices), values_(values), size_(size)
+    {
+    }
+
+    Iterator begin() const { return {row_, column_indices_, values_}; }
+    Iterator end() const { return {row_, column_indices_ + size_, values_ + size_}; }
+
+  private:
+    size_t row_;
+    const uint32_t* column_indices_;
+    const double* values_;
+    size_t size_;
+  };
+
+  /**Creates an empty 0x0 matrix.*/
+  CompressedSparseMatrix();
+
+  /**Compresses a SparseMatrix.*/
+  explicit CompressedSparseMatrix(const SparseMatrix& matrix);
+
+  size_t NumRows() const { return storage_->num_rows; }
+  size_t NumCols() const { return storage_->num_cols; }
+
+  /**Returns the number of stored entries.*/
+  size_t NumNonZeros() const { return storage_->values.size(); }
+
+  /**Returns the number of stored entries in row `i`.*/
+  size_t RowSize(size_t i) const
+  {
+    return storage_->row_offsets[i + 1] - storage_->row_offsets[i];
+  }
+
+  /**Returns the column indices of row `i`.*/
+  const uint32_t* RowColumnIndices(size_t i) const
+  {
+    return storage_->column_indices.data() + storage_->row_offsets[i];
+  }
+
+  /**Returns the values of row `i`.*/
+  const double* RowValues(size_t i) const
+  {
+    return storage_->values.data() + storage_->row_offsets[i];
+  }
+
+  /**Returns the entries of row `i`.*/
+  ConstRow Row(size_t i) const { return {i, RowColumnIndices(i), RowValues(i), RowSize(i)}; }
+
+  /**Returns entry `(i, j)`, zero if it is not stored. Linear in the row size.*/
+  double ValueIJ(size_t i, size_t j) const;
+
+  /**Returns the transpose of the matrix.*/
+  CompressedSparseMatrix Transpose() const;
+
+  /**Returns the matrix with all values multiplied by `factor`.*/
+  CompressedSparseMatrix Scaled(double factor) const;
+
+  /**Returns true if both matrices are backed by the same arrays.*/
+  bool SharesStorageWith(const CompressedSparseMatrix& other) const
+  {
+    return storage_ == other.storage_;
+  }
+
+  /**Returns the number of bytes of the arrays backing the matrix.*/
+  size_t StorageSize() const;
+
+private:
+  struct Storage
+  {
+    size_t num_rows = 0;
+    size_t num_cols = 0;
+    std::vector<uint32_t> row_offsets;
+    std::vector<uint32_t> column_indices;
+    std::vector<double> values;
+
+    bool operator==(const Storage& other) const;
+  };
+
+  explicit CompressedSparseMatrix(Storage&& storage);
+
+  /**
+   * Returns storage with the contents of `storage`, reusing the arrays of an existing matrix with
+   * identical contents when there is one.
+   */
+  static std::shared_ptr<const Storage> Share(Storage&& storage);
+
+  std::shared_ptr<const Storage> storage_;
+};
+
+} // namespace opensn
@@ -6,6 +6,7 @@
 #include "framework/math/spatial_discretization/cell_mappings/finite_element/piecewise_linear/piecewise_linear_polygon_mapping.h"
 #include "framework/math/spatial_discretization/cell_mappings/finite_element/piecewise_linear/piecewise_linear_polyhedron_mapping.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/utils/thread_pool.h"
 
 namespace opensn
 {
@@ -22,7 +23,7 @@ PieceWiseLinearBase::PieceWiseLinearBase(const MeshContinuum& grid,
 }
 
 void
-PieceWiseLinearBase::CreateCellMappings()
+PieceWiseLinearBase::CreateCellMappings(unsigned int num_threads)
 {
   constexpr std::string_view fname = __PRETTY_FUNCTION__;
 
@@ -69,14 +70,21 @@ PieceWiseLinearBase::CreateCellMappings()
     return mapping;
   };
 
-  for (const auto& cell : ref_grid_.local_cells)
-    cell_mappings_.push_back(MakeCellMapping(cell));
+  // Mappings only read the grid and the quadratures, so cells can be mapped concurrently
+  const size_t num_local_cells = ref_grid_.local_cells.size();
+  cell_mappings_.clear();
+  cell_mappings_.resize(num_local_cells);
+  ParallelFor(num_local_cells,
+              num_threads,
+              [&](size_t c) { cell_mappings_[c] = MakeCellMapping(ref_grid_.local_cells[c]); });
 
   const auto ghost_ids = ref_grid_.cells.GetGhostGlobalIDs();
-  for (uint64_t ghost_id : ghost_ids)
-  {
-    auto ghost_mapping = MakeCellMapping(ref_grid_.cells[ghost_id]);
-    nb_cell_mappings_.insert(std::make_pair(ghost_id, std::move(ghost_mapping)));
-  }
+  std::vector<std::unique_ptr<CellMapping>> ghost_mappings(ghost_ids.size());
+  ParallelFor(ghost_ids.size(),
+              num_threads,
+              [&](size_t g)
+              { ghost_mappings[g] = MakeCellMapping(ref_grid_.cells[ghost_ids[g]]); });
+  for (size_t g = 0; g < ghost_ids.size(); ++g)
+    nb_cell_mappings_.insert(std::make_pair(ghost_ids[g], std::move(ghost_mappings[g])));
 }
 } // namespace opensn
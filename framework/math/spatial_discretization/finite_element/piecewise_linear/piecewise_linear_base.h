@@ -26,7 +26,8 @@ protected:
   TriangleQuadrature tri_quad_order_arbitrary_;
   TetrahedraQuadrature tet_quad_order_arbitrary_;
 
-  void CreateCellMappings();
+  /**Creates the mappings of the local and ghost cells on `num_threads` threads.*/
+  void CreateCellMappings(unsigned int num_threads = 1);
 };
 
 } // namespace opensn
@@ -14,10 +14,11 @@ namespace opensn
 
 PieceWiseLinearDiscontinuous::PieceWiseLinearDiscontinuous(const MeshContinuum& grid,
                                                            QuadratureOrder q_order,
-                                                           CoordinateSystemType cs_type)
+                                                           CoordinateSystemType cs_type,
+                                                           unsigned int num_threads)
   : PieceWiseLinearBase(grid, q_order, SDMType::PIECEWISE_LINEAR_DISCONTINUOUS, cs_type)
 {
-  CreateCellMappings();
+  CreateCellMappings(num_threads);
 
   OrderNodes();
 }
@@ -25,7 +26,8 @@ PieceWiseLinearDiscontinuous::PieceWiseLinearDiscontinuous(const MeshContinuum&
 std::shared_ptr<PieceWiseLinearDiscontinuous>
 PieceWiseLinearDiscontinuous::New(const MeshContinuum& grid,
                                   QuadratureOrder q_order,
-                                  CoordinateSystemType cs_type)
+                                  CoordinateSystemType cs_type,
+                                  unsigned int num_threads)
 
 {
   const auto PWLD = SpatialDiscretizationType::PIECEWISE_LINEAR_DISCONTINUOUS;
@@ -50,7 +52,7 @@ PieceWiseLinearDiscontinuous::New(const MeshContinuum& grid,
     }
 
   auto new_sdm = std::shared_ptr<PieceWiseLinearDiscontinuous>(
-    new PieceWiseLinearDiscontinuous(grid, q_order, cs_type));
+    new PieceWiseLinearDiscontinuous(grid, q_order, cs_type, num_threads));
 
   sdm_stack.push_back(new_sdm);
 
@@ -143,8 +145,7 @@ PieceWiseLinearDiscontinuous::OrderNodes()
 
     const size_t list_size = mapping_list.size();
     for (size_t k = 0; k < list_size; ++k)
-      neighbor_cell_block_address_.emplace_back(global_id_list[k],
-                                                static_cast<int64_t>(mapping_list[k]));
+      neighbor_cell_block_address_[global_id_list[k]] = static_cast<int64_t>(mapping_list[k]);
   }
 
   // Print info
@@ -263,6 +264,20 @@ PieceWiseLinearDiscontinuous::BuildSparsityPattern(std::vector<int64_t>& nodal_n
   opensn::mpi_comm.barrier();
 }
 
+int64_t
+PieceWiseLinearDiscontinuous::MapGhostCellBlockAddress(const Cell& cell) const
+{
+  const auto it = neighbor_cell_block_address_.find(cell.global_id_);
+  if (it == neighbor_cell_block_address_.end())
+  {
+    log.LogAllError() << "SpatialDiscretization_PWL::MapDFEMDOF. Mapping failed for cell "
+                      << "with global index " << cell.global_id_ << " and partition-ID "
+                      << cell.partition_id_;
+    Exit(EXIT_FAILURE);
+  }
+  return it->second;
+}
+
 int64_t
 PieceWiseLinearDiscontinuous::MapDOF(const Cell& cell,
                                      const unsigned int node,
@@ -270,134 +285,117 @@ PieceWiseLinearDiscontinuous::MapDOF(const Cell& cell,
                                      const unsigned int unknown_id,
                                      const unsigned int component) const
 {
-  auto storage = unknown_manager.dof_storage_type_;
+  int64_t base = 0, stride = 0;
+  if (not MapCellDOFBase(cell, unknown_manager, unknown_id, component, false, base, stride))
+    return -1;
+  return base + stride * node;
+}
+
+int64_t
+PieceWiseLinearDiscontinuous::MapDOFLocal(const Cell& cell,
+                                          const unsigned int node,
+                                          const UnknownManager& unknown_manager,
+                                          const unsigned int unknown_id,
+                                          const unsigned int component) const
+{
+  int64_t base = 0, stride = 0;
+  if (not MapCellDOFBase(cell, unknown_manager, unknown_id, component, true, base, stride))
+    return -1;
+  return base + stride * node;
+}
 
-  size_t num_unknowns = unknown_manager.GetTotalUnknownStructureSize();
-  size_t block_id = unknown_manager.MapUnknown(unknown_id, component);
+void
+PieceWiseLinearDiscontinuous::MapDOFs(const Cell& cell,
+                                      const UnknownManager& unknown_manager,
+                                      const unsigned int unknown_id,
+                                      const unsigned int component,
+                                      std::vector<int64_t>& dofs) const
+{
+  const size_t num_nodes = GetCellNumNodes(cell);
+  dofs.resize(num_nodes);
 
-  if (cell.partition_id_ == opensn::mpi_comm.rank())
+  int64_t base = 0, stride = 0;
+  if (not MapCellDOFBase(cell, unknown_manager, unknown_id, component, false, base, stride))
   {
-    if (storage == UnknownStorageType::BLOCK)
-    {
-      int64_t address = static_cast<int64_t>(local_block_address_ * num_unknowns) +
-                        cell_local_block_address_[cell.local_id_] +
-                        local_base_block_size_ * block_id + node;
-      return address;
-    }
-    else if (storage == UnknownStorageType::NODAL)
-    {
-      int64_t address = static_cast<int64_t>(local_block_address_ * num_unknowns) +
-                        cell_local_block_address_[cell.local_id_] * num_unknowns +
-                        node * num_unknowns + block_id;
-      return address;
-    }
+    dofs.assign(num_nodes, -1);
+    return;
   }
-  else
-  {
-    int index = 0;
-    bool found = false;
-    for (auto neighbor_info : neighbor_cell_block_address_)
-    {
-      if (neighbor_info.first == cell.global_id_)
-      {
-        found = true;
-        break;
-      }
-      ++index;
-    }
+  for (size_t i = 0; i < num_nodes; ++i)
+    dofs[i] = base + stride * static_cast<int64_t>(i);
+}
 
-    if (not found)
-    {
-      log.LogAllError() << "SpatialDiscretization_PWL::MapDFEMDOF. Mapping failed for cell "
-                        << "with global index " << cell.global_id_ << " and partition-ID "
-                        << cell.partition_id_;
-      Exit(EXIT_FAILURE);
-    }
+void
+PieceWiseLinearDiscontinuous::MapDOFsLocal(const Cell& cell,
+                                           const UnknownManager& unknown_manager,
+                                           const unsigned int unknown_id,
+                                           const unsigned int component,
+                                           std::vector<int64_t>& dofs) const
+{
+  const size_t num_nodes = GetCellNumNodes(cell);
+  dofs.resize(num_nodes);
 
-    if (storage == UnknownStorageType::BLOCK)
-    {
-      int64_t address = static_cast<int64_t>(neighbor_cell_block_address_[index].second) +
-                        locJ_block_size_[cell.partition_id_] * block_id + node;
-      return address;
-    }
-    else if (storage == UnknownStorageType::NODAL)
-    {
-      int64_t address =
-        static_cast<int64_t>(neighbor_cell_block_address_[index].second * num_unknowns) +
-        node * num_unknowns + block_id;
-      return address;
-    }
+  int64_t base = 0, stride = 0;
+  if (not MapCellDOFBase(cell, unknown_manager, unknown_id, component, true, base, stride))
+  {
+    dofs.assign(num_nodes, -1);
+    return;
   }
-
-  return -1;
+  for (size_t i = 0; i < num_nodes; ++i)
+    dofs[i] = base + stride * static_cast<int64_t>(i);
 }
 
-int64_t
-PieceWiseLinearDiscontinuous::MapDOFLocal(const Cell& cell,
-                                          const unsigned int node,
-                                          const UnknownManager& unknown_manager,
-                                          const unsigned int unknown_id,
-                                          const unsigned int component) const
+bool
+PieceWiseLinearDiscontinuous::MapCellDOFBase(const Cell& cell,
+                                             const UnknownManager& unknown_manager,
+                                             const unsigned int unknown_id,
+                                             const unsigned int component,
+                                             const bool local,
+                                             int64_t& base,
+                                             int64_t& stride) const
 {
-  auto storage = unknown_manager.dof_storage_type_;
+  const auto storage = unknown_manager.dof_storage_type_;
 
-  size_t num_unknowns = unknown_manager.GetTotalUnknownStructureSize();
-  size_t block_id = unknown_manager.MapUnknown(unknown_id, component);
+  const auto num_unknowns = static_cast<int64_t>(unknown_manager.GetTotalUnknownStructureSize());
+  const auto block_id = static_cast<int64_t>(unknown_manager.MapUnknown(unknown_id, component));
 
   if (cell.partition_id_ == opensn::mpi_comm.rank())
   {
+    const auto cell_block_address = cell_local_block_address_[cell.local_id_];
+    const int64_t offset = local ? 0 : static_cast<int64_t>(local_block_address_) * num_unknowns;
+
     if (storage == UnknownStorageType::BLOCK)
     {
-      int64_t address = static_cast<int64_t>(cell_local_block_address_[cell.local_id_]) +
-                        local_base_block_size_ * block_id + node;
-      return address;
+      base = offset + cell_block_address + static_cast<int64_t>(local_base_block_size_) * block_id;
+      stride = 1;
+      return true;
     }
     else if (storage == UnknownStorageType::NODAL)
     {
-      int64_t address =
-        static_cast<int64_t>(cell_local_block_address_[cell.local_id_] * num_unknowns) +
-        node * num_unknowns + block_id;
-      return address;
+      base = offset + cell_block_address * num_unknowns + block_id;
+      stride = num_unknowns;
+      return true;
     }
   }
   else
   {
-    int index = 0;
-    bool found = false;
-    for (auto neighbor_info : neighbor_cell_block_address_)
-    {
-      if (neighbor_info.first == cell.global_id_)
-      {
-        found = true;
-        break;
-      }
-      ++index;
-    }
-
-    if (not found)
-    {
-      log.LogAllError() << "SpatialDiscretization_PWL::MapDFEMDOF. Mapping failed for cell "
-                        << "with global index " << cell.global_id_ << " and partition-ID "
-                        << cell.partition_id_;
-      Exit(EXIT_FAILURE);
-    }
+    const int64_t cell_block_address = MapGhostCellBlockAddress(cell);
 
     if (storage == UnknownStorageType::BLOCK)
     {
-      int64_t address = static_cast<int64_t>(neighbor_cell_block_address_[index].second) +
-                        locJ_block_size_[cell.partition_id_] * block_id + node;
-      return address;
+      base = cell_block_address +
+             static_cast<int64_t>(locJ_block_size_[cell.partition_id_]) * block_id;
+      stride = 1;
+      return true;
     }
     else if (storage == UnknownStorageType::NODAL)
     {
-      int64_t address =
-        static_cast<int64_t>(neighbor_cell_block_address_[index].second * num_unknowns) +
-        node * num_unknowns + block_id;
-      return address;
+      base = cell_block_address * num_unknowns + block_id;
+      stride = num_unknowns;
+      return true;
     }
   }
 
-  return -1;
+  return false;
 }
 
 size_t
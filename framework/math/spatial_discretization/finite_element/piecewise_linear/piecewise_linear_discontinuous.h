@@ -5,6 +5,7 @@
 
 #include "framework/math/spatial_discretization/finite_element/piecewise_linear/piecewise_linear_base.h"
 #include "framework/math/spatial_discretization/cell_mappings/finite_element/piecewise_linear/piecewise_linear_base_mapping.h"
+#include <unordered_map>
 
 namespace opensn
 {
@@ -18,12 +19,15 @@ class PieceWiseLinearDiscontinuous : public PieceWiseLinearBase
 {
 public:
   /**
-   * Construct a shared object using the protected constructor.
+   * Construct a shared object using the protected constructor. The cell mappings of a new
+   * discretization are created on `num_threads` threads. An existing discretization of the same
+   * grid, quadrature order and coordinate system is returned as is.
    */
   static std::shared_ptr<PieceWiseLinearDiscontinuous>
   New(const MeshContinuum& grid,
       QuadratureOrder q_order = QuadratureOrder::SECOND,
-      CoordinateSystemType cs_type = CoordinateSystemType::CARTESIAN);
+      CoordinateSystemType cs_type = CoordinateSystemType::CARTESIAN,
+      unsigned int num_threads = 1);
 
   void BuildSparsityPattern(std::vector<int64_t>& nodal_nnz_in_diag,
                             std::vector<int64_t>& nodal_nnz_off_diag,
@@ -51,6 +55,18 @@ public:
     return MapDOFLocal(cell, node, UNITARY_UNKNOWN_MANAGER, 0, 0);
   }
 
+  void MapDOFs(const Cell& cell,
+               const UnknownManager& unknown_manager,
+               unsigned int unknown_id,
+               unsigned int component,
+               std::vector<int64_t>& dofs) const override;
+
+  void MapDOFsLocal(const Cell& cell,
+                    const UnknownManager& unknown_manager,
+                    unsigned int unknown_id,
+                    unsigned int component,
+                    std::vector<int64_t>& dofs) const override;
+
   size_t GetNumGhostDOFs(const UnknownManager& unknown_manager) const override;
 
   std::vector<int64_t> GetGhostDOFIndices(const UnknownManager& unknown_manager) const override;
@@ -62,12 +78,33 @@ protected:
   void OrderNodes();
 
   std::vector<int64_t> cell_local_block_address_;
-  std::vector<std::pair<uint64_t, int64_t>> neighbor_cell_block_address_;
+  /** Maps ghost cell global ids to the global block address of the cell on its owning partition. */
+  std::unordered_map<uint64_t, int64_t> neighbor_cell_block_address_;
 
 private:
+  /**
+   * Returns the global block address of a ghost cell. Exits if the cell is not a ghost of this
+   * partition.
+   */
+  int64_t MapGhostCellBlockAddress(const Cell& cell) const;
+
+  /**
+   * Computes the address of node 0 of `cell` for the given unknown component, together with the
+   * stride between consecutive cell nodes, such that node `i` maps to `base + stride * i`.
+   * Returns false if the unknown manager's storage type is not supported.
+   */
+  bool MapCellDOFBase(const Cell& cell,
+                      const UnknownManager& unknown_manager,
+                      unsigned int unknown_id,
+                      unsigned int component,
+                      bool local,
+                      int64_t& base,
+                      int64_t& stride) const;
+
   explicit PieceWiseLinearDiscontinuous(const MeshContinuum& grid,
                                         QuadratureOrder q_order,
-                                        CoordinateSystemType cs_type);
+                                        CoordinateSystemType cs_type,
+                                        unsigned int num_threads);
 };
 
 } // namespace opensn
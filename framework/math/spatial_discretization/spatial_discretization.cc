@@ -57,6 +57,32 @@ SpatialDiscretization::GetCoordinateSystemType() const
   return coord_sys_type_;
 }
 
+void
+SpatialDiscretization::MapDOFs(const Cell& cell,
+                               const UnknownManager& unknown_manager,
+                               unsigned int unknown_id,
+                               unsigned int component,
+                               std::vector<int64_t>& dofs) const
+{
+  const size_t num_nodes = GetCellNumNodes(cell);
+  dofs.resize(num_nodes);
+  for (size_t i = 0; i < num_nodes; ++i)
+    dofs[i] = MapDOF(cell, i, unknown_manager, unknown_id, component);
+}
+
+void
+SpatialDiscretization::MapDOFsLocal(const Cell& cell,
+                                    const UnknownManager& unknown_manager,
+                                    unsigned int unknown_id,
+                                    unsigned int component,
+                                    std::vector<int64_t>& dofs) const
+{
+  const size_t num_nodes = GetCellNumNodes(cell);
+  dofs.resize(num_nodes);
+  for (size_t i = 0; i < num_nodes; ++i)
+    dofs[i] = MapDOFLocal(cell, i, unknown_manager, unknown_id, component);
+}
+
 size_t
 SpatialDiscretization::GetNumLocalDOFs(const UnknownManager& unknown_manager) const
 {
@@ -70,6 +70,24 @@ public:
    * here is a single scalar unknown.*/
   virtual int64_t MapDOFLocal(const Cell& cell, unsigned int node) const = 0;
 
+  /**Maps the global addresses of all the nodes of a cell for a single
+   * unknown component. On return `dofs[i]` holds the address of node `i`.
+   * The vector is resized to the number of cell nodes so that callers can
+   * reuse it across cells without reallocating.*/
+  virtual void MapDOFs(const Cell& cell,
+                       const UnknownManager& unknown_manager,
+                       unsigned int unknown_id,
+                       unsigned int component,
+                       std::vector<int64_t>& dofs) const;
+
+  /**Maps the local addresses of all the nodes of a cell for a single
+   * unknown component. See MapDOFs.*/
+  virtual void MapDOFsLocal(const Cell& cell,
+                            const UnknownManager& unknown_manager,
+                            unsigned int unknown_id,
+                            unsigned int component,
+                            std::vector<int64_t>& dofs) const;
+
   // 05 Utils
   /**For the unknown structure in the unknown manager, returns the
    * number of local degrees-of-freedom.*/
@@ -4,11 +4,17 @@
 #pragma once
 
 #include "framework/mesh/logical_volume/logical_volume.h"
+#include "framework/mesh/surface_mesh/triangle_bvh.h"
 
 namespace opensn
 {
 
-/**SurfaceMesh volume*/
+/**
+ * SurfaceMesh volume. The interior of a closed surface mesh, determined by the parity of the
+ * number of surface crossings of a ray cast from the query point. The triangles are organized in
+ * a bounding-volume hierarchy on construction, so that a query only visits the triangles near the
+ * ray.
+ */
 class SurfaceMeshLogicalVolume : public LogicalVolume
 {
 public:
@@ -22,6 +28,7 @@ private:
   std::array<double, 2> xbounds_;
   std::array<double, 2> ybounds_;
   std::array<double, 2> zbounds_;
+  TriangleBVH bvh_;
 };
 
 } // namespace opensn
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: MIT
 
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum_spatial_index.h"
 #include "framework/mesh/mesh_continuum/grid_face_histogram.h"
 #include "framework/mesh/mesh_continuum/grid_vtk_utils.h"
 #include "framework/mesh/logical_volume/logical_volume.h"
@@ -1093,6 +1094,33 @@ MeshContinuum::MakeBoundaryID(const std::string& boundary_name) const
   return max_id + 1;
 }
 
+const CellSpatialIndex&
+MeshContinuum::GetSpatialIndex() const
+{
+  if (spatial_index_ == nullptr)
+    spatial_index_ = std::make_shared<CellSpatialIndex>(*this);
+  return *spatial_index_;
+}
+
+std::vector<uint64_t>
+MeshContinuum::FindCellsContainingPoint(const Vector3& point, bool include_ghosts) const
+{
+  std::vector<uint64_t> global_ids;
+  for (const auto* cell : GetSpatialIndex().CellsNearPoint(point, include_ghosts))
+    if (CheckPointInsideCell(*cell, point))
+      global_ids.push_back(cell->global_id_);
+  return global_ids;
+}
+
+std::vector<uint64_t>
+MeshContinuum::FindCellsNearPoint(const Vector3& point, bool include_ghosts) const
+{
+  std::vector<uint64_t> global_ids;
+  for (const auto* cell : GetSpatialIndex().CellsNearPoint(point, include_ghosts))
+    global_ids.push_back(cell->global_id_);
+  return global_ids;
+}
+
 std::pair<Vector3, Vector3>
 MeshContinuum::GetLocalBoundingBox() const
 {
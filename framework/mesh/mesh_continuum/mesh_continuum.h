@@ -18,6 +18,7 @@ class NDArray;
 class MPICommunicatorSet;
 class GridFaceHistogram;
 class MeshGenerator;
+class CellSpatialIndex;
 
 /**
  * Stores the relevant information for completely defining a computationaldomain.
@@ -33,6 +34,12 @@ private:
 
   uint64_t global_vertex_count_ = 0;
 
+  /**
+   * Point location index, built on first use. Adding cells or vertices through the handlers
+   * discards it.
+   */
+  mutable std::shared_ptr<CellSpatialIndex> spatial_index_ = nullptr;
+
 public:
   VertexHandler vertices;
   LocalCellHandler local_cells;
@@ -52,11 +59,13 @@ private:
 
 public:
   MeshContinuum()
-    : local_cells(local_cells_),
+    : vertices(spatial_index_),
+      local_cells(local_cells_),
       cells(local_cells_,
             ghost_cells_,
             global_cell_id_to_local_id_map_,
-            global_cell_id_to_nonlocal_id_map_)
+            global_cell_id_to_nonlocal_id_map_,
+            spatial_index_)
   {
   }
 
@@ -85,6 +94,7 @@ public:
     global_cell_id_to_local_id_map_.clear();
     global_cell_id_to_nonlocal_id_map_.clear();
     vertices.Clear();
+    spatial_index_ = nullptr;
   }
 
   /**Export cells to python.
@@ -191,6 +201,28 @@ public:
    */
   bool CheckPointInsideCell(const Cell& cell, const Vector3& point) const;
 
+  /**
+   * Returns the global ids of the cells that contain the point according to
+   * CheckPointInsideCell. Candidates are looked up in a spatial index that is built on first
+   * use, so a query does not visit every cell. Local cells are returned in local-id order,
+   * followed by ghost cells if requested.
+   */
+  std::vector<uint64_t> FindCellsContainingPoint(const Vector3& point,
+                                                 bool include_ghosts = false) const;
+
+  /**
+   * Returns the global ids of the cells whose bounding boxes contain the point. This is a superset
+   * of FindCellsContainingPoint for callers that apply their own inside test.
+   */
+  std::vector<uint64_t> FindCellsNearPoint(const Vector3& point, bool include_ghosts = false) const;
+
+  /**
+   * Discards the spatial index used by the point queries, so that the next query rebuilds it.
+   * Adding cells or vertices through `cells` and `vertices` calls this automatically; code that
+   * moves vertices in place must call it explicitly.
+   */
+  void InvalidateSpatialIndex() const { spatial_index_ = nullptr; }
+
   MeshAttributes Attributes() const { return attributes; }
 
   /**
@@ -229,6 +261,9 @@ public:
                                 const std::string& boundary_name);
 
 private:
+  /**Returns the spatial index, (re)building it if it is missing or out of date.*/
+  const CellSpatialIndex& GetSpatialIndex() const;
+
   friend class VolumeMesher;
   friend class MeshGenerator;
   void SetAttributes(MeshAttributes new_attribs, std::array<size_t, 3> ortho_Nis = {0, 0, 0})
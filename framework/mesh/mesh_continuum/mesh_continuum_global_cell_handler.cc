@@ -12,6 +12,8 @@ namespace opensn
 void
 GlobalCellHandler::push_back(std::unique_ptr<Cell> new_cell)
 {
+  spatial_index_ref_ = nullptr;
+
   if (new_cell->partition_id_ == static_cast<uint64_t>(opensn::mpi_comm.rank()))
   {
     new_cell->local_id_ = local_cells_ref_.size();
@@ -6,9 +6,11 @@
 #include "framework/mesh/cell/cell.h"
 
 #include <map>
+#include <memory>
 
 namespace opensn
 {
+class CellSpatialIndex;
 
 /**Handles all global index queries.*/
 class GlobalCellHandler
@@ -22,20 +24,24 @@ private:
   std::map<uint64_t, uint64_t>& global_cell_id_to_native_id_map;
   std::map<uint64_t, uint64_t>& global_cell_id_to_foreign_id_map;
 
+  std::shared_ptr<CellSpatialIndex>& spatial_index_ref_;
+
 private:
   explicit GlobalCellHandler(std::vector<std::unique_ptr<Cell>>& native_cells,
                              std::vector<std::unique_ptr<Cell>>& foreign_cells,
                              std::map<uint64_t, uint64_t>& global_cell_id_to_native_id_map,
-                             std::map<uint64_t, uint64_t>& global_cell_id_to_foreign_id_map)
+                             std::map<uint64_t, uint64_t>& global_cell_id_to_foreign_id_map,
+                             std::shared_ptr<CellSpatialIndex>& spatial_index)
     : local_cells_ref_(native_cells),
       ghost_cells_ref_(foreign_cells),
       global_cell_id_to_native_id_map(global_cell_id_to_native_id_map),
-      global_cell_id_to_foreign_id_map(global_cell_id_to_foreign_id_map)
+      global_cell_id_to_foreign_id_map(global_cell_id_to_foreign_id_map),
+      spatial_index_ref_(spatial_index)
   {
   }
 
 public:
-  /**Adds a new cell to grid registry.*/
+  /**Adds a new cell to grid registry and invalidates the grid's spatial index.*/
   void push_back(std::unique_ptr<Cell> new_cell);
   /**Returns a reference to a cell given its global cell index.*/
   Cell& operator[](uint64_t cell_global_index);
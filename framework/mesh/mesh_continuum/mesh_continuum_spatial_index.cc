@@ -0,0 +1,188 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "framework/mesh/mesh_continuum/mesh_continuum_spatial_index.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace opensn
+{
+
+CellSpatialIndex::CellSpatialIndex(const MeshContinuum& grid)
+{
+  // Collect the cells, local ones first
+  for (const auto& cell : grid.local_cells)
+    cells_.push_back(&cell);
+  num_local_cells_ = cells_.size();
+  for (uint64_t global_id : grid.cells.GetGhostGlobalIDs())
+    cells_.push_back(&grid.cells[global_id]);
+
+  // Cell and domain bounding boxes
+  constexpr double inf = std::numeric_limits<double>::max();
+  domain_ = {{inf, inf, inf}, {-inf, -inf, -inf}};
+  cell_boxes_.reserve(cells_.size());
+  for (const auto* cell : cells_)
+  {
+    Box box = {{inf, inf, inf}, {-inf, -inf, -inf}};
+    for (uint64_t vid : cell->vertex_ids_)
+    {
+      const auto& v = grid.vertices[vid];
+      for (int d = 0; d < 3; ++d)
+      {
+        box.lo[d] = std::min(box.lo[d], v[d]);
+        box.hi[d] = std::max(box.hi[d], v[d]);
+      }
+    }
+    for (int d = 0; d < 3; ++d)
+    {
+      domain_.lo[d] = std::min(domain_.lo[d], box.lo[d]);
+      domain_.hi[d] = std::max(domain_.hi[d], box.hi[d]);
+    }
+    cell_boxes_.push_back(box);
+  }
+
+  if (cells_.empty())
+  {
+    bin_offsets_.assign(2, 0);
+    return;
+  }
+
+  // Pad the boxes slightly so that points on cell faces are not lost to round-off
+  double diagonal = 0.0;
+  for (int d = 0; d < 3; ++d)
+    diagonal += (domain_.hi[d] - domain_.lo[d]) * (domain_.hi[d] - domain_.lo[d]);
+  diagonal = std::sqrt(diagonal);
+  const double tolerance = 1.0e-10 * std::max(diagonal, 1.0);
+  for (auto& box : cell_boxes_)
+    for (int d = 0; d < 3; ++d)
+    {
+      box.lo[d] -= tolerance;
+      box.hi[d] += tolerance;
+    }
+  for (int d = 0; d < 3; ++d)
+  {
+    domain_.lo[d] -= tolerance;
+    domain_.hi[d] += tolerance;
+  }
+
+  // Size the bins so that there are about as many bins as cells, with bins of roughly equal width
+  // in each dimension the mesh extends in.
+  int num_active = 0;
+  double active_volume = 1.0;
+  for (int d = 0; d < 3; ++d)
+  {
+    const double extent = domain_.hi[d] - domain_.lo[d];
+    active_[d] = extent > 4.0 * tolerance;
+    if (active_[d])
+    {
+      ++num_active;
+      active_volume *= extent;
+    }
+  }
+
+  // A dimension much thinner than the bin width still gets one bin, which leaves the others with
+  // more bins than intended. The width is therefore grown until the total number of bins is
+  // within twice the target; a width spanning the whole domain always satisfies this.
+  const double target_num_bins = static_cast<double>(std::min<size_t>(cells_.size(), 1 << 24));
+  const double max_num_bins = 2.0 * target_num_bins;
+  double width = num_active > 0 ? std::pow(active_volume / target_num_bins, 1.0 / num_active) : 1.0;
+  while (true)
+  {
+    double total_num_bins = 1.0;
+    for (int d = 0; d < 3; ++d)
+    {
+      const double extent = domain_.hi[d] - domain_.lo[d];
+      num_bins_[d] = 1;
+      if (active_[d])
+        num_bins_[d] = static_cast<int>(
+          std::clamp(std::ceil(extent / width), 1.0, std::max(target_num_bins, 1.0)));
+      bin_width_[d] = active_[d] ? extent / num_bins_[d] : 1.0;
+      total_num_bins *= num_bins_[d];
+    }
+    if (total_num_bins <= max_num_bins)
+      break;
+    width *= 1.25;
+  }
+
+  // Fill the compressed bin-to-cell map with a counting pass followed by an insertion pass
+  const size_t num_bins = static_cast<size_t>(num_bins_[0]) * num_bins_[1] * num_bins_[2];
+  bin_offsets_.assign(num_bins + 1, 0);
+  auto ForEachBinOfBox = [this](const Box& box, auto&& function)
+  {
+    std::array<int, 3> lo{}, hi{};
+    for (int d = 0; d < 3; ++d)
+    {
+      lo[d] = BinIndex(d, box.lo[d]);
+      hi[d] = BinIndex(d, box.hi[d]);
+    }
+    std::array<int, 3> ijk{};
+    for (ijk[2] = lo[2]; ijk[2] <= hi[2]; ++ijk[2])
+      for (ijk[1] = lo[1]; ijk[1] <= hi[1]; ++ijk[1])
+        for (ijk[0] = lo[0]; ijk[0] <= hi[0]; ++ijk[0])
+          function(FlatBinIndex(ijk));
+  };
+
+  for (const auto& box : cell_boxes_)
+    ForEachBinOfBox(box, [this](size_t b) { ++bin_offsets_[b + 1]; });
+  for (size_t b = 0; b < num_bins; ++b)
+    bin_offsets_[b + 1] += bin_offsets_[b];
+
+  bin_cells_.resize(bin_offsets_.back());
+  std::vector<size_t> fill(bin_offsets_.begin(), bin_offsets_.end() - 1);
+  for (size_t c = 0; c < cell_boxes_.size(); ++c)
+    ForEachBinOfBox(cell_boxes_[c], [this, &fill, c](size_t b) { bin_cells_[fill[b]++] = c; });
+}
+
+int
+CellSpatialIndex::BinIndex(int d, double x) const
+{
+  if (not active_[d])
+    return 0;
+  const int i = static_cast<int>(std::floor((x - domain_.lo[d]) / bin_width_[d]));
+  return std::clamp(i, 0, num_bins_[d] - 1);
+}
+
+bool
+CellSpatialIndex::BoxContains(const Box& box, const Point& p) const
+{
+  for (int d = 0; d < 3; ++d)
+    if (active_[d] and (p[d] < box.lo[d] or p[d] > box.hi[d]))
+      return false;
+  return true;
+}
+
+std::vector<const Cell*>
+CellSpatialIndex::GatherCells(std::vector<size_t>& cell_indices, bool include_ghosts) const
+{
+  std::sort(cell_indices.begin(), cell_indices.end());
+  cell_indices.erase(std::unique(cell_indices.begin(), cell_indices.end()), cell_indices.end());
+
+  std::vector<const Cell*> result;
+  result.reserve(cell_indices.size());
+  for (size_t c : cell_indices)
+    if (include_ghosts or c < num_local_cells_)
+      result.push_back(cells_[c]);
+  return result;
+}
+
+std::vector<const Cell*>
+CellSpatialIndex::CellsNearPoint(const Vector3& point, bool include_ghosts) const
+{
+  const Point p = {point.x, point.y, point.z};
+  if (cells_.empty() or not BoxContains(domain_, p))
+    return {};
+
+  const std::array<int, 3> ijk = {BinIndex(0, p[0]), BinIndex(1, p[1]), BinIndex(2, p[2])};
+  const size_t b = FlatBinIndex(ijk);
+
+  std::vector<size_t> cell_indices;
+  for (size_t k = bin_offsets_[b]; k < bin_offsets_[b + 1]; ++k)
+    if (BoxContains(cell_boxes_[bin_cells_[k]], p))
+      cell_indices.push_back(bin_cells_[k]);
+
+  return GatherCells(cell_indices, include_ghosts);
+}
+
+} // namespace opensn
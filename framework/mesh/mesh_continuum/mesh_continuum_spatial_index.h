@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "framework/mesh/mesh_vector.h"
+
+#include <array>
+#include <vector>
+
+namespace opensn
+{
+class Cell;
+class MeshContinuum;
+
+/**
+ * Uniform-grid index over the axis-aligned bounding boxes of the local and ghost cells of a
+ * MeshContinuum. Each bin stores the cells whose bounding boxes overlap it, so a point query
+ * only has to look at the cells in the bin it falls in. Dimensions in which the mesh has no extent
+ * (e.g. z for 2D meshes) are not binned and never used to reject a query.
+ */
+class CellSpatialIndex
+{
+public:
+  explicit CellSpatialIndex(const MeshContinuum& grid);
+
+  /**Returns the number of local plus ghost cells that were indexed.*/
+  size_t NumIndexedCells() const { return cells_.size(); }
+
+  /**
+   * Returns the cells whose bounding boxes contain the point. Local cells come first, in local-id
+   * order, followed by ghost cells.
+   */
+  std::vector<const Cell*> CellsNearPoint(const Vector3& point, bool include_ghosts) const;
+
+private:
+  typedef std::array<double, 3> Point;
+  struct Box
+  {
+    Point lo;
+    Point hi;
+  };
+
+  /**Bin index along dimension d, clamped to the valid range.*/
+  int BinIndex(int d, double x) const;
+  size_t FlatBinIndex(const std::array<int, 3>& ijk) const
+  {
+    return (static_cast<size_t>(ijk[2]) * num_bins_[1] + ijk[1]) * num_bins_[0] + ijk[0];
+  }
+  bool BoxContains(const Box& box, const Point& p) const;
+
+  /**Converts sorted, unique cell indices into the cell list returned by the queries.*/
+  std::vector<const Cell*> GatherCells(std::vector<size_t>& cell_indices,
+                                       bool include_ghosts) const;
+
+  /**Local cells (in local-id order) followed by ghost cells.*/
+  std::vector<const Cell*> cells_;
+  size_t num_local_cells_ = 0;
+  std::vector<Box> cell_boxes_;
+
+  Box domain_;
+  std::array<bool, 3> active_ = {false, false, false};
+  std::array<int, 3> num_bins_ = {1, 1, 1};
+  std::array<double, 3> bin_width_ = {1.0, 1.0, 1.0};
+
+  /**Compressed bin-to-cell map. The cells of bin b are bin_cells_[bin_offsets_[b]...].*/
+  std::vector<size_t> bin_offsets_;
+  std::vector<size_t> bin_cells_;
+};
+
+} // namespace opensn
@@ -6,19 +6,31 @@
 #include "framework/mesh/mesh_vector.h"
 
 #include <map>
+#include <memory>
 
 namespace opensn
 {
+class CellSpatialIndex;
 
-/**Manages a vertex map with custom calls.*/
+/**
+ * Manages a vertex map with custom calls. Inserting or clearing vertices invalidates the spatial
+ * index of the owning grid. Vertices moved through the non-const accessor are not detected, so
+ * MeshContinuum::InvalidateSpatialIndex must be called afterwards.
+ */
 class VertexHandler
 {
   typedef std::map<uint64_t, Vector3> GlobalIDMap;
 
 private:
   std::map<uint64_t, Vector3> m_global_id_vertex_map;
+  std::shared_ptr<CellSpatialIndex>& spatial_index_ref_;
 
 public:
+  explicit VertexHandler(std::shared_ptr<CellSpatialIndex>& spatial_index)
+    : spatial_index_ref_(spatial_index)
+  {
+  }
+
   // Iterators
   GlobalIDMap::iterator begin() { return m_global_id_vertex_map.begin(); }
   GlobalIDMap::iterator end() { return m_global_id_vertex_map.end(); }
@@ -38,11 +50,16 @@ public:
   void Insert(const uint64_t global_id, const Vector3& vec)
   {
     m_global_id_vertex_map.insert(std::make_pair(global_id, vec));
+    spatial_index_ref_ = nullptr;
   }
 
   size_t NumLocallyStored() const { return m_global_id_vertex_map.size(); }
 
-  void Clear() { m_global_id_vertex_map.clear(); }
+  void Clear()
+  {
+    m_global_id_vertex_map.clear();
+    spatial_index_ref_ = nullptr;
+  }
 };
 
 } // namespace opensn
@@ -0,0 +1,180 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "framework/mesh/mesh_generator/distributed_mesh_generator.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/data_types/byte_array.h"
+#include "framework/logging/log.h"
+#include "framework/utils/timer.h"
+#include "framework/object_factory.h"
+#include "framework/runtime.h"
+#include <algorithm>
+
+namespace opensn
+{
+
+OpenSnRegisterObjectInNamespace(mesh, DistributedMeshGenerator);
+
+InputParameters
+DistributedMeshGenerator::GetInputParameters()
+{
+  InputParameters params = MeshGenerator::GetInputParameters();
+
+  params.SetGeneralDescription(
+    "Generates and partitions the mesh only on location 0 and then sends each location only the "
+    "cells and vertices it needs.");
+  params.SetDocGroup("doc_MeshGenerators");
+
+  params.AddOptionalParameter(
+    "verbosity_level",
+    1,
+    "Verbosity level. 1 will report each 10% complete. 2 will print each part "
+    "and the number of local cells it was sent.");
+
+  return params;
+}
+
+DistributedMeshGenerator::DistributedMeshGenerator(const InputParameters& params)
+  : MeshGenerator(params), verbosity_level_(params.GetParamValue<int>("verbosity_level"))
+{
+}
+
+void
+DistributedMeshGenerator::Execute()
+{
+  const int rank = opensn::mpi_comm.rank();
+  const int num_parts = opensn::mpi_comm.size();
+  const int tag = 0;
+
+  // Only the home location generates and partitions the mesh. Its outcome is broadcast before any
+  // part is sent, so that a failure raises an error on all locations instead of leaving the others
+  // waiting for their parts.
+  std::unique_ptr<UnpartitionedMesh> current_umesh = nullptr;
+  std::vector<int64_t> cell_pids;
+  std::vector<std::vector<uint64_t>> part_cells;
+  std::vector<size_t> partI_num_cells(num_parts, 0);
+  std::string error;
+  if (rank == 0)
+  {
+    try
+    {
+      // Execute all input generators
+      // Note these could be empty
+      for (auto mesh_generator_ptr : inputs_)
+      {
+        auto new_umesh = mesh_generator_ptr->GenerateUnpartitionedMesh(std::move(current_umesh));
+        current_umesh = std::move(new_umesh);
+      }
+
+      // Generate final umesh
+      current_umesh = GenerateUnpartitionedMesh(std::move(current_umesh));
+
+      cell_pids = PartitionMesh(*current_umesh, num_parts);
+      part_cells = MakePartitionCellLists(*current_umesh, cell_pids, num_parts);
+
+      for (int64_t pid : cell_pids)
+        partI_num_cells[pid] += 1;
+      const auto [min_num_cells, max_num_cells] =
+        std::minmax_element(partI_num_cells.begin(), partI_num_cells.end());
+      log.Log() << "Number of cells per partition (max,min,avg) = " << *max_num_cells << ","
+                << *min_num_cells << "," << cell_pids.size() / num_parts;
+      if (*min_num_cells == 0)
+        error = "Partitioning failed. At least one partition contains no cells.";
+    }
+    catch (const std::exception& e)
+    {
+      error = e.what();
+    }
+  }
+
+  bool home_succeeded = error.empty();
+  mpi_comm.broadcast(home_succeeded, 0);
+  OpenSnLogicalErrorIf(not error.empty(), error);
+  OpenSnLogicalErrorIf(not home_succeeded, "Mesh generation failed on location 0.");
+
+  ByteArray local_data;
+  if (rank == 0)
+  {
+    const auto& raw_cells = current_umesh->GetRawCells();
+
+    // Send each location its part. Only one serialized part exists at a time.
+    uint64_t aux_counter = 0;
+    for (int pid = 0; pid < num_parts; ++pid)
+    {
+      if (verbosity_level_ >= 2)
+        log.Log() << "Sending part " << pid << " num_local_cells=" << partI_num_cells[pid];
+
+      std::vector<uint64_t> vertices_needed;
+      for (uint64_t cell_global_id : part_cells[pid])
+        for (uint64_t vid : raw_cells[cell_global_id]->vertex_ids)
+          vertices_needed.push_back(vid);
+      std::sort(vertices_needed.begin(), vertices_needed.end());
+      vertices_needed.erase(std::unique(vertices_needed.begin(), vertices_needed.end()),
+                            vertices_needed.end());
+
+      auto serial_data =
+        SerializePartition(*current_umesh, cell_pids, part_cells[pid], vertices_needed);
+      if (pid == 0)
+        local_data = std::move(serial_data);
+      else
+        mpi_comm.send(pid, tag, serial_data.Data());
+
+      const double fraction_complete =
+        static_cast<double>(pid + 1) / static_cast<double>(num_parts);
+      if (fraction_complete >= static_cast<double>(aux_counter + 1) * 0.1)
+      {
+        if (verbosity_level_ >= 1)
+          log.Log() << program_timer.GetTimeString() << " Surpassing part " << pid << " of "
+                    << num_parts << " (" << (aux_counter + 1) * 10 << "%)";
+        ++aux_counter;
+      }
+    }
+  } // if home location
+  else
+    mpi_comm.recv(0, tag, local_data.Data());
+
+  auto mesh_data = DeserializePartition(local_data);
+  local_data.Clear();
+
+  auto grid_ptr = SetupLocalMesh(mesh_data);
+  mesh_stack.push_back(grid_ptr);
+
+  opensn::mpi_comm.barrier();
+}
+
+std::vector<std::vector<uint64_t>>
+DistributedMeshGenerator::MakePartitionCellLists(const UnpartitionedMesh& umesh,
+                                                 const std::vector<int64_t>& cell_pids,
+                                                 int num_parts) const
+{
+  const auto& vertex_subs = umesh.GetVertextCellSubscriptions();
+  const auto& raw_cells = umesh.GetRawCells();
+
+  std::vector<std::vector<uint64_t>> part_cells(num_parts);
+  for (uint64_t cell_global_id = 0; cell_global_id < raw_cells.size(); ++cell_global_id)
+  {
+    if (replicated_)
+    {
+      for (auto& cells : part_cells)
+        cells.push_back(cell_global_id);
+      continue;
+    }
+
+    // A cell is needed by its own partition and, as a ghost, by every partition owning a cell
+    // that shares one of its vertices.
+    const auto cell_pid = cell_pids[cell_global_id];
+    part_cells[cell_pid].push_back(cell_global_id);
+    for (uint64_t vid : raw_cells[cell_global_id]->vertex_ids)
+      for (uint64_t adj_gid : vertex_subs[vid])
+      {
+        const auto adj_pid = cell_pids[adj_gid];
+        if (adj_pid != cell_pid and
+            (part_cells[adj_pid].empty() or part_cells[adj_pid].back() != cell_global_id))
+          part_cells[adj_pid].push_back(cell_global_id);
+      }
+  }
+
+  return part_cells;
+}
+
+} // namespace opensn
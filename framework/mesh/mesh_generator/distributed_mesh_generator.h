@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "framework/mesh/mesh_generator/mesh_generator.h"
+
+namespace opensn
+{
+
+/**
+ * Generates and partitions the mesh only on location 0 and then sends each location just the
+ * cells (local and ghost) and vertices it needs. Unlike the base MeshGenerator, the other
+ * locations never hold the full unpartitioned mesh, and unlike the SplitFileMeshGenerator no
+ * intermediate files are written.
+ */
+class DistributedMeshGenerator : public MeshGenerator
+{
+public:
+  static InputParameters GetInputParameters();
+  explicit DistributedMeshGenerator(const InputParameters& params);
+
+  void Execute() override;
+
+protected:
+  /**
+   * Determines, for every partition, the global ids of the cells it owns or needs as ghosts.
+   * Each list is sorted.
+   */
+  std::vector<std::vector<uint64_t>> MakePartitionCellLists(const UnpartitionedMesh& umesh,
+                                                            const std::vector<int64_t>& cell_pids,
+                                                            int num_parts) const;
+
+  const int verbosity_level_;
+};
+
+} // namespace opensn
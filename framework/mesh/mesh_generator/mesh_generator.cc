@@ -9,6 +9,7 @@
 #include "framework/runtime.h"
 #include "framework/logging/log.h"
 #include "framework/mesh/cell/cell.h"
+#include "framework/data_types/byte_array.h"
 
 namespace opensn
 {
@@ -267,7 +268,7 @@ bool
 MeshGenerator::CellHasLocalScope(int location_id,
                                  const UnpartitionedMesh::LightWeightCell& lwcell,
                                  uint64_t cell_global_id,
-                                 const std::vector<std::set<uint64_t>>& vertex_subscriptions,
+                                 const std::vector<std::vector<uint64_t>>& vertex_subscriptions,
                                  const std::vector<int64_t>& cell_partition_ids) const
 {
   if (replicated_)
@@ -377,4 +378,184 @@ MeshGenerator::SetupCell(const UnpartitionedMesh::LightWeightCell& raw_cell,
   return cell;
 }
 
+ByteArray
+MeshGenerator::SerializePartition(const UnpartitionedMesh& umesh,
+                                  const std::vector<int64_t>& cell_pids,
+                                  const std::vector<uint64_t>& cell_global_ids,
+                                  const std::vector<uint64_t>& vertex_ids)
+{
+  const auto& raw_cells = umesh.GetRawCells();
+  const auto& raw_vertices = umesh.GetVertices();
+  const auto& mesh_options = umesh.GetMeshOptions();
+
+  ByteArray serial_data;
+
+  // Mesh attributes and general info
+  serial_data.Write(static_cast<int>(umesh.GetMeshAttributes())); // int
+  serial_data.Write(mesh_options.ortho_Nx);                       // size_t
+  serial_data.Write(mesh_options.ortho_Ny);                       // size_t
+  serial_data.Write(mesh_options.ortho_Nz);                       // size_t
+  serial_data.Write(raw_vertices.size());                         // size_t
+
+  // Boundary map
+  const auto& bndry_map = mesh_options.boundary_id_map;
+  serial_data.Write(bndry_map.size()); // size_t
+  for (const auto& [bid, bname] : bndry_map)
+  {
+    serial_data.Write(bid);          // uint64_t
+    serial_data.Write(bname.size()); // size_t
+    for (char c : bname)
+      serial_data.Write(c);
+  }
+
+  // How many cells and vertices follow
+  serial_data.Write(cell_global_ids.size()); // size_t
+  serial_data.Write(vertex_ids.size());      // size_t
+
+  // Cells
+  for (uint64_t cell_global_id : cell_global_ids)
+  {
+    serial_data.Write(static_cast<int>(cell_pids[cell_global_id])); // int
+    serial_data.Write(cell_global_id);                              // uint64_t
+    SerializeCell(*raw_cells[cell_global_id], serial_data);
+  }
+
+  // Vertices
+  for (uint64_t vid : vertex_ids)
+  {
+    serial_data.Write(vid); // uint64_t
+    serial_data.Write(raw_vertices[vid]);
+  }
+
+  return serial_data;
+}
+
+void
+MeshGenerator::SerializeCell(const UnpartitionedMesh::LightWeightCell& cell,
+                             ByteArray& serial_buffer)
+{
+  serial_buffer.Write(cell.type);
+  serial_buffer.Write(cell.sub_type);
+  serial_buffer.Write(cell.centroid);
+  serial_buffer.Write(cell.material_id);
+  serial_buffer.Write(cell.vertex_ids.size());
+  for (uint64_t vid : cell.vertex_ids)
+    serial_buffer.Write(vid);
+  serial_buffer.Write(cell.faces.size());
+  for (const auto& face : cell.faces)
+  {
+    serial_buffer.Write(face.vertex_ids.size());
+    for (uint64_t vid : face.vertex_ids)
+      serial_buffer.Write(vid);
+    serial_buffer.Write(face.has_neighbor);
+    serial_buffer.Write(face.neighbor);
+  }
+}
+
+MeshGenerator::PartitionMeshData
+MeshGenerator::DeserializePartition(ByteArray& serial_data)
+{
+  PartitionMeshData mesh_data;
+
+  // Mesh attributes and general info
+  mesh_data.mesh_attributes_ = serial_data.Read<int>();
+  mesh_data.ortho_Nx_ = serial_data.Read<size_t>();
+  mesh_data.ortho_Ny_ = serial_data.Read<size_t>();
+  mesh_data.ortho_Nz_ = serial_data.Read<size_t>();
+  mesh_data.num_global_vertices_ = serial_data.Read<size_t>();
+
+  // Boundary map
+  const size_t num_bndries = serial_data.Read<size_t>();
+  for (size_t b = 0; b < num_bndries; ++b)
+  {
+    const uint64_t bid = serial_data.Read<uint64_t>();
+    const size_t num_chars = serial_data.Read<size_t>();
+    std::string bname(num_chars, ' ');
+    for (size_t i = 0; i < num_chars; ++i)
+      bname[i] = serial_data.Read<char>();
+
+    mesh_data.boundary_id_map_.insert(std::make_pair(bid, bname));
+  }
+
+  // How many cells and vertices follow
+  const size_t num_cells = serial_data.Read<size_t>();
+  const size_t num_vertices = serial_data.Read<size_t>();
+
+  // Cells
+  for (size_t c = 0; c < num_cells; ++c)
+  {
+    const int cell_pid = serial_data.Read<int>();
+    const uint64_t cell_gid = serial_data.Read<uint64_t>();
+    const CellType cell_type = serial_data.Read<CellType>();
+    const CellType cell_sub_type = serial_data.Read<CellType>();
+
+    UnpartitionedMesh::LightWeightCell new_cell(cell_type, cell_sub_type);
+
+    new_cell.centroid = serial_data.Read<Vector3>();
+    new_cell.material_id = serial_data.Read<int>();
+
+    const size_t num_vids = serial_data.Read<size_t>();
+    for (size_t v = 0; v < num_vids; ++v)
+      new_cell.vertex_ids.push_back(serial_data.Read<uint64_t>());
+
+    const size_t num_faces = serial_data.Read<size_t>();
+    for (size_t f = 0; f < num_faces; ++f)
+    {
+      UnpartitionedMesh::LightWeightFace new_face;
+      const size_t num_face_vids = serial_data.Read<size_t>();
+      for (size_t v = 0; v < num_face_vids; ++v)
+        new_face.vertex_ids.push_back(serial_data.Read<uint64_t>());
+
+      new_face.has_neighbor = serial_data.Read<bool>();
+      new_face.neighbor = serial_data.Read<uint64_t>();
+
+      new_cell.faces.push_back(std::move(new_face));
+    } // for f
+
+    mesh_data.cells_.insert(std::make_pair(CellPIDGID(cell_pid, cell_gid), std::move(new_cell)));
+  } // for cell c
+
+  // Vertices
+  for (size_t v = 0; v < num_vertices; ++v)
+  {
+    const uint64_t vid = serial_data.Read<uint64_t>();
+    const Vector3 vertex = serial_data.Read<Vector3>();
+    mesh_data.vertices_.insert(std::make_pair(vid, vertex));
+  } // for vertex v
+
+  return mesh_data;
+}
+
+std::shared_ptr<MeshContinuum>
+MeshGenerator::SetupLocalMesh(PartitionMeshData& mesh_data)
+{
+  auto grid_ptr = MeshContinuum::New();
+
+  grid_ptr->GetBoundaryIDMap() = mesh_data.boundary_id_map_;
+
+  auto& cells = mesh_data.cells_;
+  auto& vertices = mesh_data.vertices_;
+
+  for (const auto& [vid, vertex] : vertices)
+    grid_ptr->vertices.Insert(vid, vertex);
+
+  for (const auto& [pidgid, raw_cell] : cells)
+  {
+    const auto& [cell_pid, cell_global_id] = pidgid;
+    auto cell = SetupCell(raw_cell, cell_global_id, cell_pid, STLVertexListHelper(vertices));
+
+    grid_ptr->cells.push_back(std::move(cell));
+  }
+
+  SetGridAttributes(*grid_ptr,
+                    static_cast<MeshAttributes>(mesh_data.mesh_attributes_),
+                    {mesh_data.ortho_Nx_, mesh_data.ortho_Ny_, mesh_data.ortho_Nz_});
+
+  grid_ptr->SetGlobalVertexCount(mesh_data.num_global_vertices_);
+
+  ComputeAndPrintStats(*grid_ptr);
+
+  return grid_ptr;
+}
+
 } // namespace opensn
@@ -13,6 +13,7 @@ namespace opensn
 {
 class GraphPartitioner;
 class MeshContinuum;
+class ByteArray;
 
 /**
  * Mesh generation can be very complicated in parallel. Some mesh formats
@@ -90,7 +91,7 @@ protected:
   bool CellHasLocalScope(int location_id,
                          const UnpartitionedMesh::LightWeightCell& lwcell,
                          uint64_t cell_global_id,
-                         const std::vector<std::set<uint64_t>>& vertex_subscriptions,
+                         const std::vector<std::vector<uint64_t>>& vertex_subscriptions,
                          const std::vector<int64_t>& cell_partition_ids) const;
 
   /**
@@ -107,6 +108,49 @@ protected:
 
   static void ComputeAndPrintStats(const MeshContinuum& grid);
 
+  typedef std::pair<int, uint64_t> CellPIDGID;
+
+  /**
+   * The cells (local and ghost), vertices and attributes of a single partition, as handed to the
+   * location that owns it.
+   */
+  struct PartitionMeshData
+  {
+    std::map<CellPIDGID, UnpartitionedMesh::LightWeightCell> cells_;
+    std::map<uint64_t, Vector3> vertices_;
+    std::map<uint64_t, std::string> boundary_id_map_;
+    int mesh_attributes_;
+    size_t ortho_Nx_;
+    size_t ortho_Ny_;
+    size_t ortho_Nz_;
+    size_t num_global_vertices_;
+  };
+
+  /**
+   * Serializes the mesh attributes, the listed cells with their partition ids, and the listed
+   * vertices of a single partition. The cell and vertex lists are written in the given order.
+   */
+  static ByteArray SerializePartition(const UnpartitionedMesh& umesh,
+                                      const std::vector<int64_t>& cell_pids,
+                                      const std::vector<uint64_t>& cell_global_ids,
+                                      const std::vector<uint64_t>& vertex_ids);
+
+  /**
+   * Serializes a light-weight cell without its global id and partition id.
+   */
+  static void SerializeCell(const UnpartitionedMesh::LightWeightCell& cell,
+                            ByteArray& serial_buffer);
+
+  /**
+   * Reads a partition written by SerializePartition, starting at the current offset.
+   */
+  static PartitionMeshData DeserializePartition(ByteArray& serial_data);
+
+  /**
+   * Builds the local mesh of a partition.
+   */
+  static std::shared_ptr<MeshContinuum> SetupLocalMesh(PartitionMeshData& mesh_data);
+
   const double scale_;
   const bool replicated_;
   std::vector<MeshGenerator*> inputs_;
@@ -132,7 +132,6 @@ SplitFileMeshGenerator::WriteSplitMesh(const std::vector<int64_t>& cell_pids,
 
   const auto& vertex_subs = umesh.GetVertextCellSubscriptions();
   const auto& raw_cells = umesh.GetRawCells();
-  const auto& raw_vertices = umesh.GetVertices();
 
   uint64_t aux_counter = 0;
   for (int pid = 0; pid < num_parts; ++pid)
@@ -186,73 +185,16 @@ SplitFileMeshGenerator::WriteSplitMesh(const std::vector<int64_t>& cell_pids,
     if (verbosity_level_ >= 2)
       log.Log() << "Writing part " << pid << " num_local_cells=" << local_cells_needed.size();
 
-    // Write mesh attributes and general info
-    const auto& mesh_options = umesh.GetMeshOptions();
-
+    // Write the number of parts, followed by the part itself
     WriteBinaryValue(ofile, num_parts); // int
 
-    WriteBinaryValue(ofile, static_cast<int>(umesh.GetMeshAttributes())); // int
-    WriteBinaryValue(ofile, mesh_options.ortho_Nx);                       // size_t
-    WriteBinaryValue(ofile, mesh_options.ortho_Ny);                       // size_t
-    WriteBinaryValue(ofile, mesh_options.ortho_Nz);                       // size_t
-
-    WriteBinaryValue(ofile, raw_vertices.size()); // size_t
-
-    // Write the boundary map
-    const auto& bndry_map = mesh_options.boundary_id_map;
-    WriteBinaryValue(ofile, bndry_map.size()); // size_t
-    for (const auto& [bid, bname] : bndry_map)
-    {
-      WriteBinaryValue(ofile, bid); // uint64_t
-      const size_t num_chars = bname.size();
-      WriteBinaryValue(ofile, num_chars);                     // size_t
-      ofile.write(bname.data(), static_cast<int>(num_chars)); // characters
-    }
-
-    // Write how many cells and vertices in file
-    WriteBinaryValue(ofile, cells_needed.size());    // size_t
-    WriteBinaryValue(ofile, vertices_needed.size()); // size_t
-
-    // Write cells
-    const size_t BUFFER_SIZE = 4096 * 2;
-    ByteArray serial_data;
-    serial_data.Data().reserve(BUFFER_SIZE * 2);
-    for (const auto& cell_global_id : cells_needed)
-    {
-      const auto& cell = *raw_cells[cell_global_id];
-      serial_data.Write(static_cast<int>(cell_pids[cell_global_id])); // int
-      serial_data.Write(cell_global_id);                              // uint64_t
-      SerializeCell(cell, serial_data);
-      if (serial_data.Size() > BUFFER_SIZE)
-      {
-        ofile.write((char*)serial_data.Data().data(), static_cast<int>(serial_data.Size()));
-        const size_t cap = serial_data.Data().capacity();
-        serial_data.Clear();
-        serial_data.Data().reserve(cap);
-      }
-    }
-    if (serial_data.Size() > 0)
-    {
-      ofile.write((char*)serial_data.Data().data(), static_cast<int>(serial_data.Size()));
-      serial_data.Clear();
-    }
-
-    // Write vertices
-    for (const uint64_t vid : vertices_needed)
-    {
-      serial_data.Write(vid); // uint64_t
-      serial_data.Write(raw_vertices[vid]);
-      if (serial_data.Size() > BUFFER_SIZE)
-      {
-        ofile.write((char*)serial_data.Data().data(), static_cast<int>(serial_data.Size()));
-        serial_data.Clear();
-      }
-    }
-    if (serial_data.Size() > 0)
-    {
-      ofile.write((char*)serial_data.Data().data(), static_cast<int>(serial_data.Size()));
-      serial_data.Clear();
-    }
+    const auto serial_data =
+      SerializePartition(umesh,
+                         cell_pids,
+                         std::vector<uint64_t>(cells_needed.begin(), cells_needed.end()),
+                         std::vector<uint64_t>(vertices_needed.begin(), vertices_needed.end()));
+    ofile.write(reinterpret_cast<const char*>(serial_data.Data().data()),
+                static_cast<std::streamsize>(serial_data.Size()));
 
     ofile.close();
 
@@ -267,29 +209,7 @@ SplitFileMeshGenerator::WriteSplitMesh(const std::vector<int64_t>& cell_pids,
   } // for p
 }
 
-void
-SplitFileMeshGenerator::SerializeCell(const UnpartitionedMesh::LightWeightCell& cell,
-                                      ByteArray& serial_buffer)
-{
-  serial_buffer.Write(cell.type);
-  serial_buffer.Write(cell.sub_type);
-  serial_buffer.Write(cell.centroid);
-  serial_buffer.Write(cell.material_id);
-  serial_buffer.Write(cell.vertex_ids.size());
-  for (uint64_t vid : cell.vertex_ids)
-    serial_buffer.Write(vid);
-  serial_buffer.Write(cell.faces.size());
-  for (const auto& face : cell.faces)
-  {
-    serial_buffer.Write(face.vertex_ids.size());
-    for (uint64_t vid : face.vertex_ids)
-      serial_buffer.Write(vid);
-    serial_buffer.Write(face.has_neighbor);
-    serial_buffer.Write(face.neighbor);
-  }
-}
-
-SplitFileMeshGenerator::SplitMeshInfo
+MeshGenerator::PartitionMeshData
 SplitFileMeshGenerator::ReadSplitMesh()
 {
   const int pid = opensn::mpi_comm.rank();
@@ -297,14 +217,11 @@ SplitFileMeshGenerator::ReadSplitMesh()
   const std::filesystem::path file_path =
     dir_path.string() + "/" + file_prefix_ + "_" + std::to_string(pid) + ".cmesh";
 
-  SplitMeshInfo info_block;
-  auto& cells = info_block.cells_;
-  auto& vertices = info_block.vertices_;
   std::ifstream ifile(file_path, std::ios_base::binary | std::ios_base::in);
 
   OpenSnLogicalErrorIf(not ifile.is_open(), "Failed to open " + file_path.string());
 
-  // Read mesh attributes and general info
+  // Read the number of parts
   const size_t file_num_parts = ReadBinaryValue<int>(ifile);
 
   OpenSnLogicalErrorIf(opensn::mpi_comm.size() != file_num_parts,
@@ -313,106 +230,19 @@ SplitFileMeshGenerator::ReadSplitMesh()
                          " parts but is now being read with " +
                          std::to_string(opensn::mpi_comm.size()) + " processes.");
 
-  info_block.mesh_attributes_ = ReadBinaryValue<int>(ifile);
-  info_block.ortho_Nx_ = ReadBinaryValue<size_t>(ifile);
-  info_block.ortho_Ny_ = ReadBinaryValue<size_t>(ifile);
-  info_block.ortho_Nz_ = ReadBinaryValue<size_t>(ifile);
-
-  info_block.num_global_vertices_ = ReadBinaryValue<size_t>(ifile);
-
-  // Read boundary map
-  const size_t num_bndries = ReadBinaryValue<size_t>(ifile);
-  for (size_t b = 0; b < num_bndries; ++b)
-  {
-    const uint64_t bid = ReadBinaryValue<uint64_t>(ifile);
-    const size_t num_chars = ReadBinaryValue<size_t>(ifile);
-    std::string bname(num_chars, ' ');
-    ifile.read(bname.data(), static_cast<int>(num_chars));
-
-    info_block.boundary_id_map_.insert(std::make_pair(bid, bname));
-  }
-
-  // Write how many cells and vertices in file
-  const size_t num_cells = ReadBinaryValue<size_t>(ifile);
-  const size_t num_vertices = ReadBinaryValue<size_t>(ifile);
-
-  // Read the cells
-  for (size_t c = 0; c < num_cells; ++c)
-  {
-    const int cell_pid = ReadBinaryValue<int>(ifile);
-    const uint64_t cell_gid = ReadBinaryValue<uint64_t>(ifile);
-    const CellType cell_type = ReadBinaryValue<CellType>(ifile);
-    const CellType cell_sub_type = ReadBinaryValue<CellType>(ifile);
-
-    UnpartitionedMesh::LightWeightCell new_cell(cell_type, cell_sub_type);
-
-    new_cell.centroid = ReadBinaryValue<Vector3>(ifile);
-    new_cell.material_id = ReadBinaryValue<int>(ifile);
-
-    const size_t num_vids = ReadBinaryValue<size_t>(ifile);
-    for (size_t v = 0; v < num_vids; ++v)
-      new_cell.vertex_ids.push_back(ReadBinaryValue<uint64_t>(ifile));
-
-    const size_t num_faces = ReadBinaryValue<size_t>(ifile);
-    for (size_t f = 0; f < num_faces; ++f)
-    {
-      UnpartitionedMesh::LightWeightFace new_face;
-      const size_t num_face_vids = ReadBinaryValue<size_t>(ifile);
-      for (size_t v = 0; v < num_face_vids; ++v)
-        new_face.vertex_ids.push_back(ReadBinaryValue<uint64_t>(ifile));
-
-      new_face.has_neighbor = ReadBinaryValue<bool>(ifile);
-      new_face.neighbor = ReadBinaryValue<uint64_t>(ifile);
-
-      new_cell.faces.push_back(std::move(new_face));
-    } // for f
-
-    cells.insert(std::make_pair(CellPIDGID(cell_pid, cell_gid), std::move(new_cell)));
-  } // for cell c
-
-  // Read the vertices
-  for (size_t v = 0; v < num_vertices; ++v)
-  {
-    const uint64_t vid = ReadBinaryValue<uint64_t>(ifile);
-    const Vector3 vertex = ReadBinaryValue<Vector3>(ifile);
-    vertices.insert(std::make_pair(vid, vertex));
-  } // for vertex v
+  // The rest of the file is the serialized part
+  const auto part_begin = ifile.tellg();
+  ifile.seekg(0, std::ios_base::end);
+  const auto part_size = static_cast<size_t>(ifile.tellg() - part_begin);
+  ifile.seekg(part_begin);
 
+  ByteArray serial_data(part_size);
+  ifile.read(reinterpret_cast<char*>(serial_data.Data().data()),
+             static_cast<std::streamsize>(part_size));
+  OpenSnLogicalErrorIf(not ifile, "Failed to read " + file_path.string());
   ifile.close();
 
-  return info_block;
-}
-
-std::shared_ptr<MeshContinuum>
-SplitFileMeshGenerator::SetupLocalMesh(SplitMeshInfo& mesh_info)
-{
-  auto grid_ptr = MeshContinuum::New();
-
-  grid_ptr->GetBoundaryIDMap() = mesh_info.boundary_id_map_;
-
-  auto& cells = mesh_info.cells_;
-  auto& vertices = mesh_info.vertices_;
-
-  for (const auto& [vid, vertex] : vertices)
-    grid_ptr->vertices.Insert(vid, vertex);
-
-  for (const auto& [pidgid, raw_cell] : cells)
-  {
-    const auto& [cell_pid, cell_global_id] = pidgid;
-    auto cell = SetupCell(raw_cell, cell_global_id, cell_pid, STLVertexListHelper(vertices));
-
-    grid_ptr->cells.push_back(std::move(cell));
-  }
-
-  SetGridAttributes(*grid_ptr,
-                    static_cast<MeshAttributes>(mesh_info.mesh_attributes_),
-                    {mesh_info.ortho_Nx_, mesh_info.ortho_Ny_, mesh_info.ortho_Nz_});
-
-  grid_ptr->SetGlobalVertexCount(mesh_info.num_global_vertices_);
-
-  ComputeAndPrintStats(*grid_ptr);
-
-  return grid_ptr;
+  return DeserializePartition(serial_data);
 }
 
 } // namespace opensn
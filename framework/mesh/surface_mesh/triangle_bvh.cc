@@ -0,0 +1,294 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "framework/mesh/surface_mesh/triangle_bvh.h"
+#include "framework/mesh/surface_mesh/surface_mesh.h"
+#include "framework/logging/log.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace opensn
+{
+
+namespace
+{
+
+/// Maximum number of triangles in a leaf
+constexpr uint32_t MAX_LEAF_SIZE = 4;
+
+/// Maximum depth of the tree. Median splits keep the depth at about log2 of the triangle count.
+constexpr size_t MAX_DEPTH = 64;
+
+/// Tolerance on barycentric coordinates below which a crossing is considered to hit an edge
+constexpr double BARYCENTRIC_TOLERANCE = 1.0e-10;
+
+/**
+ * Ray directions, tried in order until a ray crosses the surface away from edges and vertices.
+ * None is aligned with the axes or diagonals, along which mesh edges commonly lie.
+ */
+const std::array<Vector3, 6> RAY_DIRECTIONS = {
+  Vector3(0.3141592653589793, 0.5772156649015329, 0.7548776662466927).Normalized(),
+  Vector3(-0.6180339887498949, 0.4142135623730950, 0.2718281828459045).Normalized(),
+  Vector3(0.1732050807568877, -0.7071067811865476, 0.3819660112501051).Normalized(),
+  Vector3(0.4472135954999579, 0.2236067977499790, -0.8660254037844386).Normalized(),
+  Vector3(-0.2645751311064591, -0.5291502622129181, 0.1224744871391589).Normalized(),
+  Vector3(0.6931471805599453, -0.1098612288668110, -0.3010299956639812).Normalized()};
+
+Vector3
+Min(const Vector3& a, const Vector3& b)
+{
+  return Vector3(std::min(a.x, b.x), std::min(a.y, b.y), std::min(a.z, b.z));
+}
+
+Vector3
+Max(const Vector3& a, const Vector3& b)
+{
+  return Vector3(std::max(a.x, b.x), std::max(a.y, b.y), std::max(a.z, b.z));
+}
+
+/**Slab test of a ray, given by its origin and inverse direction, against a box.*/
+bool
+RayHitsBox(const Vector3& origin,
+           const Vector3& inv_direction,
+           const Vector3& box_min,
+           const Vector3& box_max)
+{
+  const double tx0 = (box_min.x - origin.x) * inv_direction.x;
+  const double tx1 = (box_max.x - origin.x) * inv_direction.x;
+  const double ty0 = (box_min.y - origin.y) * inv_direction.y;
+  const double ty1 = (box_max.y - origin.y) * inv_direction.y;
+  const double tz0 = (box_min.z - origin.z) * inv_direction.z;
+  const double tz1 = (box_max.z - origin.z) * inv_direction.z;
+
+  const double t_enter =
+    std::max({std::min(tx0, tx1), std::min(ty0, ty1), std::min(tz0, tz1), 0.0});
+  const double t_exit = std::min({std::max(tx0, tx1), std::max(ty0, ty1), std::max(tz0, tz1)});
+  return t_exit >= t_enter;
+}
+
+} // namespace
+
+TriangleBVH::TriangleBVH(const SurfaceMesh& surface_mesh)
+{
+  const auto& vertices = surface_mesh.GetVertices();
+
+  // Triangles, followed by the polygons split into triangles about their vertex average
+  std::vector<std::array<Vector3, 3>> corners;
+  corners.reserve(surface_mesh.GetTriangles().size());
+  for (const auto& face : surface_mesh.GetTriangles())
+    corners.push_back(
+      {vertices[face.v_index[0]], vertices[face.v_index[1]], vertices[face.v_index[2]]});
+  for (const auto* poly_face : surface_mesh.GetPolygons())
+  {
+    const auto& v_indices = poly_face->v_indices;
+    Vector3 center;
+    for (const int v : v_indices)
+      center = center + vertices[v];
+    center = center / static_cast<double>(v_indices.size());
+    for (size_t k = 0; k < v_indices.size(); ++k)
+      corners.push_back(
+        {vertices[v_indices[k]], vertices[v_indices[(k + 1) % v_indices.size()]], center});
+  }
+
+  const size_t num_triangles = corners.size();
+  OpenSnLogicalErrorIf(num_triangles >= std::numeric_limits<uint32_t>::max(),
+                       "Too many triangles for a triangle bounding-volume hierarchy.");
+  if (num_triangles == 0)
+    return;
+
+  // Triangle boxes and centroids, and the extent of the surface
+  std::vector<std::array<Vector3, 2>> boxes(num_triangles);
+  std::vector<Vector3> centroids(num_triangles);
+  Vector3 surface_min = corners[0][0];
+  Vector3 surface_max = surface_min;
+  for (size_t t = 0; t < num_triangles; ++t)
+  {
+    const auto& [v0, v1, v2] = corners[t];
+    boxes[t] = {Min(v0, Min(v1, v2)), Max(v0, Max(v1, v2))};
+    centroids[t] = (v0 + v1 + v2) / 3.0;
+    surface_min = Min(surface_min, boxes[t][0]);
+    surface_max = Max(surface_max, boxes[t][1]);
+  }
+  const double extent = (surface_max - surface_min).Norm();
+  length_tolerance_ = 1.0e-10 * (extent > 0.0 ? extent : 1.0);
+
+  // Pad the boxes so that rays through flat boxes, and points on the surface, are not missed
+  const Vector3 padding(length_tolerance_, length_tolerance_, length_tolerance_);
+  for (auto& box : boxes)
+  {
+    box[0] = box[0] - padding;
+    box[1] = box[1] + padding;
+  }
+
+  std::vector<uint32_t> order(num_triangles);
+  for (size_t t = 0; t < num_triangles; ++t)
+    order[t] = static_cast<uint32_t>(t);
+
+  nodes_.reserve(2 * (num_triangles / MAX_LEAF_SIZE + 1));
+  Build(order, centroids, boxes, 0, static_cast<uint32_t>(num_triangles));
+
+  // Store the triangles in tree order, so that leaves are contiguous
+  triangles_.reserve(num_triangles);
+  for (const uint32_t t : order)
+  {
+    const auto& [v0, v1, v2] = corners[t];
+    const Vector3 e1 = v1 - v0;
+    const Vector3 e2 = v2 - v0;
+    const Vector3 normal = e1.Cross(e2);
+    triangles_.push_back({v0, e1, e2, normal, normal.Norm()});
+  }
+}
+
+uint32_t
+TriangleBVH::Build(std::vector<uint32_t>& order,
+                   const std::vector<Vector3>& centroids,
+                   const std::vector<std::array<Vector3, 2>>& boxes,
+                   const uint32_t begin,
+                   const uint32_t end)
+{
+  const auto node_index = static_cast<uint32_t>(nodes_.size());
+  nodes_.emplace_back();
+
+  Vector3 box_min = boxes[order[begin]][0];
+  Vector3 box_max = boxes[order[begin]][1];
+  Vector3 centroid_min = centroids[order[begin]];
+  Vector3 centroid_max = centroid_min;
+  for (uint32_t k = begin + 1; k < end; ++k)
+  {
+    box_min = Min(box_min, boxes[order[k]][0]);
+    box_max = Max(box_max, boxes[order[k]][1]);
+    centroid_min = Min(centroid_min, centroids[order[k]]);
+    centroid_max = Max(centroid_max, centroids[order[k]]);
+  }
+  nodes_[node_index].box_min = box_min;
+  nodes_[node_index].box_max = box_max;
+
+  // Split along the longest axis of the centroid bounds
+  const Vector3 centroid_extent = centroid_max - centroid_min;
+  size_t axis = 0;
+  if (centroid_extent.y > centroid_extent[axis])
+    axis = 1;
+  if (centroid_extent.z > centroid_extent[axis])
+    axis = 2;
+
+  if (end - begin <= MAX_LEAF_SIZE or centroid_extent[axis] <= 0.0)
+  {
+    nodes_[node_index].index = begin;
+    nodes_[node_index].count = end - begin;
+    return node_index;
+  }
+
+  const uint32_t middle = begin + (end - begin) / 2;
+  std::nth_element(order.begin() + begin,
+                   order.begin() + middle,
+                   order.begin() + end,
+                   [&centroids, axis](uint32_t a, uint32_t b)
+                   { return centroids[a][axis] < centroids[b][axis]; });
+
+  Build(order, centroids, boxes, begin, middle);
+  const uint32_t second_child = Build(order, centroids, boxes, middle, end);
+  nodes_[node_index].index = second_child;
+  return node_index;
+}
+
+TriangleBVH::RayResult
+TriangleBVH::CastRay(const Vector3& origin, const Vector3& direction) const
+{
+  const Vector3 inv_direction(1.0 / direction.x, 1.0 / direction.y, 1.0 / direction.z);
+
+  size_t num_crossings = 0;
+  std::array<uint32_t, MAX_DEPTH> stack;
+  size_t stack_size = 0;
+  stack[stack_size++] = 0;
+  while (stack_size > 0)
+  {
+    const uint32_t node_index = stack[--stack_size];
+    const Node& node = nodes_[node_index];
+    if (not RayHitsBox(origin, inv_direction, node.box_min, node.box_max))
+      continue;
+
+    if (node.count == 0)
+    {
+      OpenSnLogicalErrorIf(stack_size + 2 > MAX_DEPTH,
+                           "Triangle bounding-volume hierarchy exceeds the maximum depth.");
+      stack[stack_size++] = node.index;
+      stack[stack_size++] = node_index + 1;
+      continue;
+    }
+
+    // Moller-Trumbore intersection with the triangles of the leaf
+    for (uint32_t k = node.index; k < node.index + node.count; ++k)
+    {
+      const auto& tri = triangles_[k];
+      const Vector3 s = origin - tri.v0;
+      const Vector3 p = direction.Cross(tri.e2);
+      const double det = tri.e1.Dot(p);
+
+      // Ray parallel to the triangle. It can only touch the triangle if the origin lies in its
+      // plane, in which case it slides along the surface.
+      if (std::fabs(det) <= 1.0e-12 * tri.normal_norm)
+      {
+        if (tri.normal_norm > 0.0 and
+            std::fabs(s.Dot(tri.normal)) <= length_tolerance_ * tri.normal_norm)
+          return RayResult::DEGENERATE;
+        continue;
+      }
+
+      const double inv_det = 1.0 / det;
+      const double u = s.Dot(p) * inv_det;
+      if (u < -BARYCENTRIC_TOLERANCE or u > 1.0 + BARYCENTRIC_TOLERANCE)
+        continue;
+      const Vector3 q = s.Cross(tri.e1);
+      const double v = direction.Dot(q) * inv_det;
+      if (v < -BARYCENTRIC_TOLERANCE or u + v > 1.0 + BARYCENTRIC_TOLERANCE)
+        continue;
+
+      const double t = tri.e2.Dot(q) * inv_det;
+      if (std::fabs(t) <= length_tolerance_)
+        return RayResult::ON_SURFACE;
+      if (t < 0.0)
+        continue;
+
+      if (u < BARYCENTRIC_TOLERANCE or v < BARYCENTRIC_TOLERANCE or
+          u + v > 1.0 - BARYCENTRIC_TOLERANCE)
+        return RayResult::DEGENERATE;
+      ++num_crossings;
+    }
+  }
+
+  return num_crossings % 2 == 1 ? RayResult::ODD : RayResult::EVEN;
+}
+
+bool
+TriangleBVH::Inside(const Vector3& point) const
+{
+  if (nodes_.empty())
+    return false;
+
+  const Node& root = nodes_.front();
+  if (point.x < root.box_min.x or point.x > root.box_max.x or point.y < root.box_min.y or
+      point.y > root.box_max.y or point.z < root.box_min.z or point.z > root.box_max.z)
+    return false;
+
+  // A ray that crosses an edge or a vertex may count a crossing twice, or not at all, so such
+  // rays are discarded in favor of the next direction
+  for (const auto& direction : RAY_DIRECTIONS)
+  {
+    switch (CastRay(point, direction))
+    {
+      case RayResult::ODD:
+      case RayResult::ON_SURFACE:
+        return true;
+      case RayResult::EVEN:
+        return false;
+      case RayResult::DEGENERATE:
+        break;
+    }
+  }
+
+  // Every direction grazes an edge, which requires a point on a measure-zero set of lines
+  return false;
+}
+
+} // namespace opensn
@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "framework/mesh/mesh.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace opensn
+{
+
+/**
+ * Bounding-volume hierarchy over the faces of a closed surface mesh, answering inside/outside
+ * queries by the parity of the number of surface crossings of a ray. Polygonal faces are split
+ * into triangles about their vertex average.
+ *
+ * The tree is a binary tree of axis-aligned boxes, built once by splitting the triangles at the
+ * median centroid along the longest axis of their centroid bounds. A query visits only the
+ * triangles whose boxes the ray passes through, i.e. O(log N) of N triangles for well-shaped
+ * surfaces.
+ */
+class TriangleBVH
+{
+public:
+  TriangleBVH() = default;
+
+  /**Builds the hierarchy over all triangular and polygonal faces of `surface_mesh`.*/
+  explicit TriangleBVH(const SurfaceMesh& surface_mesh);
+
+  /**Returns the number of triangles.*/
+  size_t NumTriangles() const { return triangles_.size(); }
+
+  /**
+   * Returns true if `point` is enclosed by the surface. Points on the surface, within a tolerance
+   * relative to the size of the surface, are considered inside.
+   */
+  bool Inside(const Vector3& point) const;
+
+private:
+  /**Outcome of casting a ray against the surface.*/
+  enum class RayResult
+  {
+    EVEN,       ///< The ray crosses the surface an even number of times
+    ODD,        ///< The ray crosses the surface an odd number of times
+    ON_SURFACE, ///< The ray origin lies on the surface
+    DEGENERATE  ///< The ray grazes an edge or vertex; the crossing count is unreliable
+  };
+
+  struct Node
+  {
+    Vector3 box_min;
+    Vector3 box_max;
+    /// Leaves: first triangle. Interior nodes: index of the second child; the first child
+    /// immediately follows its parent.
+    uint32_t index = 0;
+    /// Number of triangles of a leaf, zero for interior nodes
+    uint32_t count = 0;
+  };
+
+  /**Triangle stored as a vertex, two edges and their cross product, in tree order.*/
+  struct Triangle
+  {
+    Vector3 v0;
+    Vector3 e1;
+    Vector3 e2;
+    Vector3 normal;
+    double normal_norm = 0.0;
+  };
+
+  /**Builds the subtree over triangles `[begin, end)` and returns the index of its root.*/
+  uint32_t Build(std::vector<uint32_t>& order,
+                 const std::vector<Vector3>& centroids,
+                 const std::vector<std::array<Vector3, 2>>& boxes,
+                 uint32_t begin,
+                 uint32_t end);
+
+  /**Casts a ray from `origin` along `direction` and classifies the crossings.*/
+  RayResult CastRay(const Vector3& origin, const Vector3& direction) const;
+
+  std::vector<Node> nodes_;
+  std::vector<Triangle> triangles_;
+  double length_tolerance_ = 0.0;
+};
+
+} // namespace opensn
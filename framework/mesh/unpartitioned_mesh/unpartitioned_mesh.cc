@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <fstream>
 #include <map>
+#include <unordered_map>
 
 namespace opensn
 {
@@ -37,6 +38,29 @@ ErrorReadingFileStr(const std::string& file_name, const std::string& function_na
   return std::string("Failed to open file: " + file_name + " in call to " + function_name + ".");
 }
 
+/**A face identified by its sorted, unique vertex ids.*/
+using FaceKey = std::vector<uint64_t>;
+
+FaceKey
+MakeFaceKey(const std::vector<uint64_t>& vertex_ids)
+{
+  FaceKey key(vertex_ids);
+  std::sort(key.begin(), key.end());
+  key.erase(std::unique(key.begin(), key.end()), key.end());
+  return key;
+}
+
+struct FaceKeyHash
+{
+  size_t operator()(const FaceKey& key) const
+  {
+    size_t hash = key.size();
+    for (uint64_t vid : key)
+      hash ^= std::hash<uint64_t>{}(vid) + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+    return hash;
+  }
+};
+
 } // namespace
 
 UnpartitionedMesh::~UnpartitionedMesh()
@@ -220,139 +244,87 @@ UnpartitionedMesh::BuildMeshConnectivity()
 
   log.Log() << program_timer.GetTimeString() << " Establishing cell connectivity.";
 
-  // Establish internal connectivity
-  // Populate vertex subscriptions to internal cells
-  vertex_cell_subscriptions_.resize(num_raw_vertices);
+  // Populate vertex subscriptions to internal cells. Cells are visited in order, so each
+  // subscription list is sorted and only needs a check against its last entry for uniqueness.
+  vertex_cell_subscriptions_.assign(num_raw_vertices, {});
   {
     uint64_t cur_cell_id = 0;
     for (const auto& cell : raw_cells_)
     {
       for (auto vid : cell->vertex_ids)
-        vertex_cell_subscriptions_.at(vid).insert(cur_cell_id);
+      {
+        auto& subs = vertex_cell_subscriptions_.at(vid);
+        if (subs.empty() or subs.back() != cur_cell_id)
+          subs.push_back(cur_cell_id);
+      }
       ++cur_cell_id;
     }
   }
 
   log.Log() << program_timer.GetTimeString() << " Vertex cell subscriptions complete.";
 
-  // Process raw cells
+  // Establish internal connectivity
+  // Unconnected faces are kept in a hash map keyed on their sorted vertex ids. When a face with
+  // the same key is encountered the two faces are connected and the entry is removed, so the map
+  // only ever holds the faces on the front between processed and unprocessed cells.
   {
-    uint64_t aux_counter = 0;
+    std::unordered_map<FaceKey, std::pair<uint64_t, size_t>, FaceKeyHash> open_faces;
     uint64_t cur_cell_id = 0;
     for (auto& cell : raw_cells_)
     {
-      for (auto& cur_cell_face : cell->faces)
+      for (size_t f = 0; f < cell->faces.size(); ++f)
       {
+        auto& cur_cell_face = cell->faces[f];
         if (cur_cell_face.has_neighbor)
-        {
           continue;
-        }
-        const std::set<uint64_t> cfvids(cur_cell_face.vertex_ids.begin(),
-                                        cur_cell_face.vertex_ids.end());
 
-        std::set<size_t> cells_to_search;
-        for (uint64_t vid : cfvids)
-          for (uint64_t cell_id : vertex_cell_subscriptions_.at(vid))
-            if (cell_id != cur_cell_id)
-              cells_to_search.insert(cell_id);
+        auto [it, inserted] =
+          open_faces.try_emplace(MakeFaceKey(cur_cell_face.vertex_ids), cur_cell_id, f);
+        if (inserted)
+          continue;
 
-        for (uint64_t adj_cell_id : cells_to_search)
-        {
-          auto adj_cell = raw_cells_.at(adj_cell_id);
+        const auto [adj_cell_id, adj_f] = it->second;
+        if (adj_cell_id == cur_cell_id)
+          continue;
 
-          for (auto& adj_cell_face : adj_cell->faces)
-          {
-            if (adj_cell_face.has_neighbor)
-            {
-              continue;
-            }
-            const std::set<uint64_t> afvids(adj_cell_face.vertex_ids.begin(),
-                                            adj_cell_face.vertex_ids.end());
-
-            if (cfvids == afvids)
-            {
-              cur_cell_face.neighbor = adj_cell_id;
-              adj_cell_face.neighbor = cur_cell_id;
-
-              cur_cell_face.has_neighbor = true;
-              adj_cell_face.has_neighbor = true;
-
-              goto face_neighbor_found;
-            }
-          } // for adjacent cell face
-        }
-      face_neighbor_found:;
-      } // for face
+        auto& adj_cell_face = raw_cells_[adj_cell_id]->faces[adj_f];
+
+        cur_cell_face.neighbor = adj_cell_id;
+        adj_cell_face.neighbor = cur_cell_id;
+
+        cur_cell_face.has_neighbor = true;
+        adj_cell_face.has_neighbor = true;
 
+        open_faces.erase(it);
+      } // for face
       ++cur_cell_id;
-      const double fraction_complete =
-        static_cast<double>(cur_cell_id) / static_cast<double>(num_raw_cells);
-      if (fraction_complete >= static_cast<double>(aux_counter + 1) * 0.1)
-      {
-        log.Log() << program_timer.GetTimeString() << " Surpassing cell " << cur_cell_id << " of "
-                  << num_raw_cells << " (" << (aux_counter + 1) * 10 << "%)";
-        ++aux_counter;
-      }
     } // for cell
+
+    log.Log() << program_timer.GetTimeString() << " Matched faces of " << num_raw_cells
+              << " cells.";
   }
 
   log.Log() << program_timer.GetTimeString() << " Establishing cell boundary connectivity.";
 
   // Establish boundary connectivity
-  // Make list of internal cells on the boundary
-  std::vector<LightWeightCell*> internal_cells_on_boundary;
-  for (auto& cell : raw_cells_)
-  {
-    bool cell_on_boundary = false;
-    for (auto& face : cell->faces)
-      if (not face.has_neighbor)
-      {
-        cell_on_boundary = true;
-        break;
-      }
-
-    if (cell_on_boundary)
-      internal_cells_on_boundary.push_back(cell);
-  }
-
-  // Populate vertex subscriptions to boundary cells
-  std::vector<std::set<uint64_t>> vertex_bndry_cell_subscriptions(vertices_.size());
-  {
-    uint64_t cur_cell_id = 0;
-    for (auto& cell : raw_boundary_cells_)
-    {
-      for (auto vid : cell->vertex_ids)
-        vertex_bndry_cell_subscriptions.at(vid).insert(cur_cell_id);
-      ++cur_cell_id;
-    }
-  }
-
-  // Process boundary cells
-  for (auto& cell : internal_cells_on_boundary)
-    for (auto& face : cell->faces)
-    {
-      if (face.has_neighbor)
-        continue;
-      std::set<uint64_t> cfvids(face.vertex_ids.begin(), face.vertex_ids.end());
-
-      std::set<size_t> cells_to_search;
-      for (uint64_t vid : face.vertex_ids)
-        for (uint64_t cell_id : vertex_bndry_cell_subscriptions[vid])
-          cells_to_search.insert(cell_id);
-
-      for (uint64_t adj_cell_id : cells_to_search)
+  // Boundary cells are keyed in the same way as faces. The first boundary cell with a given
+  // key determines the boundary id.
+  std::unordered_map<FaceKey, uint64_t, FaceKeyHash> boundary_cells;
+  boundary_cells.reserve(raw_boundary_cells_.size());
+  for (const auto& cell : raw_boundary_cells_)
+    boundary_cells.try_emplace(MakeFaceKey(cell->vertex_ids), cell->material_id);
+
+  if (not boundary_cells.empty())
+    for (auto& cell : raw_cells_)
+      for (auto& face : cell->faces)
       {
-        auto& adj_cell = raw_boundary_cells_[adj_cell_id];
-
-        std::set<uint64_t> afvids(adj_cell->vertex_ids.begin(), adj_cell->vertex_ids.end());
+        if (face.has_neighbor)
+          continue;
 
-        if (cfvids == afvids)
-        {
-          face.neighbor = adj_cell->material_id;
-          break;
-        }
-      } // for adj_cell_id
-    }   // for face
+        const auto it = boundary_cells.find(MakeFaceKey(face.vertex_ids));
+        if (it != boundary_cells.end())
+          face.neighbor = it->second;
+      }
 
   num_bndry_faces = 0;
   for (auto cell : raw_cells_)
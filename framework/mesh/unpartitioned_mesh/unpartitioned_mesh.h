@@ -69,7 +69,7 @@ protected:
   std::vector<Vertex> vertices_;
   std::vector<LightWeightCell*> raw_cells_;
   std::vector<LightWeightCell*> raw_boundary_cells_;
-  std::vector<std::set<uint64_t>> vertex_cell_subscriptions_;
+  std::vector<std::vector<uint64_t>> vertex_cell_subscriptions_;
 
   MeshAttributes attributes_ = NONE;
   Options mesh_options_;
@@ -123,7 +123,7 @@ public:
   MeshAttributes& GetMeshAttributes() { return attributes_; }
   const MeshAttributes& GetMeshAttributes() const { return attributes_; }
 
-  const std::vector<std::set<uint64_t>>& GetVertextCellSubscriptions() const
+  const std::vector<std::vector<uint64_t>>& GetVertextCellSubscriptions() const
   {
     return vertex_cell_subscriptions_;
   }
@@ -0,0 +1,120 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "framework/utils/thread_pool.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+namespace opensn
+{
+
+ThreadPool::ThreadPool(size_t num_threads)
+{
+  workers_.reserve(num_threads);
+  for (size_t t = 0; t < num_threads; ++t)
+    workers_.emplace_back(&ThreadPool::WorkerLoop, this);
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  condition_.notify_all();
+
+  for (auto& worker : workers_)
+    worker.join();
+}
+
+std::future<void>
+ThreadPool::Submit(std::function<void()> task)
+{
+  std::packaged_task<void()> packaged_task(std::move(task));
+  auto future = packaged_task.get_future();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.push(std::move(packaged_task));
+  }
+  condition_.notify_one();
+
+  return future;
+}
+
+void
+ThreadPool::WorkerLoop()
+{
+  while (true)
+  {
+    std::packaged_task<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this] { return stopping_ or not tasks_.empty(); });
+      if (stopping_ and tasks_.empty())
+        return;
+      task = std::move(tasks_.front());
+      tasks_.pop();
+    }
+    task();
+  }
+}
+
+void
+ParallelFor(size_t num_items, size_t num_threads, const std::function<void(size_t)>& function)
+{
+  const size_t num_workers = std::max<size_t>(1, std::min(num_threads, num_items));
+  if (num_workers == 1)
+  {
+    for (size_t i = 0; i < num_items; ++i)
+      function(i);
+    return;
+  }
+
+  // Several chunks per thread balance the load, while keeping the counter uncontended
+  const size_t chunk_size = std::max<size_t>(1, num_items / (8 * num_workers));
+  std::atomic<size_t> next_item(0);
+  const auto ProcessChunks = [&]()
+  {
+    for (size_t begin = next_item.fetch_add(chunk_size); begin < num_items;
+         begin = next_item.fetch_add(chunk_size))
+    {
+      const size_t end = std::min(begin + chunk_size, num_items);
+      for (size_t i = begin; i < end; ++i)
+        function(i);
+    }
+  };
+
+  ThreadPool thread_pool(num_workers - 1);
+  std::vector<std::future<void>> pending;
+  for (size_t t = 1; t < num_workers; ++t)
+    pending.push_back(thread_pool.Submit(ProcessChunks));
+
+  // All workers must finish before an exception leaves this scope, since they reference it
+  std::exception_ptr exception;
+  try
+  {
+    ProcessChunks();
+  }
+  catch (...)
+  {
+    exception = std::current_exception();
+    next_item = num_items;
+  }
+  for (auto& future : pending)
+  {
+    try
+    {
+      future.get();
+    }
+    catch (...)
+    {
+      if (not exception)
+        exception = std::current_exception();
+    }
+  }
+  if (exception)
+    std::rethrow_exception(exception);
+}
+
+} // namespace opensn
@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace opensn
+{
+
+/**
+ * A fixed-size pool of worker threads executing tasks from a shared FIFO queue.
+ *
+ * Tasks must not make MPI calls: all communication is expected to stay on the thread that owns
+ * the pool.
+ */
+class ThreadPool
+{
+public:
+  /**Starts `num_threads` worker threads.*/
+  explicit ThreadPool(size_t num_threads);
+
+  /**Finishes all queued tasks and joins the worker threads.*/
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  /**Returns the number of worker threads.*/
+  size_t NumThreads() const { return workers_.size(); }
+
+  /**Queues a task for execution. The returned future becomes ready when the task has completed and
+   * rethrows any exception raised by the task.*/
+  std::future<void> Submit(std::function<void()> task);
+
+private:
+  void WorkerLoop();
+
+  std::vector<std::thread> workers_;
+  std::queue<std::packaged_task<void()>> tasks_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  bool stopping_ = false;
+};
+
+/**
+ * Executes `function(i)` for `i = 0, ..., num_items - 1` on up to `num_threads` threads, the
+ * calling thread included. Threads claim contiguous chunks of items from a shared counter, so
+ * items of uneven cost are balanced while neighboring items stay on the same thread. Returns when
+ * all items are done and rethrows the first exception raised by `function`. The same restriction
+ * on MPI calls as for ThreadPool tasks applies.
+ */
+void ParallelFor(size_t num_items, size_t num_threads, const std::function<void(size_t)>& function);
+
+} // namespace opensn
@@ -19,20 +19,53 @@ LuaScalarSpatialMaterialFunction::GetInputParameters()
 {
   InputParameters params = ScalarSpatialMaterialFunction::GetInputParameters();
   params.AddRequiredParameter<std::string>("lua_function_name", "Name of the lua function");
+  params.AddOptionalParameter("batched",
+                              false,
+                              "If true, the lua function is called once per batch of points with "
+                              "arrays of the x, y and z coordinates, and returns an array.");
   return params;
 }
 
 LuaScalarSpatialMaterialFunction::LuaScalarSpatialMaterialFunction(const InputParameters& params)
   : ScalarSpatialMaterialFunction(params),
-    lua_function_name_(params.GetParamValue<std::string>("lua_function_name"))
+    lua_function_name_(params.GetParamValue<std::string>("lua_function_name")),
+    batched_(params.GetParamValue<bool>("batched"))
 {
 }
 
 double
 LuaScalarSpatialMaterialFunction::Evaluate(int mat_id, const opensn::Vector3& xyz) const
 {
+  if (batched_)
+    return EvaluateBatch(mat_id, {xyz}).front();
+
   lua_State* L = console.GetConsoleState();
   return LuaCall<double>(L, lua_function_name_, mat_id, xyz);
 }
 
+std::vector<double>
+LuaScalarSpatialMaterialFunction::EvaluateBatch(int mat_id,
+                                                const std::vector<opensn::Vector3>& xyz) const
+{
+  if (not batched_)
+    return ScalarSpatialMaterialFunction::EvaluateBatch(mat_id, xyz);
+
+  std::vector<double> x(xyz.size()), y(xyz.size()), z(xyz.size());
+  for (size_t i = 0; i < xyz.size(); ++i)
+  {
+    x[i] = xyz[i].x;
+    y[i] = xyz[i].y;
+    z[i] = xyz[i].z;
+  }
+
+  lua_State* L = console.GetConsoleState();
+  auto lua_return = LuaCall<std::vector<double>>(L, lua_function_name_, mat_id, x, y, z);
+  OpenSnLogicalErrorIf(lua_return.size() != xyz.size(),
+                       "Call to lua function " + lua_function_name_ +
+                         " returned a vector of size " + std::to_string(lua_return.size()) +
+                         ", which is not the same as the number of points " +
+                         std::to_string(xyz.size()) + ".");
+  return lua_return;
+}
+
 } // namespace opensnlua
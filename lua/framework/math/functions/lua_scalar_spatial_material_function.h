@@ -8,15 +8,26 @@
 namespace opensnlua
 {
 
+/**
+ * Scalar spatial material function defined by a lua function. The lua function is called with
+ * the material id and the point coordinates, `function f(mat_id, xyz)`, and returns a number.
+ *
+ * In batched mode, the lua function is instead called once per batch of points of the same
+ * material with arrays of the point coordinates, `function f(mat_id, x, y, z)`, and returns an
+ * array with one value per point.
+ */
 class LuaScalarSpatialMaterialFunction : public opensn::ScalarSpatialMaterialFunction
 {
 public:
   static opensn::InputParameters GetInputParameters();
   explicit LuaScalarSpatialMaterialFunction(const opensn::InputParameters& params);
   double Evaluate(int mat_id, const opensn::Vector3& xyz) const override;
+  std::vector<double> EvaluateBatch(int mat_id,
+                                    const std::vector<opensn::Vector3>& xyz) const override;
 
 private:
   const std::string lua_function_name_;
+  const bool batched_;
 };
 
 } // namespace opensnlua
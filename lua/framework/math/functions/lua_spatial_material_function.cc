@@ -19,12 +19,18 @@ LuaSpatialMaterialFunction::GetInputParameters()
 {
   InputParameters params = SpatialMaterialFunction::GetInputParameters();
   params.AddRequiredParameter<std::string>("lua_function_name", "Name of the lua function");
+  params.AddOptionalParameter("batched",
+                              false,
+                              "If true, the lua function is called once per batch of points with "
+                              "arrays of the x, y and z coordinates, and returns the values of all "
+                              "points in one array.");
   return params;
 }
 
 LuaSpatialMaterialFunction::LuaSpatialMaterialFunction(const InputParameters& params)
   : opensn::SpatialMaterialFunction(params),
-    lua_function_name_(params.GetParamValue<std::string>("lua_function_name"))
+    lua_function_name_(params.GetParamValue<std::string>("lua_function_name")),
+    batched_(params.GetParamValue<bool>("batched"))
 {
 }
 
@@ -38,6 +44,9 @@ LuaSpatialMaterialFunction::Evaluate(const opensn::Vector3& xyz,
   if (lua_function_name_.empty())
     return std::vector<double>(num_components, 1.0);
 
+  if (batched_)
+    return EvaluateBatch({xyz}, mat_id, num_components);
+
   // Load lua function
   lua_State* L = console.GetConsoleState();
   auto lua_return = LuaCall<std::vector<double>>(L, lua_function_name_, xyz, mat_id);
@@ -51,4 +60,33 @@ LuaSpatialMaterialFunction::Evaluate(const opensn::Vector3& xyz,
   return lua_return;
 }
 
+std::vector<double>
+LuaSpatialMaterialFunction::EvaluateBatch(const std::vector<opensn::Vector3>& xyz,
+                                          int mat_id,
+                                          int num_components) const
+{
+  if (lua_function_name_.empty() or not batched_)
+    return SpatialMaterialFunction::EvaluateBatch(xyz, mat_id, num_components);
+
+  std::vector<double> x(xyz.size()), y(xyz.size()), z(xyz.size());
+  for (size_t i = 0; i < xyz.size(); ++i)
+  {
+    x[i] = xyz[i].x;
+    y[i] = xyz[i].y;
+    z[i] = xyz[i].z;
+  }
+
+  lua_State* L = console.GetConsoleState();
+  auto lua_return = LuaCall<std::vector<double>>(L, lua_function_name_, x, y, z, mat_id);
+  // Check return value
+  OpenSnLogicalErrorIf(lua_return.size() != xyz.size() * num_components,
+                       "Call to lua function " + lua_function_name_ +
+                         " returned a vector of size " + std::to_string(lua_return.size()) +
+                         ", which is not the same as the number of points " +
+                         std::to_string(xyz.size()) + " times the number of groups " +
+                         std::to_string(num_components) + ".");
+
+  return lua_return;
+}
+
 } // namespace opensnlua
@@ -9,6 +9,16 @@
 namespace opensnlua
 {
 
+/**
+ * Spatial material function defined by a lua function. The lua function is called with the point
+ * coordinates and the material id, `function f(xyz, mat_id)`, and returns an array with one value
+ * per component.
+ *
+ * In batched mode, the lua function is instead called once per batch of points of the same
+ * material with arrays of the point coordinates, `function f(x, y, z, mat_id)`, and returns an
+ * array with the values of all components of the first point, followed by those of the second
+ * point, and so on.
+ */
 class LuaSpatialMaterialFunction : public opensn::SpatialMaterialFunction
 {
 public:
@@ -16,9 +26,13 @@ public:
   explicit LuaSpatialMaterialFunction(const opensn::InputParameters& params);
   std::vector<double>
   Evaluate(const opensn::Vector3& xyz, int mat_id, int num_components) const override;
+  std::vector<double> EvaluateBatch(const std::vector<opensn::Vector3>& xyz,
+                                    int mat_id,
+                                    int num_components) const override;
 
 private:
   const std::string lua_function_name_;
+  const bool batched_;
 };
 
 } // namespace opensnlua
@@ -71,33 +71,51 @@ MeshSetMaterialIDFromLuaFunction(lua_State* L)
                              << " Setting material id from lua function.";
 
   const auto lua_fname = LuaArg<std::string>(L, 1);
+  const auto batched = LuaArgOptional<bool>(L, 2, false);
 
   // Get back mesh
   MeshContinuum& grid = *GetCurrentMesh();
 
-  int local_num_cells_modified = 0;
+  // Local cells, followed by the ghost cells
+  const auto& ghost_ids = grid.cells.GetGhostGlobalIDs();
+  std::vector<Cell*> cells;
+  cells.reserve(grid.local_cells.size() + ghost_ids.size());
   for (auto& cell : grid.local_cells)
+    cells.push_back(&cell);
+  for (uint64_t ghost_id : ghost_ids)
+    cells.push_back(&grid.cells[ghost_id]);
+
+  std::vector<int> new_matids(cells.size());
+  if (batched)
   {
-    int new_matid = LuaCall<int>(L, lua_fname, cell.centroid_, cell.material_id_);
-    if (cell.material_id_ != new_matid)
+    std::vector<double> x(cells.size()), y(cells.size()), z(cells.size());
+    std::vector<int> matids(cells.size());
+    for (size_t c = 0; c < cells.size(); ++c)
     {
-      cell.material_id_ = new_matid;
-      ++local_num_cells_modified;
+      x[c] = cells[c]->centroid_.x;
+      y[c] = cells[c]->centroid_.y;
+      z[c] = cells[c]->centroid_.z;
+      matids[c] = cells[c]->material_id_;
     }
-  } // for local cell
+    new_matids = LuaCall<std::vector<int>>(L, lua_fname, x, y, z, matids);
+    OpenSnLogicalErrorIf(new_matids.size() != cells.size(),
+                         "Call to lua function " + lua_fname + " returned " +
+                           std::to_string(new_matids.size()) + " material ids for " +
+                           std::to_string(cells.size()) + " cells.");
+  }
+  else
+    for (size_t c = 0; c < cells.size(); ++c)
+      new_matids[c] = LuaCall<int>(L, lua_fname, cells[c]->centroid_, cells[c]->material_id_);
 
-  const auto& ghost_ids = grid.cells.GetGhostGlobalIDs();
-  for (uint64_t ghost_id : ghost_ids)
+  int local_num_cells_modified = 0;
+  for (size_t c = 0; c < cells.size(); ++c)
   {
-    auto& cell = grid.cells[ghost_id];
-    int new_matid = LuaCall<int>(L, lua_fname, cell.centroid_, cell.material_id_);
-
-    if (cell.material_id_ != new_matid)
+    if (cells[c]->material_id_ != new_matids[c])
     {
-      cell.material_id_ = new_matid;
+      cells[c]->material_id_ = new_matids[c];
       ++local_num_cells_modified;
     }
-  } // for ghost cell id
+  } // for cell
 
   int global_num_cells_modified;
   mpi_comm.all_reduce(local_num_cells_modified, global_num_cells_modified, mpi::op::sum<int>());
@@ -118,6 +136,7 @@ MeshSetBoundaryIDFromLuaFunction(lua_State* L)
   OpenSnLogicalErrorIf(opensn::mpi_comm.size() != 1, "Can for now only be used in serial.");
 
   const auto lua_fname = LuaArg<std::string>(L, 1);
+  const auto batched = LuaArgOptional<bool>(L, 2, false);
 
   opensn::log.Log0Verbose1() << program_timer.GetTimeString()
                              << " Setting boundary id from lua function.";
@@ -127,46 +146,61 @@ MeshSetBoundaryIDFromLuaFunction(lua_State* L)
   // Check if name already has id
   auto& grid_boundary_id_map = grid.GetBoundaryIDMap();
 
-  int local_num_faces_modified = 0;
+  // Boundary faces of the local cells, followed by those of the ghost cells
+  std::vector<CellFace*> faces;
   for (auto& cell : grid.local_cells)
     for (auto& face : cell.faces_)
       if (not face.has_neighbor_)
-      {
-        auto boundary_name =
-          LuaCall<std::string>(L, lua_fname, face.centroid_, face.normal_, face.neighbor_id_);
+        faces.push_back(&face);
+  const auto& ghost_ids = grid.cells.GetGhostGlobalIDs();
+  for (uint64_t ghost_id : ghost_ids)
+    for (auto& face : grid.cells[ghost_id].faces_)
+      if (not face.has_neighbor_)
+        faces.push_back(&face);
 
-        const uint64_t boundary_id = grid.MakeBoundaryID(boundary_name);
+  std::vector<std::string> boundary_names(faces.size());
+  if (batched)
+  {
+    const size_t num_faces = faces.size();
+    std::vector<double> x(num_faces), y(num_faces), z(num_faces);
+    std::vector<double> nx(num_faces), ny(num_faces), nz(num_faces);
+    std::vector<uint64_t> ids(num_faces);
+    for (size_t f = 0; f < num_faces; ++f)
+    {
+      x[f] = faces[f]->centroid_.x;
+      y[f] = faces[f]->centroid_.y;
+      z[f] = faces[f]->centroid_.z;
+      nx[f] = faces[f]->normal_.x;
+      ny[f] = faces[f]->normal_.y;
+      nz[f] = faces[f]->normal_.z;
+      ids[f] = faces[f]->neighbor_id_;
+    }
+    boundary_names = LuaCall<std::vector<std::string>>(L, lua_fname, x, y, z, nx, ny, nz, ids);
+    OpenSnLogicalErrorIf(boundary_names.size() != num_faces,
+                         "Call to lua function " + lua_fname + " returned " +
+                           std::to_string(boundary_names.size()) + " boundary names for " +
+                           std::to_string(num_faces) + " faces.");
+  }
+  else
+    for (size_t f = 0; f < faces.size(); ++f)
+      boundary_names[f] = LuaCall<std::string>(
+        L, lua_fname, faces[f]->centroid_, faces[f]->normal_, faces[f]->neighbor_id_);
 
-        if (face.neighbor_id_ != boundary_id)
-        {
-          face.neighbor_id_ = boundary_id;
-          ++local_num_faces_modified;
+  int local_num_faces_modified = 0;
+  for (size_t f = 0; f < faces.size(); ++f)
+  {
+    auto& face = *faces[f];
+    const auto& boundary_name = boundary_names[f];
+    const uint64_t boundary_id = grid.MakeBoundaryID(boundary_name);
 
-          if (grid_boundary_id_map.count(boundary_id) == 0)
-            grid_boundary_id_map[boundary_id] = boundary_name;
-        }
-      }
+    if (face.neighbor_id_ != boundary_id)
+    {
+      face.neighbor_id_ = boundary_id;
+      ++local_num_faces_modified;
 
-  const auto& ghost_ids = grid.cells.GetGhostGlobalIDs();
-  for (uint64_t ghost_id : ghost_ids)
-  {
-    auto& cell = grid.cells[ghost_id];
-    for (auto& face : cell.faces_)
-      if (not face.has_neighbor_)
-      {
-        auto boundary_name =
-          LuaCall<std::string>(L, lua_fname, face.centroid_, face.normal_, face.neighbor_id_);
-        const uint64_t boundary_id = grid.MakeBoundaryID(boundary_name);
-
-        if (face.neighbor_id_ != boundary_id)
-        {
-          face.neighbor_id_ = boundary_id;
-          ++local_num_faces_modified;
-
-          if (grid_boundary_id_map.count(boundary_id) == 0)
-            grid_boundary_id_map[boundary_id] = boundary_name;
-        }
-      }
+      if (grid_boundary_id_map.count(boundary_id) == 0)
+        grid_boundary_id_map[boundary_id] = boundary_name;
+    }
   }
 
   int global_num_faces_modified;
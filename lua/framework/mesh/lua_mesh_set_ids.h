@@ -23,6 +23,11 @@ int MeshSetUniformMaterialID(lua_State* L);
  *   --stuff
  * end
  * \endcode
+ *
+ * With the optional second argument `batched` set to true, the lua function is instead called
+ * once, with arrays of the centroid x,y,z values and current material ids of all local and ghost
+ * cells, and must return an array with the new material id of each cell. This avoids crossing
+ * the C/lua boundary once per cell.
  */
 int MeshSetMaterialIDFromLuaFunction(lua_State* L);
 
@@ -42,6 +47,10 @@ int MeshSetMaterialIDFromLogicalVolume(lua_State* L);
  * --stuff
  * end
  * \endcode
+ *
+ * With the optional second argument `batched` set to true, the lua function is instead called
+ * once, with arrays of the centroid x,y,z values, normal x,y,z values and current boundary ids of
+ * all boundary faces, and must return an array with the new boundary name of each face.
  */
 int MeshSetBoundaryIDFromLuaFunction(lua_State* L);
 
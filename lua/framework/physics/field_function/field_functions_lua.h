@@ -40,4 +40,53 @@ int ExportFieldFunctionToVTK(lua_State* L);
  */
 int ExportMultiFieldFunctionToVTK(lua_State* L);
 
+/** Evaluates a grid-based field function at a list of points. All the points are located and
+ * evaluated in one pass, with a single collective operation, so this is the preferred way to
+ * probe many points, e.g., for detector arrays or traverses. Must be called on all processes
+ * with the same points.
+ *
+ * \param FFHandle int Global handle to the field function.
+ * \param Points table Array of points, each a table with keys `x`, `y` and `z`.
+ *
+ * \return table For each point, a table with the value of each component of the field
+ *               function. Points outside the mesh evaluate to zero.
+ *
+ * \ingroup LuaFieldFunc
+ */
+int GetFieldFunctionPointValues(lua_State* L);
+
+/** Evaluates a grid-based field function at equally spaced points on a line, end points
+ * included, with a single collective operation. Must be called on all processes with the same
+ * arguments.
+ *
+ * \param FFHandle int Global handle to the field function.
+ * \param FirstPoint table First point of the line, with keys `x`, `y` and `z`.
+ * \param SecondPoint table Last point of the line, with keys `x`, `y` and `z`.
+ * \param NumPoints int Number of points, at least two.
+ *
+ * \return table For each point, from first to last, a table with the value of each component of
+ *               the field function. Points outside the mesh evaluate to zero.
+ *
+ * \ingroup LuaFieldFunc
+ */
+int GetFieldFunctionLineValues(lua_State* L);
+
+/** Evaluates a grid-based field function on a grid of points spanning the parallelogram
+ * `Origin + s * U + t * V`, with `s` and `t` in [0, 1], edges included, with a single collective
+ * operation. Must be called on all processes with the same arguments.
+ *
+ * \param FFHandle int Global handle to the field function.
+ * \param Origin table Corner of the parallelogram, with keys `x`, `y` and `z`.
+ * \param U table First edge vector, with keys `x`, `y` and `z`.
+ * \param V table Second edge vector, with keys `x`, `y` and `z`.
+ * \param NumU int Number of points along `U`, at least two.
+ * \param NumV int Number of points along `V`, at least two.
+ *
+ * \return table For each point, with `s` varying fastest, a table with the value of each
+ *               component of the field function. Points outside the mesh evaluate to zero.
+ *
+ * \ingroup LuaFieldFunc
+ */
+int GetFieldFunctionPlaneValues(lua_State* L);
+
 } // namespace opensnlua
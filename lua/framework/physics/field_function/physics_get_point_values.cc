@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "framework/lua.h"
+#include "framework/field_functions/field_function_grid_based.h"
+#include "framework/runtime.h"
+#include "framework/logging/log.h"
+#include "field_functions_lua.h"
+#include "framework/console/console.h"
+
+using namespace opensn;
+
+namespace opensnlua
+{
+
+RegisterLuaFunctionNamespace(GetFieldFunctionPointValues, fieldfunc, GetPointValues);
+RegisterLuaFunctionNamespace(GetFieldFunctionLineValues, fieldfunc, GetLineValues);
+RegisterLuaFunctionNamespace(GetFieldFunctionPlaneValues, fieldfunc, GetPlaneValues);
+
+namespace
+{
+
+std::shared_ptr<FieldFunctionGridBased>
+GetGridBasedFieldFunction(size_t ff_handle, const std::string& fname)
+{
+  auto ff_base = opensn::GetStackItemPtr(opensn::field_function_stack, ff_handle, fname);
+  auto ff = std::dynamic_pointer_cast<FieldFunctionGridBased>(ff_base);
+
+  OpenSnLogicalErrorIf(not ff, "Only grid-based field functions can be probed at points");
+
+  return ff;
+}
+
+} // namespace
+
+int
+GetFieldFunctionPointValues(lua_State* L)
+{
+  const std::string fname = "fieldfunc.GetPointValues";
+  LuaCheckArgs<size_t, std::vector<Vector3>>(L, fname);
+
+  const auto ff_handle = LuaArg<size_t>(L, 1);
+
+  // The points are read with absolute stack indices, which the Vector3 conversion requires
+  std::vector<Vector3> points(lua_rawlen(L, 2));
+  for (size_t p = 0; p < points.size(); ++p)
+  {
+    lua_rawgeti(L, 2, static_cast<lua_Integer>(p + 1));
+    points[p] = LuaArgAsType<Vector3>(L, lua_gettop(L));
+    lua_pop(L, 1);
+  }
+
+  auto ff = GetGridBasedFieldFunction(ff_handle, fname);
+  return LuaReturn(L, ff->GetPointValues(points));
+}
+
+int
+GetFieldFunctionLineValues(lua_State* L)
+{
+  const std::string fname = "fieldfunc.GetLineValues";
+  LuaCheckArgs<size_t, Vector3, Vector3, size_t>(L, fname);
+
+  const auto ff_handle = LuaArg<size_t>(L, 1);
+  const auto p0 = LuaArg<Vector3>(L, 2);
+  const auto p1 = LuaArg<Vector3>(L, 3);
+  const auto num_points = LuaArg<size_t>(L, 4);
+
+  auto ff = GetGridBasedFieldFunction(ff_handle, fname);
+  return LuaReturn(L, ff->GetLineValues(p0, p1, num_points));
+}
+
+int
+GetFieldFunctionPlaneValues(lua_State* L)
+{
+  const std::string fname = "fieldfunc.GetPlaneValues";
+  LuaCheckArgs<size_t, Vector3, Vector3, Vector3, size_t, size_t>(L, fname);
+
+  const auto ff_handle = LuaArg<size_t>(L, 1);
+  const auto origin = LuaArg<Vector3>(L, 2);
+  const auto u = LuaArg<Vector3>(L, 3);
+  const auto v = LuaArg<Vector3>(L, 4);
+  const auto num_u = LuaArg<size_t>(L, 5);
+  const auto num_v = LuaArg<size_t>(L, 6);
+
+  auto ff = GetGridBasedFieldFunction(ff_handle, fname);
+  return LuaReturn(L, ff->GetPlaneValues(origin, u, v, num_u, num_v));
+}
+
+} // namespace opensnlua
@@ -92,15 +92,11 @@ MultiGroupXSPushLuaTable(lua_State* L, std::shared_ptr<MultiGroupXS> xs)
       {
         for (unsigned int g = 0; g < matrix.NumRows(); ++g)
         {
-          const auto& col_indices = matrix.rowI_indices_[g];
-          const auto& col_values = matrix.rowI_values_[g];
-          size_t num_vals = col_values.size();
-
           LuaPush(L, g + 1);
           lua_newtable(L);
           {
-            for (unsigned int gg = 0; gg < num_vals; ++gg)
-              LuaPushTableKey(L, col_indices[gg] + 1, col_values[gg]);
+            for (const auto& [_, gp, value] : matrix.Row(g))
+              LuaPushTableKey(L, gp + 1, value);
           }
           lua_settable(L, -3);
         }
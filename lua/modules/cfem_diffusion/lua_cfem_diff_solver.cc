@@ -24,10 +24,11 @@ namespace
 {
 
 std::shared_ptr<LuaScalarSpatialMaterialFunction>
-CreateFunction(const std::string& function_name)
+CreateFunction(const std::string& function_name, bool batched)
 {
   ParameterBlock blk;
   blk.AddParameter("lua_function_name", function_name);
+  blk.AddParameter("batched", batched);
   InputParameters params = LuaScalarSpatialMaterialFunction::GetInputParameters();
   params.AssignParameters(blk);
   return std::make_shared<LuaScalarSpatialMaterialFunction>(params);
@@ -39,14 +40,15 @@ int
 CFEMDiffusionSolverCreate(lua_State* L)
 {
   auto solver_name = LuaArgOptional<std::string>(L, 1, "CFEMDiffusionSolver");
+  auto batched = LuaArgOptional<bool>(L, 2, false);
 
-  auto d_coef_function = CreateFunction("D_coef");
+  auto d_coef_function = CreateFunction("D_coef", batched);
   opensn::function_stack.push_back(d_coef_function);
 
-  auto q_ext_function = CreateFunction("Q_ext");
+  auto q_ext_function = CreateFunction("Q_ext", batched);
   opensn::function_stack.push_back(q_ext_function);
 
-  auto sigma_a_function = CreateFunction("Sigma_a");
+  auto sigma_a_function = CreateFunction("Sigma_a", batched);
   opensn::function_stack.push_back(sigma_a_function);
 
   auto new_solver = std::make_shared<opensn::cfem_diffusion::Solver>(solver_name);
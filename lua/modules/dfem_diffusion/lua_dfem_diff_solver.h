@@ -9,6 +9,14 @@ namespace opensnlua
 {
 
 /** Creates a DFEM Diffusion solver based on the interior penalty method.
+ * The coefficients are given by the lua functions `D_coef`, `Q_ext` and
+ * `Sigma_a`.
+ *
+ *\param SolverName string Optional. Name of the solver.
+ *\param Batched bool Optional. If true, the coefficient functions are called
+ *       once per cell with arrays of the point coordinates,
+ *       `function D_coef(mat_id, x, y, z)`, and return an array. Default is
+ *       false.
  *
  *\return Handle int Handle to the created solver.
  *\ingroup LuaDiffusion
@@ -47,6 +47,36 @@ int LBSWriteGroupsetAngularFlux(lua_State* L);
  */
 int LBSReadGroupsetAngularFlux(lua_State* L);
 
+/**Writes the angular fluxes of all LBS groupsets to a single shared file. This is
+ * a collective call; unlike lbs.WriteGroupsetAngularFlux, which writes one file
+ * per location, all locations write to the same file, which
+ * lbs.ReadSharedAngularFluxes can read back on any number of locations.
+ *
+ * \param SolverIndex int Handle to the solver.
+ *
+ * \param file_name string Path+Filename of the shared file. All locations write
+ *                         to this one file.
+ *
+ */
+int LBSWriteSharedAngularFluxes(lua_State* L);
+
+/**Reads the angular fluxes of all LBS groupsets from a shared file written by
+ * lbs.WriteSharedAngularFluxes. This is a collective call. The file may have been
+ * written with a different number of locations.
+ *
+ * \param SolverIndex int Handle to the solver.
+ *
+ * \param file_name string Path+Filename of the shared file.
+ *
+ * \param groups table Optional. The groups to read. All groups are read when
+ *                     omitted or empty. Groups that are not read are set to zero.
+ *
+ * \param angles table Optional. The angles to read. All angles are read when
+ *                     omitted or empty. Angles that are not read are set to zero.
+ *
+ */
+int LBSReadSharedAngularFluxes(lua_State* L);
+
 /**Writes the flux-moments of a LBS solution to file (phi_old_local).
  *
  * \param SolverIndex int Handle to the solver for which the group
@@ -16,6 +16,8 @@ namespace opensnlua::lbs
 
 RegisterLuaFunctionNamespace(LBSWriteGroupsetAngularFlux, lbs, WriteGroupsetAngularFlux);
 RegisterLuaFunctionNamespace(LBSReadGroupsetAngularFlux, lbs, ReadGroupsetAngularFlux);
+RegisterLuaFunctionNamespace(LBSWriteSharedAngularFluxes, lbs, WriteSharedAngularFluxes);
+RegisterLuaFunctionNamespace(LBSReadSharedAngularFluxes, lbs, ReadSharedAngularFluxes);
 
 int
 LBSWriteGroupsetAngularFlux(lua_State* L)
@@ -83,4 +85,42 @@ LBSReadGroupsetAngularFlux(lua_State* L)
   return LuaReturn(L);
 }
 
+int
+LBSWriteSharedAngularFluxes(lua_State* L)
+{
+  const std::string fname = "lbs.WriteSharedAngularFluxes";
+  LuaCheckArgs<size_t, std::string>(L, fname);
+
+  const auto solver_handle = LuaArg<size_t>(L, 1);
+  const auto file_name = LuaArg<std::string>(L, 2);
+
+  // Get pointer to solver
+  auto& lbs_solver =
+    opensn::GetStackItem<opensn::lbs::LBSSolver>(opensn::object_stack, solver_handle, fname);
+
+  lbs_solver.WriteAngularFluxesParallel(lbs_solver.PsiNewLocal(), file_name);
+
+  return LuaReturn(L);
+}
+
+int
+LBSReadSharedAngularFluxes(lua_State* L)
+{
+  const std::string fname = "lbs.ReadSharedAngularFluxes";
+  LuaCheckArgs<size_t, std::string>(L, fname);
+
+  const auto solver_handle = LuaArg<size_t>(L, 1);
+  const auto file_name = LuaArg<std::string>(L, 2);
+  const auto groups = LuaArgOptional<std::vector<size_t>>(L, 3, {});
+  const auto angles = LuaArgOptional<std::vector<size_t>>(L, 4, {});
+
+  // Get pointer to solver
+  auto& lbs_solver =
+    opensn::GetStackItem<opensn::lbs::LBSSolver>(opensn::object_stack, solver_handle, fname);
+
+  lbs_solver.ReadAngularFluxesParallel(file_name, lbs_solver.PsiNewLocal(), groups, angles);
+
+  return LuaReturn(L);
+}
+
 } // namespace opensnlua::lbs
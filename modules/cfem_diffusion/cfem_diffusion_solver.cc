@@ -196,6 +196,12 @@ Solver::Execute()
     MatDbl Acell(num_nodes, VecDbl(num_nodes, 0.0));
     VecDbl cell_rhs(num_nodes, 0.0);
 
+    // Coefficients at the quadrature points, in one batch per cell
+    const auto& qp_xyz = fe_vol_data.QPointsXYZ();
+    const auto D_qp = d_coef_function_->EvaluateBatch(imat, qp_xyz);
+    const auto sigma_a_qp = sigma_a_function_->EvaluateBatch(imat, qp_xyz);
+    const auto q_ext_qp = q_ext_function_->EvaluateBatch(imat, qp_xyz);
+
     for (size_t i = 0; i < num_nodes; ++i)
     {
       for (size_t j = 0; j < num_nodes; ++j)
@@ -203,17 +209,15 @@ Solver::Execute()
         double entry_aij = 0.0;
         for (size_t qp : fe_vol_data.QuadraturePointIndices())
         {
-          entry_aij += (d_coef_function_->Evaluate(imat, fe_vol_data.QPointXYZ(qp)) *
-                          fe_vol_data.ShapeGrad(i, qp).Dot(fe_vol_data.ShapeGrad(j, qp)) +
-                        sigma_a_function_->Evaluate(imat, fe_vol_data.QPointXYZ(qp)) *
-                          fe_vol_data.ShapeValue(i, qp) * fe_vol_data.ShapeValue(j, qp)) *
-                       fe_vol_data.JxW(qp);
+          entry_aij +=
+            (D_qp[qp] * fe_vol_data.ShapeGrad(i, qp).Dot(fe_vol_data.ShapeGrad(j, qp)) +
+             sigma_a_qp[qp] * fe_vol_data.ShapeValue(i, qp) * fe_vol_data.ShapeValue(j, qp)) *
+            fe_vol_data.JxW(qp);
         } // for qp
         Acell[i][j] = entry_aij;
       } // for j
       for (size_t qp : fe_vol_data.QuadraturePointIndices())
-        cell_rhs[i] += q_ext_function_->Evaluate(imat, fe_vol_data.QPointXYZ(qp)) *
-                       fe_vol_data.ShapeValue(i, qp) * fe_vol_data.JxW(qp);
+        cell_rhs[i] += q_ext_qp[qp] * fe_vol_data.ShapeValue(i, qp) * fe_vol_data.JxW(qp);
     } // for i
 
     // Flag nodes for being on a boundary
@@ -174,25 +174,29 @@ DiscreteOrdinatesAdjointSolver::ComputeInnerProduct()
   }         // for point source
 
   // Distributed sources
+  std::vector<double> src_buffer;
   for (const auto& distributed_source : distributed_sources_)
   {
-    for (const auto& local_id : distributed_source.Subscribers())
+    const auto& subscribers = distributed_source.Subscribers();
+    for (size_t s = 0; s < subscribers.size(); ++s)
     {
+      const auto local_id = subscribers[s];
       const auto& cell = grid_ptr_->local_cells[local_id];
       const auto& transport_view = cell_transport_views_[local_id];
       const auto& fe_values = unit_cell_matrices_[local_id];
       const auto nodes = discretization_->GetCellNodeLocations(cell);
 
+      // Compute group-wise values for all cell nodes at once
+      const double* src =
+        distributed_source.EvaluateSubscriber(s, cell, nodes, num_groups_, src_buffer);
+
       for (int i = 0; i < transport_view.NumNodes(); ++i)
       {
-        // Compute group-wise values for this node
-        const auto src = distributed_source(cell, nodes[i], num_groups_);
-
         // Contribute to the source moments
         const auto& intV_shapeI = fe_values.intV_shapeI[i];
         const auto dof_map = transport_view.MapDOF(i, 0, 0);
         for (const auto& group : groups_)
-          local_integral += src[group.id_] * intV_shapeI;
+          local_integral += src[i * num_groups_ + group.id_] * intV_shapeI;
       }
     }
   }
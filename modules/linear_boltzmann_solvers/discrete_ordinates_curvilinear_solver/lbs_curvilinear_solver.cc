@@ -290,7 +290,7 @@ DiscreteOrdinatesCurvilinearSolver::InitializeSpatialDiscretization()
   }
 
   typedef PieceWiseLinearDiscontinuous SDM_PWLD;
-  discretization_ = SDM_PWLD::New(*grid_ptr_, qorder, system);
+  discretization_ = SDM_PWLD::New(*grid_ptr_, qorder, system, options_.num_initialization_threads);
 
   ComputeUnitIntegrals();
 
@@ -323,7 +323,8 @@ DiscreteOrdinatesCurvilinearSolver::InitializeSpatialDiscretization()
     }
   }
 
-  discretization_secondary_ = SDM_PWLD::New(*grid_ptr_, qorder, system);
+  discretization_secondary_ =
+    SDM_PWLD::New(*grid_ptr_, qorder, system, options_.num_initialization_threads);
 
   ComputeSecondaryUnitIntegrals();
 }
@@ -16,7 +16,7 @@ namespace lbs
 SweepChunkPwlrz::SweepChunkPwlrz(
   const MeshContinuum& grid,
   const SpatialDiscretization& discretization_primary,
-  const std::vector<lbs::UnitCellMatrices>& unit_cell_matrices,
+  const lbs::UnitCellMatrixStore& unit_cell_matrices,
   const std::vector<lbs::UnitCellMatrices>& secondary_unit_cell_matrices,
   std::vector<lbs::CellLBSView>& cell_transport_views,
   const std::vector<double>& densities,
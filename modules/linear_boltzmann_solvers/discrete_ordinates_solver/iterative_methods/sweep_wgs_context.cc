@@ -23,15 +23,18 @@ SweepWGSContext::SweepWGSContext(DiscreteOrdinatesSolver& lbs_solver,
                                  SourceFlags lhs_scope,
                                  SourceFlags rhs_scope,
                                  bool log_info,
-                                 std::shared_ptr<SweepChunk> sweep_chunk)
+                                 std::shared_ptr<SweepChunk> sweep_chunk,
+                                 std::vector<std::shared_ptr<SweepChunk>> thread_sweep_chunks)
   : WGSContext(lbs_solver, groupset, set_source_function, lhs_scope, rhs_scope, log_info),
     sweep_chunk_(std::move(sweep_chunk)),
     sweep_scheduler_(lbs_solver.SweepType() == "AAH" ? SchedulingAlgorithm::DEPTH_OF_GRAPH
                                                      : SchedulingAlgorithm::FIRST_IN_FIRST_OUT,
                      *groupset.angle_agg_,
-                     *sweep_chunk_),
+                     *sweep_chunk_,
+                     std::move(thread_sweep_chunks)),
     lbs_ss_solver_(lbs_solver)
 {
+  sweep_scheduler_.SetPerformanceCounters(&lbs_solver.GetPerformanceCounters());
 }
 
 void
@@ -157,11 +160,7 @@ SweepWGSContext::PostSolveCallback()
 
     const auto scope = lhs_src_scope_ | rhs_src_scope_;
 
-    set_source_function_(groupset_,
-                         lbs_solver_.QMomentsLocal(),
-                         lbs_solver_.PhiOldLocal(),
-                         lbs_solver_.DensitiesLocal(),
-                         scope);
+    ApplySourceFunction(lbs_solver_.QMomentsLocal(), lbs_solver_.PhiOldLocal(), scope);
     sweep_scheduler_.SetDestinationPhi(lbs_solver_.PhiNewLocal());
 
     ApplyInverseTransportOperator(scope);
@@ -177,11 +176,15 @@ SweepWGSContext::PostSolveCallback()
     for (auto time : sweep_times_)
       tot_sweep_time += time;
     double avg_sweep_time = tot_sweep_time / num_sweeps;
+    double avg_source_time =
+      num_source_evaluations_ == 0 ? 0.0
+                                   : source_time_ / static_cast<double>(num_source_evaluations_);
     size_t num_angles = groupset_.quadrature_->abscissae_.size();
     size_t num_unknowns = lbs_solver_.GlobalNodeCount() * num_angles * groupset_.groups_.size();
 
     log.Log() << "\n       Average sweep time (s):        "
               << tot_sweep_time / static_cast<double>(sweep_times_.size())
+              << "\n       Average source time (s):       " << avg_source_time
               << "\n       Sweep Time/Unknown (ns):       "
               << avg_sweep_time * 1.0e9 * opensn::mpi_comm.size() /
                    static_cast<double>(num_unknowns)
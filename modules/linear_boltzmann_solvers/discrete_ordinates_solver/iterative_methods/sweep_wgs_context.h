@@ -27,7 +27,8 @@ struct SweepWGSContext : public WGSContext
                   SourceFlags lhs_scope,
                   SourceFlags rhs_scope,
                   bool log_info,
-                  std::shared_ptr<SweepChunk> sweep_chunk);
+                  std::shared_ptr<SweepChunk> sweep_chunk,
+                  std::vector<std::shared_ptr<SweepChunk>> thread_sweep_chunks = {});
 
   void PreSetupCallback() override;
 
@@ -7,8 +7,10 @@
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/fluds/cbc_fluds.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/angle_set/cbc_angle_set.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/spds/spds_adams_adams_hawkins.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/spds/sweep_ordering_builder.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/fluds/aah_fluds.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/angle_set/aah_angle_set.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/scheduler/group_subset_pipelining.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_chunks/aah_sweep_chunk.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_chunks/cbc_sweep_chunk.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/iterative_methods/sweep_wgs_context.h"
@@ -24,7 +26,9 @@
 #include "framework/object_factory.h"
 #include "framework/runtime.h"
 #include "caliper/cali.h"
+#include <array>
 #include <iomanip>
+#include <set>
 
 namespace opensn
 {
@@ -123,6 +127,8 @@ DiscreteOrdinatesSolver::Initialize()
   InitializeSweepDataStructures();
   for (auto& groupset : groupsets_)
   {
+    if (groupset.auto_num_grp_subsets_)
+      SelectPipelinedGroupSubsets(groupset);
     InitFluxDataStructures(groupset);
 
     InitWGDSA(groupset);
@@ -136,11 +142,20 @@ DiscreteOrdinatesSolver::InitializeWGSSolvers()
 {
   CALI_CXX_MARK_SCOPE("DiscreteOrdinatesSolver::InitializeWGSSolvers");
 
+  OpenSnInvalidArgumentIf(options_.num_sweep_threads > 1 and sweep_type_ != "AAH",
+                          "Option \"num_sweep_threads\" > 1 is only supported with sweep_type "
+                          "\"AAH\".");
+
   wgs_solvers_.clear(); // this is required
   for (auto& groupset : groupsets_)
   {
     std::shared_ptr<SweepChunk> sweep_chunk = SetSweepChunk(groupset);
 
+    // Each additional sweep thread executes angle sets with its own sweep chunk
+    std::vector<std::shared_ptr<SweepChunk>> thread_sweep_chunks;
+    for (unsigned int t = 1; t < options_.num_sweep_threads; ++t)
+      thread_sweep_chunks.push_back(SetSweepChunk(groupset));
+
     auto sweep_wgs_context_ptr = std::make_shared<SweepWGSContext>(
       *this,
       groupset,
@@ -148,7 +163,8 @@ DiscreteOrdinatesSolver::InitializeWGSSolvers()
       APPLY_WGS_SCATTER_SOURCES | APPLY_WGS_FISSION_SOURCES,
       APPLY_FIXED_SOURCES | APPLY_AGS_SCATTER_SOURCES | APPLY_AGS_FISSION_SOURCES,
       options_.verbose_inner_iterations,
-      sweep_chunk);
+      sweep_chunk,
+      thread_sweep_chunks);
 
     auto wgs_solver = std::make_shared<WGSLinearSolver>(sweep_wgs_context_ptr);
 
@@ -860,7 +876,7 @@ DiscreteOrdinatesSolver::ComputeLeakage(const std::vector<uint64_t>& boundary_id
     for (const auto& cell : grid_ptr_->local_cells)
     {
       const auto& cell_mapping = discretization_->GetCellMapping(cell);
-      const auto& fe_values = unit_cell_matrices_.at(cell.local_id_);
+      const auto& fe_values = unit_cell_matrices_[cell.local_id_];
 
       unsigned int f = 0;
       for (const auto& face : cell.faces_)
@@ -924,6 +940,9 @@ DiscreteOrdinatesSolver::InitializeSweepDataStructures()
 
   log.Log() << program_timer.GetTimeString() << " Initializing sweep datastructures.\n";
 
+  // Rebuilt on demand by SetSweepChunk
+  sweep_geometry_cache_ = nullptr;
+
   // Define sweep ordering groups
   quadrature_unq_so_grouping_map_.clear();
   std::map<std::shared_ptr<AngularQuadrature>, bool> quadrature_allow_cycles_map_;
@@ -943,13 +962,15 @@ DiscreteOrdinatesSolver::InitializeSweepDataStructures()
   {
     const auto& unique_so_groupings = info.first;
 
+    std::vector<Vector3> omegas;
+    std::vector<bool> verbose_flags;
     for (const auto& so_grouping : unique_so_groupings)
     {
       if (so_grouping.empty())
         continue;
 
       const size_t master_dir_id = so_grouping.front();
-      const auto& omega = quadrature->omegas_[master_dir_id];
+      omegas.push_back(quadrature->omegas_[master_dir_id]);
 
       bool verbose = false;
       if (not verbose_sweep_angles_.empty())
@@ -959,22 +980,17 @@ DiscreteOrdinatesSolver::InitializeSweepDataStructures()
             verbose = true;
             break;
           }
-
-      if (sweep_type_ == "AAH")
-      {
-        const auto new_swp_order = std::make_shared<SPDS_AdamsAdamsHawkins>(
-          omega, *this->grid_ptr_, quadrature_allow_cycles_map_[quadrature], verbose);
-        quadrature_spds_map_[quadrature].push_back(new_swp_order);
-      }
-      else if (sweep_type_ == "CBC")
-      {
-        const auto new_swp_order = std::make_shared<CBC_SPDS>(
-          omega, *this->grid_ptr_, quadrature_allow_cycles_map_[quadrature], verbose);
-        quadrature_spds_map_[quadrature].push_back(new_swp_order);
-      }
-      else
-        OpenSnInvalidArgument("Unsupported sweeptype \"" + sweep_type_ + "\"");
+      verbose_flags.push_back(verbose);
     }
+
+    quadrature_spds_map_[quadrature] =
+      BuildSweepOrderings(sweep_type_,
+                          *this->grid_ptr_,
+                          omegas,
+                          verbose_flags,
+                          quadrature_allow_cycles_map_[quadrature],
+                          options_.num_sweep_ordering_threads,
+                          options_.sweep_ordering_cache_folder_name);
   } // quadrature info-pack
 
   // Build FLUDS templates
@@ -1171,6 +1187,77 @@ DiscreteOrdinatesSolver::AssociateSOsAndDirections(const MeshContinuum& grid,
   return {unq_so_grps, dir_id_to_so_map};
 }
 
+void
+DiscreteOrdinatesSolver::SelectPipelinedGroupSubsets(LBSGroupset& groupset)
+{
+  CALI_CXX_MARK_SCOPE("DiscreteOrdinatesSolver::SelectPipelinedGroupSubsets");
+
+  if (sweep_type_ != "AAH")
+  {
+    log.Log0Warning() << "Groupset " << groupset.id_
+                      << ": \"auto_groupset_num_subsets\" is only supported with sweep_type "
+                         "\"AAH\". Keeping "
+                      << groupset.master_num_grp_subsets_ << " group subset(s).";
+    return;
+  }
+
+  // Smaller subsets leave lanes of the batched cell solves idle
+  constexpr size_t min_subset_size = 4;
+
+  const auto& unique_so_groupings = quadrature_unq_so_grouping_map_[groupset.quadrature_].first;
+  const auto& spds_list = quadrature_spds_map_[groupset.quadrature_];
+  const size_t num_groups = groupset.groups_.size();
+
+  // Depth of the sweep, in locations, and number of pipeline fills, one per octant
+  size_t depth = 0;
+  std::set<std::array<bool, 3>> octants;
+  for (const auto& spds : spds_list)
+  {
+    const auto& aah_spds = dynamic_cast<const SPDS_AdamsAdamsHawkins&>(*spds);
+    depth = std::max(depth, aah_spds.GetGlobalSweepPlanes().size());
+    const auto& omega = spds->Omega();
+    octants.insert({omega.x >= 0.0, omega.y >= 0.0, omega.z >= 0.0});
+  }
+
+  // Number of angle sets per group subset
+  size_t num_angle_sets = 0;
+  for (const auto& so_grouping : unique_so_groupings)
+    num_angle_sets += MakeSubSets(so_grouping.size(), groupset.master_num_ang_subsets_).size();
+  const double num_angles_per_angle_set =
+    static_cast<double>(groupset.quadrature_->abscissae_.size()) /
+    static_cast<double>(std::max<size_t>(num_angle_sets, 1));
+
+  // Compute time of an angle set with all groups, on the slowest location
+  double local_flops = 0.0;
+  size_t num_local_nodes = 0;
+  for (const auto& cell : grid_ptr_->local_cells)
+  {
+    const auto& cell_mapping = discretization_->GetCellMapping(cell);
+    local_flops += EstimateCellSolveFlops(cell_mapping.NumNodes(), num_moments_);
+    num_local_nodes += cell_mapping.NumNodes();
+  }
+  const size_t num_local_cells = std::max<size_t>(grid_ptr_->local_cells.size(), 1);
+  const auto avg_num_nodes =
+    static_cast<int>((num_local_nodes + num_local_cells / 2) / num_local_cells);
+  const double local_work_time = local_flops * num_angles_per_angle_set *
+                                 static_cast<double>(num_groups) /
+                                 MeasureCellSolveRate(avg_num_nodes, num_groups);
+  double work_time = 0.0;
+  mpi_comm.all_reduce(local_work_time, work_time, mpi::op::max<double>());
+
+  const double latency = MeasureMessageLatency();
+
+  const size_t num_subsets = PipelinedNumGroupSubsets(
+    num_groups, min_subset_size, octants.size(), depth, num_angle_sets, work_time, latency);
+  groupset.master_num_grp_subsets_ = static_cast<int>(num_subsets);
+  groupset.BuildSubsets();
+
+  log.Log() << "Groupset " << groupset.id_ << ": pipelining " << num_subsets
+            << " group subset(s). Message latency " << latency * 1.0e6
+            << " us, angle set compute time " << work_time * 1.0e6 << " us, sweep depth "
+            << depth << " location(s).";
+}
+
 void
 DiscreteOrdinatesSolver::InitFluxDataStructures(LBSGroupset& groupset)
 {
@@ -1234,7 +1321,8 @@ DiscreteOrdinatesSolver::InitFluxDataStructures(LBSGroupset& groupset)
                                                           angle_indices,
                                                           sweep_boundaries_,
                                                           options_.max_mpi_message_size,
-                                                          *grid_local_comm_set_);
+                                                          *grid_local_comm_set_,
+                                                          options_.use_persistent_sweep_comm);
 
           angle_set_group.AngleSets().push_back(angle_set);
         }
@@ -1283,6 +1371,10 @@ DiscreteOrdinatesSolver::SetSweepChunk(LBSGroupset& groupset)
 
   if (sweep_type_ == "AAH")
   {
+    if (not sweep_geometry_cache_)
+      sweep_geometry_cache_ = std::make_shared<const SweepGeometryCache>(
+        *grid_ptr_, *discretization_, unit_cell_matrices_, cell_transport_views_);
+
     auto sweep_chunk = std::make_shared<AahSweepChunk>(*grid_ptr_,
                                                        *discretization_,
                                                        unit_cell_matrices_,
@@ -1294,7 +1386,8 @@ DiscreteOrdinatesSolver::SetSweepChunk(LBSGroupset& groupset)
                                                        groupset,
                                                        matid_to_xs_map_,
                                                        num_moments_,
-                                                       max_cell_dof_count_);
+                                                       max_cell_dof_count_,
+                                                       sweep_geometry_cache_);
 
     return sweep_chunk;
   }
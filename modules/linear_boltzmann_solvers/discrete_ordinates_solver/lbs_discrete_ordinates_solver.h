@@ -12,6 +12,7 @@ namespace lbs
 {
 
 class CBC_ASynchronousCommunicator;
+class SweepGeometryCache;
 
 /**
  * Base class for Discrete Ordinates solvers. This class mostly establishes utilities related to
@@ -108,6 +109,13 @@ protected:
    */
   void InitializeSweepDataStructures();
 
+  /**
+   * Chooses the number of group subsets of a groupset for pipelined sweeping from the measured
+   * message latency, the estimated compute time of an angle set and the depth of the sweep. See
+   * PipelinedNumGroupSubsets. Requires the sweep orderings. Collective.
+   */
+  void SelectPipelinedGroupSubsets(LBSGroupset& groupset);
+
   /**
    * Initializes fluds_ data structures.
    */
@@ -130,6 +138,9 @@ protected:
   std::map<std::shared_ptr<AngularQuadrature>, std::vector<std::unique_ptr<FLUDSCommonData>>>
     quadrature_fluds_commondata_map_;
 
+  /**Packed cell and face data shared by the AAH sweep chunks of all groupsets.*/
+  std::shared_ptr<const SweepGeometryCache> sweep_geometry_cache_;
+
   std::vector<size_t> verbose_sweep_angles_;
   const std::string sweep_type_;
 
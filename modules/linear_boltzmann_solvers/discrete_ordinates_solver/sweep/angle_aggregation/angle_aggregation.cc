@@ -61,12 +61,7 @@ AngleAggregation::ZeroIncomingDelayedPsi()
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxOld())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                for (auto& val : dofvec)
-                  val = 0.0;
+        Set(rbndry.GetBoundaryFluxOld(), 0.0);
 
     } // if reflecting
   }   // for bndry
@@ -101,7 +96,6 @@ AngleAggregation::InitializeReflectingBCs()
     if (bndry->IsReflecting())
     {
       size_t tot_num_angles = quadrature_->abscissae_.size();
-      size_t num_local_cells = grid_->local_cells.size();
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       const auto& normal = rbndry.Normal();
@@ -163,52 +157,16 @@ AngleAggregation::InitializeReflectingBCs()
             "is not aligned with any reflecting axis of the quadrature.");
       }
 
-      // Initialize storage for all outbound directions
-      auto& heteroflux_new = rbndry.GetBoundaryFluxNew();
-      auto& heteroflux_old = rbndry.GetBoundaryFluxOld();
-      heteroflux_new.clear();
-      heteroflux_old.clear();
-      heteroflux_new.resize(tot_num_angles);
+      // Initialize storage for the outbound directions that are reflected into an inbound
+      // direction. Outbound directions that no inbound direction maps to are never read.
+      std::vector<bool> stored_angles(tot_num_angles, false);
+      const auto& index_map = rbndry.GetReflectedAngleIndexMap();
       for (int n = 0; n < tot_num_angles; ++n)
-      {
-        // Only continue if omega is outgoing
         if (quadrature_->omegas_[n].Dot(rbndry.Normal()) < 0.0)
-          continue;
+          if (quadrature_->omegas_[index_map[n]].Dot(rbndry.Normal()) >= 0.0)
+            stored_angles[index_map[n]] = true;
 
-        // For cells
-        auto& cell_vec = heteroflux_new[n];
-        cell_vec.resize(num_local_cells);
-        for (const auto& cell : grid_->local_cells)
-        {
-          const uint64_t c = cell.local_id_;
-
-          // Check cell on ref bndry
-          bool on_ref_bndry = false;
-          for (const auto& face : cell.faces_)
-          {
-            if ((not face.has_neighbor_) and (face.normal_.Dot(rbndry.Normal()) > 0.999999))
-            {
-              on_ref_bndry = true;
-              break;
-            }
-          }
-          if (not on_ref_bndry)
-            continue;
-
-          // If cell on ref bndry
-          cell_vec[c].resize(cell.faces_.size());
-          int f = 0;
-          for (const auto& face : cell.faces_)
-          {
-            if ((not face.has_neighbor_) and (face.normal_.Dot(rbndry.Normal()) > 0.999999))
-            {
-              cell_vec[c][f].clear();
-              cell_vec[c][f].resize(face.vertex_ids_.size(), std::vector<double>(num_groups_, 0.0));
-            }
-            ++f;
-          }
-        } // for cells
-      }   // for angles
+      rbndry.InitializeFluxStorage(*grid_, num_groups_, stored_angles);
 
       // Determine if boundary is opposing reflecting
       // The boundary with the smallest bid will
@@ -260,11 +218,7 @@ AngleAggregation::GetNumDelayedAngularDOFs()
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxNew())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                local_ang_unknowns += dofvec.size();
+        local_ang_unknowns += rbndry.GetBoundaryFluxNew().size();
 
     } // if reflecting
   }   // for bndry
@@ -302,15 +256,11 @@ AngleAggregation::AppendNewDelayedAngularDOFsToArray(int64_t& index, double* x_r
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxNew())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                for (auto val : dofvec)
-                {
-                  index++;
-                  x_ref[index] = val;
-                }
+        for (auto val : rbndry.GetBoundaryFluxNew())
+        {
+          index++;
+          x_ref[index] = val;
+        }
 
     } // if reflecting
   }   // for bndry
@@ -348,15 +298,11 @@ AngleAggregation::AppendOldDelayedAngularDOFsToArray(int64_t& index, double* x_r
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxOld())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                for (auto val : dofvec)
-                {
-                  index++;
-                  x_ref[index] = val;
-                }
+        for (auto val : rbndry.GetBoundaryFluxOld())
+        {
+          index++;
+          x_ref[index] = val;
+        }
 
     } // if reflecting
   }   // for bndry
@@ -394,15 +340,11 @@ AngleAggregation::SetOldDelayedAngularDOFsFromArray(int64_t& index, const double
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxOld())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                for (auto& val : dofvec)
-                {
-                  index++;
-                  val = x_ref[index];
-                }
+        for (auto& val : rbndry.GetBoundaryFluxOld())
+        {
+          index++;
+          val = x_ref[index];
+        }
 
     } // if reflecting
   }   // for bndry
@@ -440,15 +382,11 @@ AngleAggregation::SetNewDelayedAngularDOFsFromArray(int64_t& index, const double
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxNew())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                for (auto& val : dofvec)
-                {
-                  index++;
-                  val = x_ref[index];
-                }
+        for (auto& val : rbndry.GetBoundaryFluxNew())
+        {
+          index++;
+          val = x_ref[index];
+        }
 
     } // if reflecting
   }   // for bndry
@@ -491,12 +429,8 @@ AngleAggregation::GetNewDelayedAngularDOFsAsSTLVector()
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxNew())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                for (auto val : dofvec)
-                  psi_vector.push_back(val);
+        for (auto val : rbndry.GetBoundaryFluxNew())
+          psi_vector.push_back(val);
 
     } // if reflecting
   }   // for bndry
@@ -539,12 +473,8 @@ AngleAggregation::SetNewDelayedAngularDOFsFromSTLVector(const std::vector<double
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxNew())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                for (auto& val : dofvec)
-                  val = stl_vector[index++];
+        for (auto& val : rbndry.GetBoundaryFluxNew())
+          val = stl_vector[index++];
 
     } // if reflecting
   }   // for bndry
@@ -581,12 +511,8 @@ AngleAggregation::GetOldDelayedAngularDOFsAsSTLVector()
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxOld())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                for (auto val : dofvec)
-                  psi_vector.push_back(val);
+        for (auto val : rbndry.GetBoundaryFluxOld())
+          psi_vector.push_back(val);
 
     } // if reflecting
   }   // for bndry
@@ -629,12 +555,8 @@ AngleAggregation::SetOldDelayedAngularDOFsFromSTLVector(const std::vector<double
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxOld())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                for (auto& val : dofvec)
-                  val = stl_vector[index++];
+        for (auto& val : rbndry.GetBoundaryFluxOld())
+          val = stl_vector[index++];
 
     } // if reflecting
   }   // for bndry
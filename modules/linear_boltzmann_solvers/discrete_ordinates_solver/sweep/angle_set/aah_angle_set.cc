@@ -6,6 +6,7 @@
 #include "framework/logging/log.h"
 #include "framework/runtime.h"
 #include "caliper/cali.h"
+#include <chrono>
 
 namespace opensn
 {
@@ -20,12 +21,24 @@ AAH_AngleSet::AAH_AngleSet(size_t id,
                            std::vector<size_t>& angle_indices,
                            std::map<uint64_t, std::shared_ptr<SweepBoundary>>& boundaries,
                            int maximum_message_size,
-                           const MPICommunicatorSet& comm_set)
+                           const MPICommunicatorSet& comm_set,
+                           bool use_persistent_comm)
   : AngleSet(id, num_groups, spds, fluds, angle_indices, boundaries, group_subset),
-    async_comm_(*fluds, num_groups_, angle_indices.size(), maximum_message_size, comm_set)
+    async_comm_(*fluds,
+                num_groups_,
+                angle_indices.size(),
+                maximum_message_size,
+                comm_set,
+                use_persistent_comm)
 {
 }
 
+AsynchronousCommunicator*
+AAH_AngleSet::GetCommunicator()
+{
+  return static_cast<AsynchronousCommunicator*>(&async_comm_);
+}
+
 void
 AAH_AngleSet::InitializeDelayedUpstreamData()
 {
@@ -59,25 +72,39 @@ AAH_AngleSet::AngleSetAdvance(SweepChunk& sweep_chunk, AngleSetStatus permission
     return status;
   else if (status == AngleSetStatus::READY_TO_EXECUTE and permission == AngleSetStatus::EXECUTE)
   {
-    async_comm_.InitializeLocalAndDownstreamBuffers();
-
+    BeginExecution();
+    const auto start_time = std::chrono::steady_clock::now();
     sweep_chunk.Sweep(*this); // Execute chunk
+    execution_time_ +=
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+    EndExecution();
 
-    // Send outgoing psi and clear local and receive buffers
-    async_comm_.SendDownstreamPsi(static_cast<int>(this->GetID()));
-    async_comm_.ClearLocalAndReceiveBuffers();
-
-    // Update boundary readiness
-    for (auto& [bid, boundary] : boundaries_)
-      boundary->UpdateAnglesReadyStatus(angles_, group_subset_);
-
-    executed_ = true;
     return AngleSetStatus::FINISHED;
   }
   else
     return AngleSetStatus::READY_TO_EXECUTE;
 }
 
+void
+AAH_AngleSet::BeginExecution()
+{
+  async_comm_.InitializeLocalAndDownstreamBuffers();
+}
+
+void
+AAH_AngleSet::EndExecution()
+{
+  // Send outgoing psi and clear local and receive buffers
+  async_comm_.SendDownstreamPsi(static_cast<int>(this->GetID()));
+  async_comm_.ClearLocalAndReceiveBuffers();
+
+  // Update boundary readiness
+  for (auto& [bid, boundary] : boundaries_)
+    boundary->UpdateAnglesReadyStatus(angles_, group_subset_);
+
+  executed_ = true;
+}
+
 AngleSetStatus
 AAH_AngleSet::FlushSendBuffers()
 {
@@ -102,6 +129,12 @@ AAH_AngleSet::SetMaxBufferMessages(int count)
   async_comm_.SetMaxNumMessages(count);
 }
 
+void
+AAH_AngleSet::PostReceives()
+{
+  async_comm_.PostReceives(static_cast<int>(this->GetID()));
+}
+
 void
 AAH_AngleSet::ResetSweepBuffers()
 {
@@ -26,7 +26,10 @@ public:
                std::vector<size_t>& angle_indices,
                std::map<uint64_t, std::shared_ptr<SweepBoundary>>& boundaries,
                int maximum_message_size,
-               const MPICommunicatorSet& in_comm_set);
+               const MPICommunicatorSet& in_comm_set,
+               bool use_persistent_comm = false);
+
+  AsynchronousCommunicator* GetCommunicator() override;
 
   void InitializeDelayedUpstreamData() override;
 
@@ -38,6 +41,12 @@ public:
 
   AngleSetStatus FlushSendBuffers() override;
 
+  void BeginExecution() override;
+
+  void EndExecution() override;
+
+  void PostReceives() override;
+
   void ResetSweepBuffers() override;
 
   bool ReceiveDelayedData() override;
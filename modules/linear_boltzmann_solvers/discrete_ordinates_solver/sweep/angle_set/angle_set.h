@@ -29,6 +29,9 @@ protected:
   std::map<uint64_t, std::shared_ptr<SweepBoundary>>& boundaries_;
   const size_t group_subset_;
   bool executed_ = false;
+  double execution_time_ = 0.0;
+  double poll_time_ = 0.0;
+  size_t num_idle_advances_ = 0;
 
 public:
   AngleSet(size_t id,
@@ -70,6 +73,30 @@ public:
 
   size_t GetNumAngles() const { return angles_.size(); }
 
+  /**Returns the wall time, in seconds, spent executing sweep chunks since the last reset.*/
+  double GetExecutionTime() const { return execution_time_; }
+
+  /**Adds to the execution time. Used when the sweep chunk is executed outside of
+   * AngleSetAdvance.*/
+  void AddExecutionTime(double time) { execution_time_ += time; }
+
+  /**Returns the wall time, in seconds, spent receiving and sending messages in AngleSetAdvance
+   * since the last reset. Only tracked by angle sets that poll their communicator.*/
+  double GetPollTime() const { return poll_time_; }
+
+  /**Returns the number of calls to AngleSetAdvance, since the last reset, that could not execute
+   * any work because it was all waiting on upstream data. Only tracked by angle sets that poll
+   * their communicator.*/
+  size_t GetNumIdleAdvances() const { return num_idle_advances_; }
+
+  /**Resets the execution time, the poll time and the number of idle advances.*/
+  void ResetCounters()
+  {
+    execution_time_ = 0.0;
+    poll_time_ = 0.0;
+    num_idle_advances_ = 0;
+  }
+
   virtual AsynchronousCommunicator* GetCommunicator()
   {
     OpenSnLogicalError("Method not implemented");
@@ -90,6 +117,19 @@ public:
 
   virtual AngleSetStatus FlushSendBuffers() = 0;
 
+  /**Prepares the angleset for the execution of a sweep chunk that is performed outside of
+   * AngleSetAdvance, e.g., on a worker thread. Must only be called once AngleSetAdvance has
+   * reported READY_TO_EXECUTE, and from the thread that performs the communication.*/
+  virtual void BeginExecution() { OpenSnLogicalError("Method not implemented"); }
+
+  /**Completes an execution started with BeginExecution after the sweep chunk has finished.
+   * Sends downstream data, updates boundary readiness and marks the angleset as executed.*/
+  virtual void EndExecution() { OpenSnLogicalError("Method not implemented"); }
+
+  /**Posts the receives for the upcoming sweep ahead of time, if the angleset supports it. This
+   * gets called by the sweep scheduler for all anglesets before any of them executes.*/
+  virtual void PostReceives() {}
+
   /**Resets the sweep buffer.*/
   virtual void ResetSweepBuffers() = 0;
 
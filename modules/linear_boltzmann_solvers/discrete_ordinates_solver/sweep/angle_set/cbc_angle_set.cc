@@ -10,6 +10,7 @@
 #include "framework/logging/log.h"
 #include "framework/runtime.h"
 #include "caliper/cali.h"
+#include <chrono>
 
 namespace opensn
 {
@@ -46,51 +47,69 @@ CBC_AngleSet::AngleSetAdvance(SweepChunk& sweep_chunk, AngleSetStatus permission
   if (executed_)
     return Status::FINISHED;
 
-  if (current_task_list_.empty())
-    current_task_list_ = cbc_spds_.TaskList();
+  const auto& task_list = cbc_spds_.TaskList();
+  if (not tasks_initialized_)
+  {
+    num_dependencies_.resize(task_list.size());
+    ready_tasks_.clear();
+    ready_tasks_.reserve(task_list.size());
+    for (size_t t = 0; t < task_list.size(); ++t)
+    {
+      num_dependencies_[t] = task_list[t].num_dependencies_;
+      if (num_dependencies_[t] == 0)
+        ready_tasks_.push_back(t);
+    }
+    ready_tasks_begin_ = 0;
+    num_completed_tasks_ = 0;
+    tasks_initialized_ = true;
+  }
 
   sweep_chunk.SetAngleSet(*this);
 
+  auto poll_start = std::chrono::steady_clock::now();
   auto tasks_who_received_data = async_comm_.ReceiveData();
 
   for (const uint64_t task_number : tasks_who_received_data)
-    --current_task_list_[task_number].num_dependencies_;
+    if (--num_dependencies_[task_number] == 0)
+      ready_tasks_.push_back(task_number);
 
   async_comm_.SendData();
+  poll_time_ += std::chrono::duration<double>(std::chrono::steady_clock::now() - poll_start).count();
 
   // Check if boundaries allow for execution
   for (auto& [bid, boundary] : boundaries_)
     if (not boundary->CheckAnglesReadyStatus(angles_, group_subset_))
       return Status::NOT_FINISHED;
 
-  bool all_tasks_completed = true;
-  bool a_task_executed = true;
-  while (a_task_executed)
+  if (ready_tasks_begin_ == ready_tasks_.size() and num_completed_tasks_ < task_list.size())
+    ++num_idle_advances_;
+
+  // Execute ready tasks, releasing successors as their dependencies are satisfied
+  const auto execution_start = std::chrono::steady_clock::now();
+  const bool any_task_ready = ready_tasks_begin_ < ready_tasks_.size();
+  while (ready_tasks_begin_ < ready_tasks_.size())
   {
-    a_task_executed = false;
-    for (auto& cell_task : current_task_list_)
-    {
-      if (not cell_task.completed_)
-        all_tasks_completed = false;
-      if (cell_task.num_dependencies_ == 0 and not cell_task.completed_)
-      {
-        sweep_chunk.SetCell(cell_task.cell_ptr_, *this);
-        sweep_chunk.Sweep(*this);
-
-        for (uint64_t local_task_num : cell_task.successors_)
-          --current_task_list_[local_task_num].num_dependencies_;
-
-        cell_task.completed_ = true;
-        a_task_executed = true;
-        async_comm_.SendData();
-      }
-    } // for cell_task
+    const auto& cell_task = task_list[ready_tasks_[ready_tasks_begin_++]];
+
+    sweep_chunk.SetCell(cell_task.cell_ptr_, *this);
+    sweep_chunk.Sweep(*this);
+
+    for (uint64_t local_task_num : cell_task.successors_)
+      if (--num_dependencies_[local_task_num] == 0)
+        ready_tasks_.push_back(local_task_num);
+
+    ++num_completed_tasks_;
     async_comm_.SendData();
   }
+  if (any_task_ready)
+    execution_time_ +=
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - execution_start).count();
 
+  poll_start = std::chrono::steady_clock::now();
   const bool all_messages_sent = async_comm_.SendData();
+  poll_time_ += std::chrono::duration<double>(std::chrono::steady_clock::now() - poll_start).count();
 
-  if (all_tasks_completed and all_messages_sent)
+  if (num_completed_tasks_ == task_list.size() and all_messages_sent)
   {
     // Update boundary readiness
     for (auto& [bid, boundary] : boundaries_)
@@ -105,7 +124,7 @@ CBC_AngleSet::AngleSetAdvance(SweepChunk& sweep_chunk, AngleSetStatus permission
 void
 CBC_AngleSet::ResetSweepBuffers()
 {
-  current_task_list_.clear();
+  tasks_initialized_ = false;
   async_comm_.Reset();
   fluds_->ClearLocalAndReceivePsi();
   executed_ = false;
@@ -18,9 +18,18 @@ class CBC_AngleSet : public AngleSet
 {
 protected:
   const CBC_SPDS& cbc_spds_;
-  std::vector<Task> current_task_list_;
   CBC_ASynchronousCommunicator async_comm_;
 
+  // Remaining number of dependencies per task (indexed by task number in the SPDS task list).
+  // Allocated once and re-initialized from the SPDS task list at the start of every sweep.
+  std::vector<unsigned int> num_dependencies_;
+  // FIFO of tasks whose dependencies are all satisfied. Entries before ready_tasks_begin_ have
+  // been executed.
+  std::vector<uint64_t> ready_tasks_;
+  size_t ready_tasks_begin_ = 0;
+  size_t num_completed_tasks_ = 0;
+  bool tasks_initialized_ = false;
+
 public:
   CBC_AngleSet(size_t id,
                size_t num_groups,
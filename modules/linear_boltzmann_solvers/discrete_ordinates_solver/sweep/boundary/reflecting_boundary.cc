@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: MIT
 
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/boundary/reflecting_boundary.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
 #include "framework/logging/log.h"
 #include "caliper/cali.h"
 
@@ -10,6 +11,59 @@ namespace opensn
 namespace lbs
 {
 
+void
+ReflectingBoundary::InitializeFluxStorage(const MeshContinuum& grid,
+                                          size_t num_groups,
+                                          const std::vector<bool>& stored_angles)
+{
+  storage_num_groups_ = num_groups;
+
+  // Offsets of the boundary faces within a single angle block
+  const size_t num_local_cells = grid.local_cells.size();
+  cell_face_index_.assign(num_local_cells + 1, 0);
+  face_offsets_.clear();
+  int64_t angle_block_size = 0;
+  for (const auto& cell : grid.local_cells)
+  {
+    const uint64_t c = cell.local_id_;
+
+    bool on_ref_bndry = false;
+    for (const auto& face : cell.faces_)
+      if ((not face.has_neighbor_) and (face.normal_.Dot(normal_) > 0.999999))
+      {
+        on_ref_bndry = true;
+        break;
+      }
+
+    cell_face_index_[c + 1] = on_ref_bndry ? cell.faces_.size() : 0;
+    if (not on_ref_bndry)
+      continue;
+
+    for (const auto& face : cell.faces_)
+    {
+      if ((not face.has_neighbor_) and (face.normal_.Dot(normal_) > 0.999999))
+      {
+        face_offsets_.push_back(angle_block_size);
+        angle_block_size += static_cast<int64_t>(face.vertex_ids_.size() * num_groups);
+      }
+      else
+        face_offsets_.push_back(-1);
+    }
+  }
+  for (size_t c = 0; c < num_local_cells; ++c)
+    cell_face_index_[c + 1] += cell_face_index_[c];
+
+  // Offsets of the stored angle blocks
+  angle_offsets_.assign(stored_angles.size(), -1);
+  int64_t num_stored_angles = 0;
+  for (size_t n = 0; n < stored_angles.size(); ++n)
+    if (stored_angles[n])
+      angle_offsets_[n] = angle_block_size * num_stored_angles++;
+
+  boundary_flux_.assign(angle_block_size * num_stored_angles, 0.0);
+  boundary_flux_old_.clear();
+}
+
 double*
 ReflectingBoundary::PsiIncoming(uint64_t cell_local_id,
                                 unsigned int face_num,
@@ -18,20 +72,15 @@ ReflectingBoundary::PsiIncoming(uint64_t cell_local_id,
                                 int group_num,
                                 size_t gs_ss_begin)
 {
-  double* psi = nullptr;
-
-  int reflected_angle_num = reflected_anglenum_[angle_num];
+  const int reflected_angle_num = reflected_anglenum_[angle_num];
+  const size_t address = angle_offsets_[reflected_angle_num] +
+                         face_offsets_[cell_face_index_[cell_local_id] + face_num] +
+                         fi * storage_num_groups_ + gs_ss_begin;
 
   if (opposing_reflected_)
-  {
-    psi = &boundary_flux_old_[reflected_angle_num][cell_local_id][face_num][fi][gs_ss_begin];
-  }
+    return &boundary_flux_old_[address];
   else
-  {
-    psi = &boundary_flux_[reflected_angle_num][cell_local_id][face_num][fi][gs_ss_begin];
-  }
-
-  return psi;
+    return &boundary_flux_[address];
 }
 
 double*
@@ -41,7 +90,19 @@ ReflectingBoundary::PsiOutgoing(uint64_t cell_local_id,
                                 unsigned int angle_num,
                                 size_t gs_ss_begin)
 {
-  return &boundary_flux_[angle_num][cell_local_id][face_num][fi][gs_ss_begin];
+  // Outgoing angles that are never reflected back are not stored. Their values are written to a
+  // scratch buffer and discarded.
+  if (angle_offsets_[angle_num] < 0)
+  {
+    thread_local std::vector<double> discarded_psi;
+    discarded_psi.resize(storage_num_groups_);
+    return &discarded_psi[gs_ss_begin];
+  }
+
+  const size_t address = angle_offsets_[angle_num] +
+                         face_offsets_[cell_face_index_[cell_local_id] + face_num] +
+                         fi * storage_num_groups_ + gs_ss_begin;
+  return &boundary_flux_[address];
 }
 
 void
@@ -58,7 +119,7 @@ ReflectingBoundary::CheckAnglesReadyStatus(const std::vector<size_t>& angles, si
     return true;
   bool ready_flag = true;
   for (auto& n : angles)
-    if (not boundary_flux_[reflected_anglenum_[n]].empty())
+    if (IsAngleStored(reflected_anglenum_[n]))
       if (not angle_readyflags_[n][gs_ss])
         return false;
 
@@ -68,7 +129,8 @@ ReflectingBoundary::CheckAnglesReadyStatus(const std::vector<size_t>& angles, si
 void
 ReflectingBoundary::ResetAnglesReadyStatus()
 {
-  boundary_flux_old_ = boundary_flux_;
+  if (opposing_reflected_)
+    boundary_flux_old_ = boundary_flux_;
 
   for (auto& flags : angle_readyflags_)
     for (int gs_ss = 0; gs_ss < flags.size(); ++gs_ss)
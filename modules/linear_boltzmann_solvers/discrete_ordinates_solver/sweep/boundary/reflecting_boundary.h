@@ -21,19 +21,21 @@ protected:
   const opensn::Normal normal_;
   bool opposing_reflected_ = false;
 
-  /// Groups per DOF
-  typedef std::vector<double> DOFVec;
-  /// DOFs per face
-  typedef std::vector<DOFVec> FaceVec;
-  /// Faces per cell
-  typedef std::vector<FaceVec> CellVec;
-  /// Cell per angle
-  typedef std::vector<CellVec> AngVec;
-
-  // angle,cell,face,dof,group
-  // Populated by angle aggregation
-  std::vector<AngVec> boundary_flux_;
-  std::vector<AngVec> boundary_flux_old_;
+  /**
+   * Boundary angular fluxes for every stored angle, boundary face, face node and group, stored
+   * contiguously in that order (group fastest). The old copy is only kept for opposing reflecting
+   * boundaries, the only ones that read it.
+   */
+  std::vector<double> boundary_flux_;
+  std::vector<double> boundary_flux_old_;
+
+  /// Offset of each angle's block in the flux arrays, or -1 if the angle is not stored.
+  std::vector<int64_t> angle_offsets_;
+  /// For each local cell, the index of its first face in face_offsets_ (size num_cells + 1).
+  std::vector<size_t> cell_face_index_;
+  /// Offset of each face within an angle block, or -1 if the face is not on this boundary.
+  std::vector<int64_t> face_offsets_;
+  size_t storage_num_groups_ = 0;
 
   std::vector<int> reflected_anglenum_;
   std::vector<std::vector<bool>> angle_readyflags_;
@@ -52,9 +54,25 @@ public:
 
   void SetOpposingReflected(bool value) { opposing_reflected_ = value; }
 
-  std::vector<AngVec>& GetBoundaryFluxNew() { return boundary_flux_; }
+  /**
+   * Allocates zeroed flux storage for the angles `n` with `stored_angles[n]` true on every face of
+   * the local cells of `grid` that lies on this boundary.
+   */
+  void InitializeFluxStorage(const MeshContinuum& grid,
+                             size_t num_groups,
+                             const std::vector<bool>& stored_angles);
+
+  /**
+   * Returns true if flux storage was allocated for the given angle.
+   */
+  bool IsAngleStored(unsigned int angle_num) const
+  {
+    return angle_offsets_.size() > angle_num and angle_offsets_[angle_num] >= 0;
+  }
+
+  std::vector<double>& GetBoundaryFluxNew() { return boundary_flux_; }
 
-  std::vector<AngVec>& GetBoundaryFluxOld() { return boundary_flux_old_; }
+  std::vector<double>& GetBoundaryFluxOld() { return boundary_flux_old_; }
 
   std::vector<int>& GetReflectedAngleIndexMap() { return reflected_anglenum_; }
 
@@ -43,5 +43,39 @@ CommunicateLocationDependencies(const std::vector<int>& location_dependencies,
   }
 }
 
+void
+CommunicateLocationDependencies(const std::vector<const std::vector<int>*>& location_dependencies,
+                                std::vector<std::vector<std::vector<int>>>& global_dependencies)
+{
+  CALI_CXX_MARK_FUNCTION;
+
+  const int P = opensn::mpi_comm.size();
+  const size_t num_orderings = location_dependencies.size();
+
+  // Serialize as, per sweep ordering, the dependency count followed by the dependencies
+  std::vector<int> raw_local_dependencies;
+  for (const auto* dependencies : location_dependencies)
+  {
+    raw_local_dependencies.push_back(static_cast<int>(dependencies->size()));
+    raw_local_dependencies.insert(
+      raw_local_dependencies.end(), dependencies->begin(), dependencies->end());
+  }
+
+  std::vector<int> raw_dependencies;
+  mpi_comm.all_gather(raw_local_dependencies, raw_dependencies);
+
+  // De-serialize, location by location
+  global_dependencies.assign(num_orderings, std::vector<std::vector<int>>(P));
+  size_t addr = 0;
+  for (int locI = 0; locI < P; ++locI)
+    for (size_t d = 0; d < num_orderings; ++d)
+    {
+      const int count = raw_dependencies[addr++];
+      global_dependencies[d][locI].assign(raw_dependencies.begin() + addr,
+                                          raw_dependencies.begin() + addr + count);
+      addr += count;
+    }
+}
+
 } // namespace lbs
 } // namespace opensn
@@ -15,11 +15,31 @@ namespace opensn
 namespace lbs
 {
 
+namespace
+{
+
+/**Adds the number of messages and bytes of a message structure to the given counters.*/
+void
+CountMessages(const std::vector<std::vector<std::tuple<int, size_t, size_t>>>& msg_data,
+              size_t& num_messages,
+              size_t& num_bytes)
+{
+  for (const auto& location_msg_data : msg_data)
+    for (const auto& [peer, size, block_pos] : location_msg_data)
+    {
+      ++num_messages;
+      num_bytes += size * sizeof(double);
+    }
+}
+
+} // namespace
+
 AAH_ASynchronousCommunicator::AAH_ASynchronousCommunicator(FLUDS& fluds,
                                                            size_t num_groups,
                                                            size_t num_angles,
                                                            size_t max_mpi_message_size,
-                                                           const MPICommunicatorSet& comm_set)
+                                                           const MPICommunicatorSet& comm_set,
+                                                           bool use_persistent_comm)
   : AsynchronousCommunicator(fluds, comm_set),
     num_groups_(num_groups),
     num_angles_(num_angles),
@@ -27,11 +47,25 @@ AAH_ASynchronousCommunicator::AAH_ASynchronousCommunicator(FLUDS& fluds,
     max_mpi_message_size_(max_mpi_message_size),
     done_sending_(false),
     data_initialized_(false),
-    upstream_data_initialized_(false)
+    upstream_data_initialized_(false),
+    use_persistent_comm_(use_persistent_comm),
+    receives_posted_(false)
 {
   this->BuildMessageStructure();
 }
 
+AAH_ASynchronousCommunicator::~AAH_ASynchronousCommunicator()
+{
+  int finalized = 0;
+  MPI_Finalized(&finalized);
+  if (finalized)
+    return;
+
+  FreePersistentRequests(preloc_requests_);
+  FreePersistentRequests(delayed_preloc_requests_);
+  FreePersistentRequests(deploc_requests_);
+}
+
 bool
 AAH_ASynchronousCommunicator::DoneSending() const
 {
@@ -41,7 +75,11 @@ AAH_ASynchronousCommunicator::DoneSending() const
 void
 AAH_ASynchronousCommunicator::ClearLocalAndReceiveBuffers()
 {
-  fluds_.ClearLocalAndReceivePsi();
+  // Persistent receives stay bound to the upstream buffers, so only the local psi is released
+  if (use_persistent_comm_)
+    fluds_.ClearLocalPsi();
+  else
+    fluds_.ClearLocalAndReceivePsi();
 }
 
 void
@@ -50,6 +88,13 @@ AAH_ASynchronousCommunicator::ClearDownstreamBuffers()
   if (done_sending_)
     return;
 
+  // Persistent sends stay bound to the downstream buffers, so these are kept for the next sweep
+  if (use_persistent_comm_)
+  {
+    done_sending_ = TestPersistentRequests(deploc_requests_);
+    return;
+  }
+
   if (not mpi::test_all(deploc_msg_request_))
     return;
 
@@ -64,6 +109,7 @@ AAH_ASynchronousCommunicator::Reset()
   done_sending_ = false;
   data_initialized_ = false;
   upstream_data_initialized_ = false;
+  receives_posted_ = false;
 
   for (auto& rcv_flags : preloc_msg_received_)
     rcv_flags.assign(rcv_flags.size(), false);
@@ -80,9 +126,11 @@ AAH_ASynchronousCommunicator::BuildMessageStructure()
   const auto& spds = fluds_.GetSPDS();
   const auto& fluds = dynamic_cast<AAH_FLUDS&>(fluds_);
 
+  // Pre-posted receives do not rely on MPI buffering unexpected messages, so with persistent
+  // communication the data for a location is only split when it exceeds the maximum message size
   auto message_count_and_size = [this](const auto num_unknowns)
   {
-    size_t message_count = num_angles_;
+    size_t message_count = use_persistent_comm_ ? 1 : num_angles_;
     if (num_unknowns * 8 > max_mpi_message_size_)
       message_count = ((num_unknowns * 8) + (max_mpi_message_size_ - 1)) / max_mpi_message_size_;
     size_t message_size = (num_unknowns + (message_count - 1)) / message_count;
@@ -195,6 +243,12 @@ AAH_ASynchronousCommunicator::ReceiveDelayedData(int angle_set_num)
 {
   CALI_CXX_MARK_SCOPE("AAH_ASynchronousCommunicator::ReceiveDelayedData");
 
+  if (use_persistent_comm_)
+  {
+    PostReceives(angle_set_num);
+    return TestPersistentRequests(delayed_preloc_requests_);
+  }
+
   const auto& spds = fluds_.GetSPDS();
   const auto& comm = comm_set_.LocICommunicator(opensn::mpi_comm.rank());
   const size_t num_delayed_dependencies = spds.GetDelayedLocationDependencies().size();
@@ -216,7 +270,11 @@ AAH_ASynchronousCommunicator::ReceiveDelayedData(int angle_set_num)
           continue;
         }
         if (not comm.recv<double>(source, tag, &upstream_psi[block_pos], size).error())
+        {
           delayed_preloc_msg_received_[i][m] = true;
+          ++num_messages_received_;
+          num_bytes_received_ += size * sizeof(double);
+        }
       }
     }
   }
@@ -232,6 +290,14 @@ AAH_ASynchronousCommunicator::ReceiveUpstreamPsi(int angle_set_num)
 {
   CALI_CXX_MARK_SCOPE("AAH_ASynchronousCommunicator::ReceiveUpstreamPsi");
 
+  if (use_persistent_comm_)
+  {
+    PostReceives(angle_set_num);
+    if (TestPersistentRequests(preloc_requests_))
+      return AngleSetStatus::READY_TO_EXECUTE;
+    return AngleSetStatus::RECEIVING;
+  }
+
   const auto& spds = fluds_.GetSPDS();
   const auto& comm = comm_set_.LocICommunicator(opensn::mpi_comm.rank());
   const size_t num_dependencies = spds.GetLocationDependencies().size();
@@ -260,7 +326,11 @@ AAH_ASynchronousCommunicator::ReceiveUpstreamPsi(int angle_set_num)
           continue;
         }
         if (not comm.recv(source, tag, &upstream_psi[block_pos], size).error())
+        {
           preloc_msg_received_[i][m] = true;
+          ++num_messages_received_;
+          num_bytes_received_ += size * sizeof(double);
+        }
       }
     }
 
@@ -276,6 +346,15 @@ AAH_ASynchronousCommunicator::SendDownstreamPsi(int angle_set_num)
 {
   CALI_CXX_MARK_SCOPE("AAH_ASynchronousCommunicator::SendDownstreamPsi");
 
+  if (use_persistent_comm_)
+  {
+    BindPersistentRequests(
+      deploc_requests_, deploc_msg_data_, fluds_.DeplocIOutgoingPsi(), angle_set_num, true);
+    StartPersistentRequests(deploc_requests_);
+    CountMessages(deploc_msg_data_, num_messages_sent_, num_bytes_sent_);
+    return;
+  }
+
   const auto& spds = fluds_.GetSPDS();
   const auto& location_successors = spds.GetLocationSuccessors();
   const size_t num_successors = location_successors.size();
@@ -290,8 +369,133 @@ AAH_ASynchronousCommunicator::SendDownstreamPsi(int angle_set_num)
       const auto& [dest, size, block_pos] = deploc_msg_data_[i][m];
       deploc_msg_request_[req] =
         comm.isend(dest, max_num_messages_ * angle_set_num + m, &outgoing_psi[block_pos], size);
+      ++num_messages_sent_;
+      num_bytes_sent_ += size * sizeof(double);
+    }
+  }
+}
+
+void
+AAH_ASynchronousCommunicator::PostReceives(int angle_set_num)
+{
+  if (not use_persistent_comm_ or receives_posted_)
+    return;
+
+  CALI_CXX_MARK_SCOPE("AAH_ASynchronousCommunicator::PostReceives");
+
+  // Allocate FLUDS non-local incoming data. The buffers are kept across sweeps.
+  if (not upstream_data_initialized_)
+  {
+    const auto& spds = fluds_.GetSPDS();
+    fluds_.AllocatePrelocIOutgoingPsi(
+      num_groups_, num_angles_, spds.GetLocationDependencies().size());
+    upstream_data_initialized_ = true;
+  }
+
+  BindPersistentRequests(
+    preloc_requests_, preloc_msg_data_, fluds_.PrelocIOutgoingPsi(), angle_set_num, false);
+  BindPersistentRequests(delayed_preloc_requests_,
+                         delayed_preloc_msg_data_,
+                         fluds_.DelayedPrelocIOutgoingPsi(),
+                         angle_set_num,
+                         false);
+
+  StartPersistentRequests(preloc_requests_);
+  StartPersistentRequests(delayed_preloc_requests_);
+  receives_posted_ = true;
+
+  // Pre-posted receives all complete within the sweep, so they are counted when posted
+  CountMessages(preloc_msg_data_, num_messages_received_, num_bytes_received_);
+  CountMessages(delayed_preloc_msg_data_, num_messages_received_, num_bytes_received_);
+}
+
+void
+AAH_ASynchronousCommunicator::BindPersistentRequests(PersistentRequests& requests,
+                                                     const MessageData& msg_data,
+                                                     std::vector<std::vector<double>>& buffers,
+                                                     int angle_set_num,
+                                                     bool send)
+{
+  const int tag_base = static_cast<int>(max_num_messages_) * angle_set_num;
+
+  bool bound = requests.tag_base == tag_base and requests.buffers.size() == msg_data.size();
+  for (size_t i = 0; bound and i < msg_data.size(); ++i)
+    bound = requests.buffers[i] == buffers[i].data();
+  if (bound)
+    return;
+
+  FreePersistentRequests(requests);
+
+  const auto& location_successors = fluds_.GetSPDS().GetLocationSuccessors();
+  const int rank = opensn::mpi_comm.rank();
+  for (size_t i = 0; i < msg_data.size(); ++i)
+  {
+    const auto& comm = comm_set_.LocICommunicator(send ? location_successors[i] : rank);
+    double* buffer = buffers[i].data();
+
+    for (size_t m = 0; m < msg_data[i].size(); ++m)
+    {
+      const auto& [peer, size, block_pos] = msg_data[i][m];
+      const int tag = tag_base + static_cast<int>(m);
+      const int count = static_cast<int>(size);
+
+      MPI_Request request = MPI_REQUEST_NULL;
+      const int err =
+        send ? MPI_Send_init(&buffer[block_pos], count, MPI_DOUBLE, peer, tag, comm, &request)
+             : MPI_Recv_init(&buffer[block_pos], count, MPI_DOUBLE, peer, tag, comm, &request);
+      OpenSnLogicalErrorIf(err != MPI_SUCCESS, "Failed to create a persistent sweep request.");
+      requests.requests.push_back(request);
     }
+    requests.buffers.push_back(buffer);
   }
+  requests.tag_base = tag_base;
+}
+
+void
+AAH_ASynchronousCommunicator::StartPersistentRequests(PersistentRequests& requests)
+{
+  if (requests.requests.empty())
+    return;
+
+  const int err =
+    MPI_Startall(static_cast<int>(requests.requests.size()), requests.requests.data());
+  OpenSnLogicalErrorIf(err != MPI_SUCCESS, "Failed to start persistent sweep requests.");
+  requests.num_pending = requests.requests.size();
+}
+
+bool
+AAH_ASynchronousCommunicator::TestPersistentRequests(PersistentRequests& requests)
+{
+  if (requests.num_pending == 0)
+    return true;
+
+  // Requests that already completed are inactive and ignored by MPI_Testsome
+  completed_indices_.resize(requests.requests.size());
+  int num_completed = 0;
+  const int err = MPI_Testsome(static_cast<int>(requests.requests.size()),
+                               requests.requests.data(),
+                               &num_completed,
+                               completed_indices_.data(),
+                               MPI_STATUSES_IGNORE);
+  OpenSnLogicalErrorIf(err != MPI_SUCCESS, "Failed to test persistent sweep requests.");
+
+  if (num_completed != MPI_UNDEFINED)
+    requests.num_pending -= num_completed;
+
+  return requests.num_pending == 0;
+}
+
+void
+AAH_ASynchronousCommunicator::FreePersistentRequests(PersistentRequests& requests)
+{
+  for (auto& request : requests.requests)
+    if (request != MPI_REQUEST_NULL)
+      MPI_Request_free(&request);
+
+  requests.requests.clear();
+  requests.buffers.clear();
+  requests.tag_base = -1;
+  requests.num_pending = 0;
 }
 
 void
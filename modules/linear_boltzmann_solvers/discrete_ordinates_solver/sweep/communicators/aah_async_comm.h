@@ -6,6 +6,7 @@
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/communicators/async_comm.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/sweep.h"
 #include "mpicpp-lite/mpicpp-lite.h"
+#include <mpi.h>
 
 namespace mpi = mpicpp_lite;
 
@@ -42,6 +43,28 @@ private:
   std::vector<mpi::Request> deploc_msg_request_;
   std::vector<std::vector<std::tuple<int, size_t, size_t>>> deploc_msg_data_;
 
+  typedef std::vector<std::vector<std::tuple<int, size_t, size_t>>> MessageData;
+
+  /**
+   * A set of persistent requests, one per message, bound to the buffers of a FLUDS. The buffer
+   * base addresses and the tag base the requests were created with are stored so that the
+   * requests can be rebuilt whenever the FLUDS reallocates a buffer or the tags change.
+   */
+  struct PersistentRequests
+  {
+    std::vector<MPI_Request> requests;
+    std::vector<const double*> buffers;
+    int tag_base = -1;
+    size_t num_pending = 0;
+  };
+
+  bool use_persistent_comm_;
+  bool receives_posted_;
+  PersistentRequests preloc_requests_;
+  PersistentRequests delayed_preloc_requests_;
+  PersistentRequests deploc_requests_;
+  std::vector<int> completed_indices_;
+
 protected:
   /**
    * Builds message structure.
@@ -55,12 +78,45 @@ protected:
    */
   void BuildMessageStructure();
 
+  /**
+   * Makes sure `requests` holds one persistent request per message in `msg_data`, bound to the
+   * current addresses of `buffers`. Existing requests are reused when nothing changed since they
+   * were created, otherwise they are freed and recreated.
+   */
+  void BindPersistentRequests(PersistentRequests& requests,
+                              const MessageData& msg_data,
+                              std::vector<std::vector<double>>& buffers,
+                              int angle_set_num,
+                              bool send);
+
+  /**Starts all the requests of a set.*/
+  static void StartPersistentRequests(PersistentRequests& requests);
+
+  /**Completes the requests of a set that are done. Returns true if none are pending.*/
+  bool TestPersistentRequests(PersistentRequests& requests);
+
+  /**Frees all the requests of a set.*/
+  static void FreePersistentRequests(PersistentRequests& requests);
+
 public:
+  /**
+   * When `use_persistent_comm` is true, receives are pre-posted at the start of every sweep as
+   * persistent requests that write directly into the FLUDS upstream buffers, downstream data is
+   * sent with persistent requests, and completion is checked with `MPI_Testsome`. The requests
+   * and the buffers they are bound to are kept alive across sweeps. Otherwise every message is
+   * probed for and received with a blocking receive once it has arrived.
+   */
   AAH_ASynchronousCommunicator(FLUDS& fluds,
                                size_t num_groups,
                                size_t num_angles,
                                size_t max_mpi_message_size,
-                               const MPICommunicatorSet& comm_set);
+                               const MPICommunicatorSet& comm_set,
+                               bool use_persistent_comm = false);
+
+  AAH_ASynchronousCommunicator(const AAH_ASynchronousCommunicator&) = delete;
+  AAH_ASynchronousCommunicator& operator=(const AAH_ASynchronousCommunicator&) = delete;
+
+  ~AAH_ASynchronousCommunicator();
 
   size_t GetMaxNumMessages() const { return max_num_messages_; }
 
@@ -84,6 +140,14 @@ public:
    */
   void InitializeLocalAndDownstreamBuffers();
 
+  /**
+   * Pre-posts the receives for upstream and delayed upstream data of the upcoming sweep. This
+   * is a no-op unless persistent communication is used. Otherwise it is called by the sweep
+   * scheduler before any angle set executes, and lazily by the receive methods if that did not
+   * happen.
+   */
+  void PostReceives(int angle_set_num);
+
   /**
    * Sends downstream psi. This method gets called after a sweep chunk has executed
    */
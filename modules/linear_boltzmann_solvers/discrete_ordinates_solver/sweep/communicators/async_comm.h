@@ -38,9 +38,35 @@ public:
     OpenSnLogicalError("Method not implemented");
   }
 
+  /**Returns the number of messages sent since the last counter reset.*/
+  size_t NumMessagesSent() const { return num_messages_sent_; }
+
+  /**Returns the number of bytes sent since the last counter reset.*/
+  size_t NumBytesSent() const { return num_bytes_sent_; }
+
+  /**Returns the number of messages received since the last counter reset.*/
+  size_t NumMessagesReceived() const { return num_messages_received_; }
+
+  /**Returns the number of bytes received since the last counter reset.*/
+  size_t NumBytesReceived() const { return num_bytes_received_; }
+
+  /**Resets the message counters.*/
+  void ResetCounters()
+  {
+    num_messages_sent_ = 0;
+    num_bytes_sent_ = 0;
+    num_messages_received_ = 0;
+    num_bytes_received_ = 0;
+  }
+
 protected:
   FLUDS& fluds_;
   const MPICommunicatorSet& comm_set_;
+
+  size_t num_messages_sent_ = 0;
+  size_t num_bytes_sent_ = 0;
+  size_t num_messages_received_ = 0;
+  size_t num_bytes_received_ = 0;
 };
 
 } // namespace lbs
@@ -78,6 +78,8 @@ CBC_ASynchronousCommunicator::SendData()
       auto tag = static_cast<int>(angle_set_id_);
       buffer_item.mpi_request_ = comm.isend(dest, tag, buffer_item.data_array_.Data());
       buffer_item.send_initiated_ = true;
+      ++num_messages_sent_;
+      num_bytes_sent_ += buffer_item.data_array_.Size();
     }
 
     if (not buffer_item.completed_)
@@ -113,6 +115,8 @@ CBC_ASynchronousCommunicator::ReceiveData()
       int num_items = status.get_count<std::byte>();
       std::vector<std::byte> recv_buffer(num_items);
       comm.recv(source_rank, status.tag(), recv_buffer.data(), num_items);
+      ++num_messages_received_;
+      num_bytes_received_ += num_items;
       ByteArray data_array(recv_buffer);
 
       while (not data_array.EndOfBuffer())
@@ -175,6 +175,13 @@ AAH_FLUDS::ClearLocalAndReceivePsi()
   prelocI_outgoing_psi_.swap(empty_vector);
 }
 
+void
+AAH_FLUDS::ClearLocalPsi()
+{
+  auto empty_vector = std::vector<std::vector<double>>(0);
+  local_psi_.swap(empty_vector);
+}
+
 void
 AAH_FLUDS::ClearSendPsi()
 {
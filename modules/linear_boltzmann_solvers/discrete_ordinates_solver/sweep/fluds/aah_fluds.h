@@ -67,6 +67,7 @@ public:
   size_t GetDeplocIFaceDOFCount(int deplocI) const;
 
   void ClearLocalAndReceivePsi() override;
+  void ClearLocalPsi() override;
   void ClearSendPsi() override;
   void AllocateInternalLocalPsi(size_t num_grps, size_t num_angles) override;
   void AllocateOutgoingPsi(size_t num_grps, size_t num_angles, size_t num_loc_sucs) override;
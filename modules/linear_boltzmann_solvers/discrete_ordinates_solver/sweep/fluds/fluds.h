@@ -31,6 +31,7 @@ public:
   const SPDS& GetSPDS() const { return spds_; }
 
   virtual void ClearLocalAndReceivePsi() {}
+  virtual void ClearLocalPsi() {}
   virtual void ClearSendPsi() {}
   virtual void AllocateInternalLocalPsi(size_t num_grps, size_t num_angles) {}
   virtual void AllocateOutgoingPsi(size_t num_grps, size_t num_angles, size_t num_loc_sucs) {}
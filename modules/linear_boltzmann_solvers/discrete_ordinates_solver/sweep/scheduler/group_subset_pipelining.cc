@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/scheduler/group_subset_pipelining.h"
+#include "framework/math/batched_gauss_elimination.h"
+#include "framework/runtime.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+namespace opensn
+{
+namespace lbs
+{
+
+double
+EstimateCellSolveFlops(size_t num_nodes, size_t num_moments)
+{
+  const auto n = static_cast<double>(num_nodes);
+  return 2.0 * n * n * n / 3.0 + 10.0 * n * n + 2.0 * n * static_cast<double>(num_moments);
+}
+
+double
+MeasureCellSolveRate(int num_nodes, size_t num_systems)
+{
+  const size_t n = std::max(num_nodes, 1);
+  const size_t ns = std::max<size_t>(num_systems, 1);
+
+  // Diagonally dominant systems, so that elimination without pivoting is stable
+  std::vector<double> A0(n * n * ns, 1.0);
+  for (size_t i = 0; i < n; ++i)
+    for (size_t s = 0; s < ns; ++s)
+      A0[(i * n + i) * ns + s] = 2.0 * static_cast<double>(n);
+  std::vector<double> A(A0.size()), b(n * ns);
+
+  // Repeat until the timing is well above the clock resolution
+  const double flops_per_solve = EstimateCellSolveFlops(n, 0) * static_cast<double>(ns);
+  size_t num_solves = 0;
+  double elapsed = 0.0;
+  const auto start = std::chrono::steady_clock::now();
+  while (elapsed < 1.0e-3)
+  {
+    for (int r = 0; r < 16; ++r)
+    {
+      std::copy(A0.begin(), A0.end(), A.begin());
+      std::fill(b.begin(), b.end(), 1.0);
+      BatchedGaussElimination(A.data(), b.data(), static_cast<int>(n), ns);
+    }
+    num_solves += 16;
+    elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  return flops_per_solve * static_cast<double>(num_solves) / elapsed;
+}
+
+double
+MeasureMessageLatency()
+{
+  const int num_locations = mpi_comm.size();
+  if (num_locations == 1)
+    return 0.0;
+
+  // Locations are paired as (0,1), (2,3), ... The last location of an odd count idles.
+  const int location_id = mpi_comm.rank();
+  const int partner = location_id ^ 1;
+  const int num_round_trips = 100;
+  const int tag = 0;
+
+  mpi_comm.barrier();
+  double local_latency = 0.0;
+  if (partner < num_locations)
+  {
+    double value = 0.0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < num_round_trips; ++r)
+    {
+      if (location_id < partner)
+      {
+        mpi_comm.send(partner, tag, value);
+        mpi_comm.recv(partner, tag, value);
+      }
+      else
+      {
+        mpi_comm.recv(partner, tag, value);
+        mpi_comm.send(partner, tag, value);
+      }
+    }
+    const double elapsed =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    local_latency = elapsed / (2.0 * num_round_trips);
+  }
+
+  double latency = 0.0;
+  mpi_comm.all_reduce(local_latency, latency, mpi::op::max<double>());
+  return latency;
+}
+
+size_t
+PipelinedNumGroupSubsets(size_t num_groups,
+                         size_t min_subset_size,
+                         size_t num_fills,
+                         size_t depth,
+                         size_t num_angle_sets,
+                         double angle_set_work_time,
+                         double latency)
+{
+  const size_t max_num_subsets =
+    std::max<size_t>(1, num_groups / std::max<size_t>(1, min_subset_size));
+  if (depth <= 1 or num_angle_sets == 0 or angle_set_work_time <= 0.0)
+    return 1;
+  if (latency <= 0.0)
+    return max_num_subsets;
+
+  const double optimum = std::sqrt(static_cast<double>(num_fills * (depth - 1)) *
+                                   angle_set_work_time /
+                                   (static_cast<double>(num_angle_sets) * latency));
+
+  return std::clamp<size_t>(static_cast<size_t>(std::lround(optimum)), 1, max_num_subsets);
+}
+
+} // namespace lbs
+} // namespace opensn
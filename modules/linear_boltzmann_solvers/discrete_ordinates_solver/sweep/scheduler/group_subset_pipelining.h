@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+
+namespace opensn
+{
+namespace lbs
+{
+
+/**
+ * Estimated floating-point operations of one cell solve (one angle and one group) on a cell with
+ * `num_nodes` nodes: assembling the matrix and the right-hand side (~10 n^2), Gaussian elimination
+ * (2/3 n^3) and accumulating `num_moments` flux moments (2 n per moment).
+ */
+double EstimateCellSolveFlops(size_t num_nodes, size_t num_moments);
+
+/**
+ * Measures the rate, in estimated cell solve operations (see EstimateCellSolveFlops) per second,
+ * of the batched Gaussian elimination used by the sweep chunks, for `num_systems` systems with
+ * `num_nodes` nodes. Local.
+ */
+double MeasureCellSolveRate(int num_nodes, size_t num_systems);
+
+/**
+ * Measures the one-way time, in seconds, of a small point-to-point message by ping-pong between
+ * pairs of locations. Returns the maximum over all locations, or zero on a single location.
+ * Collective.
+ */
+double MeasureMessageLatency();
+
+/**
+ * Chooses the number of group subsets of a groupset for pipelined sweeping.
+ *
+ * Splitting the groups of every angle set into \f$ B \f$ subsets lets a downstream location start
+ * on the first subset while the upstream location computes the next ones. With \f$ F \f$ pipeline
+ * fills per sweep (one per octant), a sweep that is \f$ D \f$ locations deep, \f$ A \f$ angle
+ * sets per group subset and a compute time \f$ W \f$ of one angle set with all groups, the sweep
+ * time is modeled as
+ * \f[
+ *   T(B) = F (D - 1) \left( \frac{W}{B} + \alpha \right) + A B \left( \frac{W}{B} + \alpha \right)
+ * \f]
+ * where \f$ \alpha \f$ is the message latency. The first term is the pipeline fill, which shrinks
+ * with smaller subsets, and the second the work plus one message per subset, whose latency grows
+ * with the number of subsets. The minimum is at \f$ B = \sqrt{F (D - 1) W / (A \alpha)} \f$,
+ * which is rounded and limited so that subsets keep at least `min_subset_size` groups.
+ */
+size_t PipelinedNumGroupSubsets(size_t num_groups,
+                                size_t min_subset_size,
+                                size_t num_fills,
+                                size_t depth,
+                                size_t num_angle_sets,
+                                double angle_set_work_time,
+                                double latency);
+
+} // namespace lbs
+} // namespace opensn
@@ -2,13 +2,21 @@
 // SPDX-License-Identifier: MIT
 
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/scheduler/sweep_scheduler.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/scheduler/group_subset_pipelining.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/spds/spds_adams_adams_hawkins.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/boundary/reflecting_boundary.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/math/spatial_discretization/spatial_discretization.h"
 #include "framework/logging/log.h"
 #include "framework/runtime.h"
 #include "caliper/cali.h"
+#include <chrono>
 #include <sstream>
 #include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <thread>
 
 namespace opensn
 {
@@ -17,11 +25,25 @@ namespace lbs
 
 SweepScheduler::SweepScheduler(SchedulingAlgorithm scheduler_type,
                                AngleAggregation& angle_agg,
-                               SweepChunk& sweep_chunk)
-  : scheduler_type_(scheduler_type), angle_agg_(angle_agg), sweep_chunk_(sweep_chunk)
+                               SweepChunk& sweep_chunk,
+                               std::vector<std::shared_ptr<SweepChunk>> thread_sweep_chunks)
+  : scheduler_type_(scheduler_type),
+    angle_agg_(angle_agg),
+    sweep_chunk_(sweep_chunk),
+    thread_sweep_chunks_(std::move(thread_sweep_chunks))
 {
   CALI_CXX_MARK_SCOPE("SweepScheduler::SweepScheduler");
 
+  if (not thread_sweep_chunks_.empty())
+    thread_pool_ = std::make_unique<ThreadPool>(1 + thread_sweep_chunks_.size());
+
+  for (const auto& cell : sweep_chunk_.grid_.local_cells)
+  {
+    const auto& cell_mapping = sweep_chunk_.discretization_.GetCellMapping(cell);
+    cell_solve_flops_per_angle_group_ +=
+      EstimateCellSolveFlops(cell_mapping.NumNodes(), sweep_chunk_.num_moments_);
+  }
+
   angle_agg_.InitializeReflectingBCs();
 
   if (scheduler_type_ == SchedulingAlgorithm::DEPTH_OF_GRAPH)
@@ -202,37 +224,7 @@ SweepScheduler::ScheduleAlgoDOG(SweepChunk& sweep_chunk)
     } // for each angleset rule
   }   // while not finished
 
-  // Receive delayed data
-  opensn::mpi_comm.barrier();
-  bool received_delayed_data = false;
-  while (not received_delayed_data)
-  {
-    received_delayed_data = true;
-
-    for (auto& angle_set_group : angle_agg_.angle_set_groups)
-      for (auto& angle_set : angle_set_group.AngleSets())
-      {
-        if (angle_set->FlushSendBuffers() == AngleSetStatus::MESSAGES_PENDING)
-          received_delayed_data = false;
-
-        if (not angle_set->ReceiveDelayedData())
-          received_delayed_data = false;
-      }
-  }
-
-  // Reset all
-  for (auto& angle_set_group : angle_agg_.angle_set_groups)
-    for (auto& angle_set : angle_set_group.AngleSets())
-      angle_set->ResetSweepBuffers();
-
-  for (auto& [bid, bndry] : angle_agg_.GetSimBoundaries())
-  {
-    if (bndry->Type() == BoundaryType::REFLECTING)
-    {
-      auto rbndry = std::static_pointer_cast<ReflectingBoundary>(bndry);
-      rbndry->ResetAnglesReadyStatus();
-    }
-  }
+  ReceiveDelayedDataAndReset();
 }
 
 void
@@ -256,6 +248,160 @@ SweepScheduler::ScheduleAlgoFIFO(SweepChunk& sweep_chunk)
       } // for angleset
   }     // while not finished
 
+  ReceiveDelayedDataAndReset();
+}
+
+void
+SweepScheduler::ScheduleAlgoThreaded(double& idle_time)
+{
+  CALI_CXX_MARK_SCOPE("SweepScheduler::ScheduleAlgoThreaded");
+
+  struct Execution
+  {
+    AngleSet* angle_set;
+    SweepChunk* sweep_chunk;
+    std::future<void> done;
+  };
+
+  // Anglesets in the order they are given permission to execute
+  std::vector<AngleSet*> angle_sets;
+  if (scheduler_type_ == SchedulingAlgorithm::DEPTH_OF_GRAPH)
+  {
+    for (auto& rule_value : rule_values_)
+      angle_sets.push_back(rule_value.angle_set.get());
+  }
+  else
+  {
+    for (auto& angle_set_group : angle_agg_.angle_set_groups)
+      for (auto& angle_set : angle_set_group.AngleSets())
+        angle_sets.push_back(angle_set.get());
+  }
+
+  std::vector<SweepChunk*> idle_sweep_chunks = {&sweep_chunk_};
+  for (auto& sweep_chunk : thread_sweep_chunks_)
+    idle_sweep_chunks.push_back(sweep_chunk.get());
+
+  std::vector<Execution> executions;
+  std::set<size_t> busy_group_subsets;
+
+  // Workers count their completed sweep chunks, so that this thread can sleep until one completes
+  // instead of spinning. The wait is bounded because messages must still be progressed.
+  constexpr auto max_wait = std::chrono::microseconds(50);
+  std::mutex completion_mutex;
+  std::condition_variable completion_cv;
+  size_t num_completed = 0;
+  size_t num_completed_seen = 0;
+
+  auto pass_start = std::chrono::steady_clock::now();
+  bool finished = false;
+  while (not finished)
+  {
+    finished = true;
+    bool progressed = false;
+
+    // Complete executions whose sweep chunks have finished
+    for (auto it = executions.begin(); it != executions.end();)
+    {
+      if (it->done.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+      {
+        ++it;
+        continue;
+      }
+
+      try
+      {
+        it->done.get();
+      }
+      catch (...)
+      {
+        // The other chunks reference the completion state of this scope
+        for (auto& execution : executions)
+          if (execution.done.valid())
+            execution.done.wait();
+        throw;
+      }
+      progressed = true;
+      it->angle_set->EndExecution();
+      busy_group_subsets.erase(it->angle_set->GetGroupSubset());
+      idle_sweep_chunks.push_back(it->sweep_chunk);
+      it = executions.erase(it);
+    }
+
+    for (auto angle_set : angle_sets)
+    {
+      const auto executing = std::find_if(executions.begin(),
+                                          executions.end(),
+                                          [angle_set](const Execution& execution)
+                                          { return execution.angle_set == angle_set; });
+      if (executing != executions.end())
+      {
+        finished = false;
+        continue;
+      }
+
+      // Progresses receives and sends, but never executes the chunk on this thread
+      AngleSetStatus status =
+        angle_set->AngleSetAdvance(sweep_chunk_, AngleSetStatus::NO_EXEC_IF_READY);
+
+      if (status == AngleSetStatus::READY_TO_EXECUTE and not idle_sweep_chunks.empty() and
+          busy_group_subsets.count(angle_set->GetGroupSubset()) == 0)
+      {
+        SweepChunk* sweep_chunk = idle_sweep_chunks.back();
+        idle_sweep_chunks.pop_back();
+        busy_group_subsets.insert(angle_set->GetGroupSubset());
+
+        angle_set->BeginExecution();
+        auto done = thread_pool_->Submit(
+          [sweep_chunk, angle_set, &completion_mutex, &completion_cv, &num_completed]()
+          {
+            const auto start_time = std::chrono::steady_clock::now();
+            sweep_chunk->Sweep(*angle_set);
+            angle_set->AddExecutionTime(
+              std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time)
+                .count());
+            {
+              std::lock_guard<std::mutex> lock(completion_mutex);
+              ++num_completed;
+            }
+            completion_cv.notify_one();
+          });
+        executions.push_back({angle_set, sweep_chunk, std::move(done)});
+        progressed = true;
+      }
+
+      if (status != AngleSetStatus::FINISHED)
+        finished = false;
+    } // for angleset
+
+    // Without progress, sleep until a sweep chunk completes or the wait times out. Without
+    // executing chunks, only messages can be awaited, so just yield.
+    if (not finished and not progressed)
+    {
+      if (executions.empty())
+        std::this_thread::yield();
+      else
+      {
+        std::unique_lock<std::mutex> lock(completion_mutex);
+        completion_cv.wait_for(
+          lock, max_wait, [&num_completed, num_completed_seen]()
+          { return num_completed != num_completed_seen; });
+        num_completed_seen = num_completed;
+      }
+    }
+
+    // Passes that end without any sweep chunk executing are idle
+    const auto pass_end = std::chrono::steady_clock::now();
+    if (executions.empty())
+      idle_time += std::chrono::duration<double>(pass_end - pass_start).count();
+    pass_start = pass_end;
+  } // while not finished
+
+  ReceiveDelayedDataAndReset();
+}
+
+void
+SweepScheduler::ReceiveDelayedDataAndReset()
+{
   // Receive delayed data
   opensn::mpi_comm.barrier();
   bool received_delayed_data = false;
@@ -289,21 +435,83 @@ SweepScheduler::ScheduleAlgoFIFO(SweepChunk& sweep_chunk)
   }
 }
 
+void
+SweepScheduler::UpdatePerformanceCounters(double sweep_time, double threaded_idle_time)
+{
+  const size_t num_local_cells = sweep_chunk_.grid_.local_cells.size();
+
+  double angle_set_time = 0.0;
+  for (auto& angle_set_group : angle_agg_.angle_set_groups)
+    for (auto& angle_set : angle_set_group.AngleSets())
+    {
+      const double execution_time = angle_set->GetExecutionTime();
+      auto& comm = *angle_set->GetCommunicator();
+      angle_set_time += execution_time;
+
+      if (counters_)
+      {
+        const size_t num_angle_groups = angle_set->GetNumAngles() * angle_set->GetNumGroups();
+
+        ++counters_->num_angle_set_executions;
+        counters_->min_angle_set_execution_time =
+          std::min(counters_->min_angle_set_execution_time, execution_time);
+        counters_->max_angle_set_execution_time =
+          std::max(counters_->max_angle_set_execution_time, execution_time);
+        counters_->num_cell_solves += num_angle_groups * num_local_cells;
+        counters_->num_cell_solve_flops +=
+          static_cast<double>(num_angle_groups) * cell_solve_flops_per_angle_group_;
+        counters_->num_messages_sent += comm.NumMessagesSent();
+        counters_->num_bytes_sent += comm.NumBytesSent();
+        counters_->num_messages_received += comm.NumMessagesReceived();
+        counters_->num_bytes_received += comm.NumBytesReceived();
+        counters_->poll_time += angle_set->GetPollTime();
+        counters_->num_idle_advances += angle_set->GetNumIdleAdvances();
+      }
+
+      angle_set->ResetCounters();
+      comm.ResetCounters();
+    }
+
+  if (not counters_)
+    return;
+
+  counters_->sweep_time += sweep_time;
+  counters_->angle_set_time += angle_set_time;
+  counters_->sweep_idle_time +=
+    thread_pool_ ? threaded_idle_time : std::max(0.0, sweep_time - angle_set_time);
+  ++counters_->num_sweeps;
+}
+
 void
 SweepScheduler::Sweep()
 {
   CALI_CXX_MARK_SCOPE("SweepScheduler::Sweep");
 
-  if (scheduler_type_ == SchedulingAlgorithm::FIRST_IN_FIRST_OUT)
+  const auto start_time = std::chrono::steady_clock::now();
+
+  for (auto& angle_set_group : angle_agg_.angle_set_groups)
+    for (auto& angle_set : angle_set_group.AngleSets())
+      angle_set->PostReceives();
+
+  double threaded_idle_time = 0.0;
+  if (thread_pool_)
+    ScheduleAlgoThreaded(threaded_idle_time);
+  else if (scheduler_type_ == SchedulingAlgorithm::FIRST_IN_FIRST_OUT)
     ScheduleAlgoFIFO(sweep_chunk_);
   else if (scheduler_type_ == SchedulingAlgorithm::DEPTH_OF_GRAPH)
     ScheduleAlgoDOG(sweep_chunk_);
+
+  UpdatePerformanceCounters(
+    std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count(),
+    threaded_idle_time);
 }
 
 void
 SweepScheduler::SetDestinationPhi(std::vector<double>& destination_phi)
 {
   sweep_chunk_.SetDestinationPhi(destination_phi);
+  for (auto& sweep_chunk : thread_sweep_chunks_)
+    sweep_chunk->SetDestinationPhi(destination_phi);
 }
 
 void
@@ -322,6 +530,8 @@ void
 SweepScheduler::SetDestinationPsi(std::vector<double>& destination_psi)
 {
   sweep_chunk_.SetDestinationPsi(destination_psi);
+  for (auto& sweep_chunk : thread_sweep_chunks_)
+    sweep_chunk->SetDestinationPsi(destination_psi);
 }
 
 void
@@ -362,6 +572,8 @@ void
 SweepScheduler::SetBoundarySourceActiveFlag(bool flag_value)
 {
   sweep_chunk_.SetBoundarySourceActiveFlag(flag_value);
+  for (auto& sweep_chunk : thread_sweep_chunks_)
+    sweep_chunk->SetBoundarySourceActiveFlag(flag_value);
 }
 
 } // namespace lbs
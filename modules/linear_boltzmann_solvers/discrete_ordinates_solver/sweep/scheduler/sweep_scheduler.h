@@ -5,6 +5,8 @@
 
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/angle_aggregation/angle_aggregation.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_chunks/sweep_chunk.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/performance_counters.h"
+#include "framework/utils/thread_pool.h"
 
 namespace opensn
 {
@@ -53,10 +55,25 @@ private:
 
   SweepChunk& sweep_chunk_;
 
+  /**Sweep chunks of the additional worker threads when sweeping threaded.*/
+  std::vector<std::shared_ptr<SweepChunk>> thread_sweep_chunks_;
+  std::unique_ptr<ThreadPool> thread_pool_;
+
+  PerformanceCounters* counters_ = nullptr;
+  /**Estimated floating-point operations of solving all local cells for one angle and group.*/
+  double cell_solve_flops_per_angle_group_ = 0.0;
+
 public:
+  /**
+   * Constructs a scheduler. When `thread_sweep_chunks` is non-empty, angle sets are executed
+   * concurrently on a pool of `1 + thread_sweep_chunks.size()` threads, each thread owning one
+   * sweep chunk (the first thread uses `sweep_chunk`). All chunks must write to the same
+   * destination vectors.
+   */
   SweepScheduler(SchedulingAlgorithm scheduler_type,
                  AngleAggregation& angle_agg,
-                 SweepChunk& sweep_chunk);
+                 SweepChunk& sweep_chunk,
+                 std::vector<std::shared_ptr<SweepChunk>> thread_sweep_chunks = {});
 
   AngleAggregation& AngleAgg() { return angle_agg_; }
 
@@ -70,6 +87,11 @@ public:
    */
   SweepChunk& GetSweepChunk();
 
+  /**
+   * Sets the performance counters that every sweep adds its times, cell solves and messages to.
+   */
+  void SetPerformanceCounters(PerformanceCounters* counters) { counters_ = counters; }
+
 private:
   /**
    * Applies a First-In-First-Out sweep scheduling.
@@ -86,6 +108,30 @@ private:
    */
   void ScheduleAlgoDOG(SweepChunk& sweep_chunk);
 
+  /**
+   * Executes ready angle sets concurrently on the thread pool. The calling thread performs all
+   * communication and only hands the execution of sweep chunks to the worker threads. Angle sets
+   * sharing a group subset are never executed concurrently, which keeps the flux moment, outflow
+   * and angular flux updates of concurrently executing chunks disjoint. Angle sets are considered
+   * in Depth-Of-Graph order when that algorithm is selected. When a pass over the angle sets
+   * makes no progress, the calling thread sleeps until a chunk completes, for at most a short
+   * interval so that messages keep progressing. The time during which no sweep chunk was
+   * executing is added to `idle_time`.
+   */
+  void ScheduleAlgoThreaded(double& idle_time);
+
+  /**
+   * Receives delayed data after all angle sets have executed and resets the angle sets and
+   * reflecting boundaries for the next sweep.
+   */
+  void ReceiveDelayedDataAndReset();
+
+  /**
+   * Adds the times, cell solves and messages of the angle sets to the performance counters and
+   * resets the counters of the angle sets.
+   */
+  void UpdatePerformanceCounters(double sweep_time, double threaded_idle_time);
+
 public:
   /**
    * Sets the location where flux moments are to be written.
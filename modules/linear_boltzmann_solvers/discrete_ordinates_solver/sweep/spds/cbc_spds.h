@@ -20,8 +20,19 @@ public:
            bool cycle_allowance_flag,
            bool verbose);
 
+  /**
+   * Creates an empty sweep ordering. The construction phases are executed separately, see
+   * BuildSweepOrderings.
+   */
+  CBC_SPDS(const Vector3& omega, const MeshContinuum& grid, bool verbose);
+
   const std::vector<Task>& TaskList() const;
 
+  /**Builds the task list from the cell face orientations. Does not communicate.*/
+  void BuildTaskList();
+
+  void ReadFrom(std::ifstream& file) override;
+
 protected:
   std::vector<Task> task_list_;
 };
@@ -3,7 +3,9 @@
 
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/spds/spds.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/graphs/directed_graph.h"
 #include "framework/logging/log.h"
+#include "framework/logging/log_exceptions.h"
 #include "framework/utils/timer.h"
 #include "framework/runtime.h"
 #include "caliper/cali.h"
@@ -58,6 +60,93 @@ SPDS::MapLocJToDeplocI(int locJ) const
   return 0;
 }
 
+void
+SPDS::BuildLocalSweepOrdering(bool cycle_allowance_flag)
+{
+  CALI_CXX_MARK_SCOPE("SPDS::BuildLocalSweepOrdering");
+
+  const size_t num_loc_cells = grid_.local_cells.size();
+
+  // Populate Cell Relationships
+  std::vector<std::set<std::pair<int, double>>> cell_successors(num_loc_cells);
+  std::set<int> location_successors;
+  std::set<int> location_dependencies;
+
+  PopulateCellRelationships(omega_, location_dependencies, location_successors, cell_successors);
+
+  location_successors_.assign(location_successors.begin(), location_successors.end());
+  location_dependencies_.assign(location_dependencies.begin(), location_dependencies.end());
+
+  // Build graph
+  DirectedGraph local_DG;
+
+  // Add vertex for each local cell
+  for (int c = 0; c < num_loc_cells; ++c)
+    local_DG.AddVertex();
+
+  // Create graph edges
+  for (int c = 0; c < num_loc_cells; c++)
+    for (auto& successor : cell_successors[c])
+      local_DG.AddEdge(c, successor.first, successor.second);
+
+  // Remove local cycles if allowed
+  if (cycle_allowance_flag)
+  {
+    auto edges_to_remove = local_DG.RemoveCyclicDependencies();
+
+    for (auto& edge_to_remove : edges_to_remove)
+    {
+      local_cyclic_dependencies_.emplace_back(edge_to_remove.first, edge_to_remove.second);
+    }
+  }
+
+  // Generate topological sorting
+  auto so_temp = local_DG.GenerateTopologicalSort();
+  spls_.item_id.clear();
+  for (auto v : so_temp)
+    spls_.item_id.emplace_back(v);
+
+  OpenSnLogicalErrorIf(spls_.item_id.empty() and num_loc_cells > 0,
+                       "Topological sorting for local sweep-ordering failed. Cyclic dependencies "
+                       "detected. Cycles need to be allowed by calling application.");
+}
+
+void
+SPDS::WriteTo(std::ofstream& file) const
+{
+  WriteBinaryVector(file, spls_.item_id);
+  WriteBinaryVector(file, location_dependencies_);
+  WriteBinaryVector(file, location_successors_);
+  WriteBinaryVector(file, delayed_location_dependencies_);
+  WriteBinaryVector(file, delayed_location_successors_);
+  WriteBinaryVector(file, local_cyclic_dependencies_);
+
+  WriteBinaryValue<size_t>(file, cell_face_orientations_.size());
+  for (const auto& face_orientations : cell_face_orientations_)
+    WriteBinaryVector(file, face_orientations);
+}
+
+void
+SPDS::ReadFrom(std::ifstream& file)
+{
+  spls_.item_id = ReadBinaryVector<int>(file);
+  location_dependencies_ = ReadBinaryVector<int>(file);
+  location_successors_ = ReadBinaryVector<int>(file);
+  delayed_location_dependencies_ = ReadBinaryVector<int>(file);
+  delayed_location_successors_ = ReadBinaryVector<int>(file);
+  local_cyclic_dependencies_ = ReadBinaryVector<std::pair<int, int>>(file);
+
+  const auto num_cells = ReadBinaryValue<size_t>(file);
+  if (not file or num_cells != grid_.local_cells.size())
+  {
+    file.setstate(std::ios::failbit);
+    return;
+  }
+  cell_face_orientations_.resize(num_cells);
+  for (auto& face_orientations : cell_face_orientations_)
+    face_orientations = ReadBinaryVector<FaceOrientation>(file);
+}
+
 void
 SPDS::PopulateCellRelationships(const Vector3& omega,
                                 std::set<int>& location_dependencies,
@@ -4,6 +4,8 @@
 #pragma once
 
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/sweep.h"
+#include "framework/utils/utils.h"
+#include <fstream>
 #include <memory>
 
 namespace opensn
@@ -43,6 +45,26 @@ public:
   /** Given a location J index, maps to a dependent location.*/
   int MapLocJToDeplocI(int locJ) const;
 
+  /**
+   * Builds the location-local part of the sweep ordering: the cell face orientations, the
+   * location dependencies and successors, the local cyclic dependencies and the local sweep
+   * ordering. No communication is involved, so the sweep orderings of different directions can
+   * execute this phase concurrently.
+   */
+  void BuildLocalSweepOrdering(bool cycle_allowance_flag);
+
+  /**Writes the directed graph of the local cells and their ghosts to stdout. Collective.*/
+  void PrintedGhostedGraph() const;
+
+  /**Writes the sweep ordering to a binary file. See ReadFrom.*/
+  virtual void WriteTo(std::ofstream& file) const;
+
+  /**
+   * Reads a sweep ordering written by WriteTo. The ordering must have been written on the same
+   * mesh and partition, for the same direction.
+   */
+  virtual void ReadFrom(std::ifstream& file);
+
   virtual ~SPDS() = default;
 
 protected:
@@ -69,7 +91,25 @@ protected:
                                  std::set<int>& location_successors,
                                  std::vector<std::set<std::pair<int, double>>>& cell_successors);
 
-  void PrintedGhostedGraph() const;
+  template <typename T>
+  static void WriteBinaryVector(std::ofstream& file, const std::vector<T>& values)
+  {
+    WriteBinaryValue<size_t>(file, values.size());
+    file.write(reinterpret_cast<const char*>(values.data()),
+               static_cast<std::streamsize>(values.size() * sizeof(T)));
+  }
+
+  template <typename T>
+  static std::vector<T> ReadBinaryVector(std::ifstream& file)
+  {
+    const auto num_values = ReadBinaryValue<size_t>(file);
+    if (not file)
+      return {};
+    std::vector<T> values(num_values);
+    file.read(reinterpret_cast<char*>(values.data()),
+              static_cast<std::streamsize>(values.size() * sizeof(T)));
+    return values;
+  }
 };
 
 } // namespace lbs
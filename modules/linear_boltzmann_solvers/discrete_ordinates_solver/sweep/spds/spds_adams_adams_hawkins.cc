@@ -5,6 +5,7 @@
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
 #include "framework/graphs/directed_graph.h"
 #include "framework/logging/log.h"
+#include "framework/logging/log_exceptions.h"
 #include "framework/utils/timer.h"
 #include "framework/runtime.h"
 #include "caliper/cali.h"
@@ -26,68 +27,12 @@ SPDS_AdamsAdamsHawkins::SPDS_AdamsAdamsHawkins(const Vector3& omega,
   log.Log0Verbose1() << program_timer.GetTimeString()
                      << " Building sweep ordering for Omega = " << omega.PrintS();
 
-  size_t num_loc_cells = grid.local_cells.size();
-
-  // Populate Cell Relationships
-  log.Log0Verbose1() << "Populating cell relationships";
-  std::vector<std::set<std::pair<int, double>>> cell_successors(num_loc_cells);
-  std::set<int> location_successors;
-  std::set<int> location_dependencies;
-
-  PopulateCellRelationships(omega, location_dependencies, location_successors, cell_successors);
-
-  location_successors_.reserve(location_successors.size());
-  location_dependencies_.reserve(location_dependencies.size());
-
-  for (auto v : location_successors)
-    location_successors_.push_back(v);
-
-  for (auto v : location_dependencies)
-    location_dependencies_.push_back(v);
-
-  // Build graph
-  DirectedGraph local_DG;
-
-  // Add vertex for each local cell
-  for (int c = 0; c < num_loc_cells; ++c)
-    local_DG.AddVertex();
-
-  // Create graph edges
-  for (int c = 0; c < num_loc_cells; c++)
-    for (auto& successor : cell_successors[c])
-      local_DG.AddEdge(c, successor.first, successor.second);
-
-  // Remove local cycles if allowed
   if (verbose_)
     PrintedGhostedGraph();
 
-  if (cycle_allowance_flag)
-  {
-    log.Log0Verbose1() << program_timer.GetTimeString() << " Removing inter-cell cycles.";
-
-    auto edges_to_remove = local_DG.RemoveCyclicDependencies();
-
-    for (auto& edge_to_remove : edges_to_remove)
-    {
-      local_cyclic_dependencies_.emplace_back(edge_to_remove.first, edge_to_remove.second);
-    }
-  }
-
-  // Generate topological sorting
-  log.Log0Verbose1() << program_timer.GetTimeString()
-                     << " Generating topological sorting for local sweep ordering";
-  auto so_temp = local_DG.GenerateTopologicalSort();
-  spls_.item_id.clear();
-  for (auto v : so_temp)
-    spls_.item_id.emplace_back(v);
-
-  if (spls_.item_id.empty())
-  {
-    log.LogAllError() << "Topological sorting for local sweep-ordering failed. "
-                      << "Cyclic dependencies detected. Cycles need to be allowed"
-                      << " by calling application.";
-    Exit(EXIT_FAILURE);
-  }
+  // Populate cell relationships, remove local cycles if allowed and generate the local
+  // topological sorting
+  BuildLocalSweepOrdering(cycle_allowance_flag);
 
   //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%% Create Task
   //                                                        Dependency Graphs
@@ -97,7 +42,6 @@ SPDS_AdamsAdamsHawkins::SPDS_AdamsAdamsHawkins(const Vector3& omega,
 
   log.Log0Verbose1() << program_timer.GetTimeString() << " Communicating sweep dependencies.";
 
-  // auto& global_dependencies = sweep_order->global_dependencies;
   std::vector<std::vector<int>> global_dependencies;
   global_dependencies.resize(opensn::mpi_comm.size());
 
@@ -112,75 +56,104 @@ SPDS_AdamsAdamsHawkins::SPDS_AdamsAdamsHawkins(const Vector3& omega,
   log.Log0Verbose1() << program_timer.GetTimeString() << " Done computing sweep ordering.\n\n";
 }
 
+SPDS_AdamsAdamsHawkins::SPDS_AdamsAdamsHawkins(const Vector3& omega,
+                                               const MeshContinuum& grid,
+                                               bool verbose)
+  : SPDS(omega, grid, verbose)
+{
+}
+
 void
 SPDS_AdamsAdamsHawkins::BuildTaskDependencyGraph(
   const std::vector<std::vector<int>>& global_dependencies, bool cycle_allowance_flag)
 {
   CALI_CXX_MARK_SCOPE("SPDS_AdamsAdamsHawkins::BuildTaskDependencyGraph");
 
-  std::vector<std::pair<int, int>> edges_to_remove;
   std::vector<int> raw_edges_to_remove;
-  DirectedGraph TDG;
+  std::vector<int> glob_linear_sweep_order;
 
   // Build graph on home location
   if (opensn::mpi_comm.rank() == 0)
   {
     log.Log0Verbose1() << program_timer.GetTimeString() << " Building Task Dependency Graphs.";
+    ComputeTaskDependencyGraph(
+      global_dependencies, cycle_allowance_flag, raw_edges_to_remove, glob_linear_sweep_order);
+  }
 
-    // Add vertices to the graph
-    for (int loc = 0; loc < opensn::mpi_comm.size(); loc++)
-      TDG.AddVertex();
+  // Broadcast edges and topological sort
+  mpi_comm.broadcast(raw_edges_to_remove, 0);
+  mpi_comm.broadcast(glob_linear_sweep_order, 0);
 
-    // Add dependencies
-    for (int loc = 0; loc < opensn::mpi_comm.size(); loc++)
-      for (int dep = 0; dep < global_dependencies[loc].size(); dep++)
-        TDG.AddEdge(global_dependencies[loc][dep], loc);
+  ApplyTaskDependencyGraph(global_dependencies, raw_edges_to_remove, glob_linear_sweep_order);
+}
 
-    // Remove cyclic dependencies
-    if (cycle_allowance_flag)
-    {
-      log.Log0Verbose1() << program_timer.GetTimeString() << " Removing intra-cellset cycles.";
-      auto edges_to_remove_temp = TDG.RemoveCyclicDependencies();
-      for (const auto& [v0, v1] : edges_to_remove_temp)
-        edges_to_remove.emplace_back(v0, v1);
-    }
+void
+SPDS_AdamsAdamsHawkins::ComputeTaskDependencyGraph(
+  const std::vector<std::vector<int>>& global_dependencies,
+  bool cycle_allowance_flag,
+  std::vector<int>& raw_edges_to_remove,
+  std::vector<int>& glob_linear_sweep_order)
+{
+  CALI_CXX_MARK_SCOPE("SPDS_AdamsAdamsHawkins::ComputeTaskDependencyGraph");
 
-    // Serialize edges to be removed
-    raw_edges_to_remove.resize(edges_to_remove.size() * 2, 0);
-    int i = 0;
-    for (const auto& edge : edges_to_remove)
-    {
-      raw_edges_to_remove[i++] = edge.first;
-      raw_edges_to_remove[i++] = edge.second;
-    }
-  } // if home
+  const int num_locations = static_cast<int>(global_dependencies.size());
+  DirectedGraph TDG;
 
-  // Broadcast edges
-  mpi_comm.broadcast(raw_edges_to_remove, 0);
-  int edge_buffer_size = raw_edges_to_remove.size();
+  // Add vertices to the graph
+  for (int loc = 0; loc < num_locations; loc++)
+    TDG.AddVertex();
+
+  // Add dependencies
+  for (int loc = 0; loc < num_locations; loc++)
+    for (int dep = 0; dep < global_dependencies[loc].size(); dep++)
+      TDG.AddEdge(global_dependencies[loc][dep], loc);
 
-  // De-serialize edges
-  if (opensn::mpi_comm.rank() != 0)
+  // Remove cyclic dependencies
+  std::vector<std::pair<int, int>> edges_to_remove;
+  if (cycle_allowance_flag)
   {
-    edges_to_remove.resize(edge_buffer_size / 2, std::pair<int, int>(0, 0));
-    int i = 0;
-    for (auto& edge : edges_to_remove)
-    {
-      edge.first = raw_edges_to_remove[i++];
-      edge.second = raw_edges_to_remove[i++];
-    }
+    auto edges_to_remove_temp = TDG.RemoveCyclicDependencies();
+    for (const auto& [v0, v1] : edges_to_remove_temp)
+      edges_to_remove.emplace_back(v0, v1);
   }
 
-  // Remove edges
-  for (auto& edge_to_remove : edges_to_remove)
+  // Serialize edges to be removed
+  raw_edges_to_remove.clear();
+  raw_edges_to_remove.reserve(edges_to_remove.size() * 2);
+  for (const auto& [rlocI, locI] : edges_to_remove)
   {
-    int rlocI = edge_to_remove.first;
-    int locI = edge_to_remove.second;
+    raw_edges_to_remove.push_back(rlocI);
+    raw_edges_to_remove.push_back(locI);
+    TDG.RemoveEdge(rlocI, locI);
+  }
+
+  // Generate topological sort
+  auto so_temp = TDG.GenerateTopologicalSort();
+  glob_linear_sweep_order.assign(so_temp.begin(), so_temp.end());
+
+  OpenSnLogicalErrorIf(glob_linear_sweep_order.empty(),
+                       "Topological sorting for global sweep-ordering failed. Cyclic dependencies "
+                       "detected. Cycles need to be allowed by calling application.");
+}
+
+void
+SPDS_AdamsAdamsHawkins::ApplyTaskDependencyGraph(
+  const std::vector<std::vector<int>>& global_dependencies,
+  const std::vector<int>& raw_edges_to_remove,
+  const std::vector<int>& glob_linear_sweep_order)
+{
+  CALI_CXX_MARK_SCOPE("SPDS_AdamsAdamsHawkins::ApplyTaskDependencyGraph");
 
-    if (opensn::mpi_comm.rank() == 0)
-      TDG.RemoveEdge(rlocI, locI);
+  const int num_locations = static_cast<int>(global_dependencies.size());
+  const int location_id = opensn::mpi_comm.rank();
 
-    if (locI == opensn::mpi_comm.rank())
+  // Remove edges
+  for (size_t i = 0; i + 1 < raw_edges_to_remove.size(); i += 2)
+  {
+    int rlocI = raw_edges_to_remove[i];
+    int locI = raw_edges_to_remove[i + 1];
+
+    if (locI == location_id)
     {
       auto dependent_location =
         std::find(location_dependencies_.begin(), location_dependencies_.end(), rlocI);
@@ -188,50 +161,27 @@ SPDS_AdamsAdamsHawkins::BuildTaskDependencyGraph(
       delayed_location_dependencies_.push_back(rlocI);
     }
 
-    if (rlocI == opensn::mpi_comm.rank())
+    if (rlocI == location_id)
       delayed_location_successors_.push_back(locI);
   }
 
-  // Generate topological sort
-  std::vector<int> glob_linear_sweep_order;
-  if (opensn::mpi_comm.rank() == 0)
-  {
-    log.LogAllVerbose2() << program_timer.GetTimeString() << "   - Generating topological sort.";
-    auto so_temp = TDG.GenerateTopologicalSort();
-    for (auto v : so_temp)
-      glob_linear_sweep_order.emplace_back(v);
-
-    if (glob_linear_sweep_order.empty())
-    {
-      log.LogAllError() << "Topological sorting for global sweep-ordering failed. "
-                        << "Cyclic dependencies detected. Cycles need to be allowed"
-                        << " by calling application.";
-      Exit(EXIT_FAILURE);
-    }
-  }
-
-  // Broadcast topological sort
-  mpi_comm.broadcast(glob_linear_sweep_order, 0);
-
   // Compute reorder mapping
   // This mapping allows us to punch in
   // the location id and find what its
   // id is in the TDG
-  std::vector<int> glob_order_mapping(opensn::mpi_comm.size(), -1);
+  std::vector<int> glob_order_mapping(num_locations, -1);
 
-  for (int k = 0; k < opensn::mpi_comm.size(); k++)
+  for (int k = 0; k < num_locations; k++)
   {
     int loc = glob_linear_sweep_order[k];
     glob_order_mapping[loc] = k;
   }
 
   // Determine sweep order ranks
-  log.Log0Verbose1() << program_timer.GetTimeString() << " Determining sweep order ranks.";
-
-  std::vector<int> glob_sweep_order_rank(opensn::mpi_comm.size(), -1);
+  std::vector<int> glob_sweep_order_rank(num_locations, -1);
 
   int abs_max_rank = 0;
-  for (int k = 0; k < opensn::mpi_comm.size(); k++)
+  for (int k = 0; k < num_locations; k++)
   {
     int loc = glob_linear_sweep_order[k];
     if (global_dependencies[loc].empty())
@@ -255,12 +205,12 @@ SPDS_AdamsAdamsHawkins::BuildTaskDependencyGraph(
   }
 
   // Generate TDG structure
-  log.Log0Verbose1() << program_timer.GetTimeString() << " Generating TDG structure.";
+  global_sweep_planes_.clear();
   for (int r = 0; r <= abs_max_rank; r++)
   {
     STDG new_stdg;
 
-    for (int k = 0; k < opensn::mpi_comm.size(); k++)
+    for (int k = 0; k < num_locations; k++)
     {
       if (glob_sweep_order_rank[k] == r)
         new_stdg.item_id.push_back(glob_linear_sweep_order[k]);
@@ -269,5 +219,28 @@ SPDS_AdamsAdamsHawkins::BuildTaskDependencyGraph(
   }
 }
 
+void
+SPDS_AdamsAdamsHawkins::WriteTo(std::ofstream& file) const
+{
+  SPDS::WriteTo(file);
+
+  WriteBinaryValue<size_t>(file, global_sweep_planes_.size());
+  for (const auto& stdg : global_sweep_planes_)
+    WriteBinaryVector(file, stdg.item_id);
+}
+
+void
+SPDS_AdamsAdamsHawkins::ReadFrom(std::ifstream& file)
+{
+  SPDS::ReadFrom(file);
+
+  const auto num_planes = ReadBinaryValue<size_t>(file);
+  if (not file)
+    return;
+  global_sweep_planes_.resize(num_planes);
+  for (auto& stdg : global_sweep_planes_)
+    stdg.item_id = ReadBinaryVector<int>(file);
+}
+
 } // namespace lbs
 } // namespace opensn
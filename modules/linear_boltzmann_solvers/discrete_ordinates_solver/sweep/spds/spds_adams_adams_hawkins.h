@@ -17,8 +17,37 @@ public:
                          const MeshContinuum& grid,
                          bool cycle_allowance_flag,
                          bool verbose);
+
+  /**
+   * Creates an empty sweep ordering. The construction phases are executed separately, see
+   * BuildSweepOrderings.
+   */
+  SPDS_AdamsAdamsHawkins(const Vector3& omega, const MeshContinuum& grid, bool verbose);
+
   const std::vector<STDG>& GetGlobalSweepPlanes() const { return global_sweep_planes_; }
 
+  /**
+   * Computes the location-level part of the task dependency graph from the dependencies of all
+   * locations: the (serialized) inter-location edges that must be removed to break cycles and a
+   * topological sort of the locations. Does not communicate and does not depend on the calling
+   * location, so it can be executed on any single location.
+   */
+  static void ComputeTaskDependencyGraph(const std::vector<std::vector<int>>& global_dependencies,
+                                         bool cycle_allowance_flag,
+                                         std::vector<int>& raw_edges_to_remove,
+                                         std::vector<int>& glob_linear_sweep_order);
+
+  /**
+   * Applies the results of ComputeTaskDependencyGraph to this location: delays the dependencies
+   * on removed edges and builds the global sweep planes.
+   */
+  void ApplyTaskDependencyGraph(const std::vector<std::vector<int>>& global_dependencies,
+                                const std::vector<int>& raw_edges_to_remove,
+                                const std::vector<int>& glob_linear_sweep_order);
+
+  void WriteTo(std::ofstream& file) const override;
+  void ReadFrom(std::ifstream& file) override;
+
 private:
   /**Builds the task dependency graph.*/
   void BuildTaskDependencyGraph(const std::vector<std::vector<int>>& global_dependencies,
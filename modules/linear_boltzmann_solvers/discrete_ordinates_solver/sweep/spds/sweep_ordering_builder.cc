@@ -0,0 +1,365 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/spds/sweep_ordering_builder.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/spds/spds_adams_adams_hawkins.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/spds/cbc_spds.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/utils/thread_pool.h"
+#include "framework/logging/log.h"
+#include "framework/logging/log_exceptions.h"
+#include "framework/utils/timer.h"
+#include "framework/runtime.h"
+#include "caliper/cali.h"
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+
+namespace opensn
+{
+namespace lbs
+{
+
+namespace
+{
+
+/**Version of the sweep ordering cache file layout. Bump when the layout changes.*/
+constexpr uint64_t SWEEP_ORDERING_CACHE_VERSION = 1;
+
+/**64-bit FNV-1a hash of a sequence of plain values.*/
+class FNVHash
+{
+public:
+  template <typename T>
+  void Add(const T& value)
+  {
+    const auto* bytes = reinterpret_cast<const unsigned char*>(&value);
+    for (size_t i = 0; i < sizeof(T); ++i)
+    {
+      value_ ^= bytes[i];
+      value_ *= 1099511628211ull;
+    }
+  }
+
+  void Add(const std::string& value)
+  {
+    Add(value.size());
+    for (const char c : value)
+      Add(c);
+  }
+
+  void Add(const Vector3& value)
+  {
+    Add(value.x);
+    Add(value.y);
+    Add(value.z);
+  }
+
+  uint64_t Value() const { return value_; }
+
+private:
+  uint64_t value_ = 14695981039346656037ull;
+};
+
+/**
+ * Computes a key identifying the sweep orderings of a set of directions: it covers the local
+ * cells and faces of every location, the partition, the directions and the options that affect
+ * the ordering. Identical on all locations. Collective.
+ */
+uint64_t
+ComputeSweepOrderingKey(const std::string& sweep_type,
+                        const MeshContinuum& grid,
+                        const std::vector<Vector3>& omegas,
+                        bool cycle_allowance_flag)
+{
+  FNVHash local_hash;
+  local_hash.Add(grid.local_cells.size());
+  for (const auto& cell : grid.local_cells)
+  {
+    local_hash.Add(cell.global_id_);
+    local_hash.Add(cell.centroid_);
+    local_hash.Add(cell.faces_.size());
+    for (const auto& face : cell.faces_)
+    {
+      local_hash.Add(face.normal_);
+      local_hash.Add(face.centroid_);
+      local_hash.Add(face.has_neighbor_);
+      local_hash.Add(face.neighbor_id_);
+      if (face.has_neighbor_)
+        local_hash.Add(face.GetNeighborPartitionID(grid));
+      for (const uint64_t vid : face.vertex_ids_)
+        local_hash.Add(vid);
+    }
+  }
+
+  std::vector<uint64_t> location_hashes;
+  mpi_comm.all_gather(local_hash.Value(), location_hashes);
+
+  FNVHash hash;
+  hash.Add(SWEEP_ORDERING_CACHE_VERSION);
+  hash.Add(sweep_type);
+  hash.Add(cycle_allowance_flag);
+  hash.Add(opensn::mpi_comm.size());
+  for (const uint64_t location_hash : location_hashes)
+    hash.Add(location_hash);
+  hash.Add(omegas.size());
+  for (const auto& omega : omegas)
+    hash.Add(omega);
+
+  return hash.Value();
+}
+
+/**Reads the sweep orderings of this location from a cache file. Returns false on a miss.*/
+bool
+ReadSweepOrderings(const std::filesystem::path& file_path,
+                   uint64_t key,
+                   std::vector<std::shared_ptr<SPDS>>& spds_list)
+{
+  std::ifstream file(file_path, std::ios_base::binary | std::ios_base::in);
+  if (not file.is_open())
+    return false;
+
+  if (ReadBinaryValue<uint64_t>(file) != key or
+      ReadBinaryValue<size_t>(file) != spds_list.size() or not file)
+    return false;
+
+  for (auto& spds : spds_list)
+  {
+    spds->ReadFrom(file);
+    if (not file)
+      return false;
+  }
+
+  return true;
+}
+
+/**Writes the sweep orderings of this location to a cache file. Returns false on failure.*/
+bool
+WriteSweepOrderings(const std::filesystem::path& file_path,
+                    uint64_t key,
+                    const std::vector<std::shared_ptr<SPDS>>& spds_list)
+{
+  std::ofstream file(file_path, std::ios_base::binary | std::ios_base::out);
+  if (not file.is_open())
+    return false;
+
+  WriteBinaryValue<uint64_t>(file, key);
+  WriteBinaryValue<size_t>(file, spds_list.size());
+  for (const auto& spds : spds_list)
+    spds->WriteTo(file);
+
+  return static_cast<bool>(file);
+}
+
+/**
+ * Calls `function` and agrees on its success with all locations, so that a failure on one
+ * location does not leave the others waiting in the next collective operation. Rethrows the
+ * exception of this location, or throws if `function` failed on another location. Collective.
+ */
+void
+CallCollectively(const std::string& what, const std::function<void()>& function)
+{
+  std::exception_ptr error;
+  try
+  {
+    function();
+  }
+  catch (...)
+  {
+    error = std::current_exception();
+  }
+
+  const int local_num_failed = error ? 1 : 0;
+  int num_failed = 0;
+  mpi_comm.all_reduce(local_num_failed, num_failed, mpi::op::sum<int>());
+
+  if (error)
+    std::rethrow_exception(error);
+  OpenSnLogicalErrorIf(num_failed > 0,
+                       what + " failed on " + std::to_string(num_failed) + " other location(s).");
+}
+
+} // namespace
+
+std::vector<std::shared_ptr<SPDS>>
+BuildSweepOrderings(const std::string& sweep_type,
+                    const MeshContinuum& grid,
+                    const std::vector<Vector3>& omegas,
+                    const std::vector<bool>& verbose,
+                    bool cycle_allowance_flag,
+                    unsigned int num_threads,
+                    const std::string& cache_folder_name)
+{
+  CALI_CXX_MARK_FUNCTION;
+
+  OpenSnInvalidArgumentIf(sweep_type != "AAH" and sweep_type != "CBC",
+                          "Unsupported sweeptype \"" + sweep_type + "\"");
+  OpenSnInvalidArgumentIf(verbose.size() != omegas.size(),
+                          "The number of verbose flags must match the number of directions.");
+
+  const size_t num_dirs = omegas.size();
+  const int num_locations = opensn::mpi_comm.size();
+  const int location_id = opensn::mpi_comm.rank();
+
+  auto MakeEmptySweepOrderings = [&]()
+  {
+    std::vector<std::shared_ptr<SPDS>> spds_list;
+    spds_list.reserve(num_dirs);
+    for (size_t d = 0; d < num_dirs; ++d)
+      if (sweep_type == "AAH")
+        spds_list.push_back(std::make_shared<SPDS_AdamsAdamsHawkins>(omegas[d], grid, verbose[d]));
+      else
+        spds_list.push_back(std::make_shared<CBC_SPDS>(omegas[d], grid, verbose[d]));
+    return spds_list;
+  };
+
+  auto spds_list = MakeEmptySweepOrderings();
+
+  // Try the cache. Every location must hit, otherwise all locations rebuild.
+  uint64_t key = 0;
+  std::filesystem::path cache_file_path;
+  if (not cache_folder_name.empty())
+  {
+    key = ComputeSweepOrderingKey(sweep_type, grid, omegas, cycle_allowance_flag);
+
+    std::ostringstream file_name;
+    file_name << "sweep_ordering_" << std::hex << std::setw(16) << std::setfill('0') << key
+              << std::dec << "_" << location_id << ".bin";
+    cache_file_path = std::filesystem::path(cache_folder_name) / file_name.str();
+
+    const int local_hit = ReadSweepOrderings(cache_file_path, key, spds_list) ? 1 : 0;
+    int global_hit = 0;
+    mpi_comm.all_reduce(local_hit, global_hit, mpi::op::min<int>());
+    if (global_hit == 1)
+    {
+      log.Log0Verbose1() << program_timer.GetTimeString() << " Read " << num_dirs
+                         << " sweep orderings from " << cache_folder_name;
+      return spds_list;
+    }
+
+    spds_list = MakeEmptySweepOrderings();
+  }
+
+  log.Log0Verbose1() << program_timer.GetTimeString() << " Building " << num_dirs
+                     << " sweep orderings.";
+
+  // Printing the ghosted graph is collective, so it cannot happen on the worker threads
+  for (size_t d = 0; d < num_dirs; ++d)
+    if (verbose[d])
+      spds_list[d]->PrintedGhostedGraph();
+
+  // Location-local phase
+  CallCollectively("Building the local sweep orderings",
+                   [&]()
+                   {
+                     ParallelFor(num_dirs,
+                                 num_threads,
+                                 [&](size_t d)
+                                 {
+                                   spds_list[d]->BuildLocalSweepOrdering(cycle_allowance_flag);
+                                   if (sweep_type == "CBC")
+                                     std::static_pointer_cast<CBC_SPDS>(spds_list[d])
+                                       ->BuildTaskList();
+                                 });
+                   });
+
+  // Task dependency graphs
+  if (sweep_type == "AAH")
+  {
+    // Gather the location dependencies of all directions at once
+    std::vector<const std::vector<int>*> location_dependencies;
+    location_dependencies.reserve(num_dirs);
+    for (const auto& spds : spds_list)
+      location_dependencies.push_back(&spds->GetLocationDependencies());
+
+    std::vector<std::vector<std::vector<int>>> global_dependencies;
+    CommunicateLocationDependencies(location_dependencies, global_dependencies);
+
+    // Direction d is owned by location d % P, which computes its task dependency graph
+    std::vector<size_t> owned_dirs;
+    for (size_t d = location_id; d < num_dirs; d += num_locations)
+      owned_dirs.push_back(d);
+
+    std::vector<std::vector<int>> owned_edges_to_remove(owned_dirs.size());
+    std::vector<std::vector<int>> owned_sweep_orders(owned_dirs.size());
+    CallCollectively("Computing the task dependency graphs",
+                     [&]()
+                     {
+                       ParallelFor(owned_dirs.size(),
+                                   num_threads,
+                                   [&](size_t i)
+                                   {
+                                     SPDS_AdamsAdamsHawkins::ComputeTaskDependencyGraph(
+                                       global_dependencies[owned_dirs[i]],
+                                       cycle_allowance_flag,
+                                       owned_edges_to_remove[i],
+                                       owned_sweep_orders[i]);
+                                   });
+                     });
+
+    // Exchange the results as, per owned direction, the number of serialized edges, the
+    // serialized edges and the location sweep order (P entries)
+    std::vector<int> raw_local_results;
+    for (size_t i = 0; i < owned_dirs.size(); ++i)
+    {
+      raw_local_results.push_back(static_cast<int>(owned_edges_to_remove[i].size()));
+      raw_local_results.insert(raw_local_results.end(),
+                               owned_edges_to_remove[i].begin(),
+                               owned_edges_to_remove[i].end());
+      raw_local_results.insert(
+        raw_local_results.end(), owned_sweep_orders[i].begin(), owned_sweep_orders[i].end());
+    }
+
+    std::vector<int> raw_results;
+    mpi_comm.all_gather(raw_local_results, raw_results);
+
+    size_t addr = 0;
+    for (int loc = 0; loc < num_locations; ++loc)
+      for (size_t d = loc; d < num_dirs; d += num_locations)
+      {
+        const int num_raw_edges = raw_results[addr++];
+        const std::vector<int> raw_edges_to_remove(raw_results.begin() + addr,
+                                                   raw_results.begin() + addr + num_raw_edges);
+        addr += num_raw_edges;
+        const std::vector<int> glob_linear_sweep_order(raw_results.begin() + addr,
+                                                       raw_results.begin() + addr + num_locations);
+        addr += num_locations;
+
+        std::static_pointer_cast<SPDS_AdamsAdamsHawkins>(spds_list[d])
+          ->ApplyTaskDependencyGraph(
+            global_dependencies[d], raw_edges_to_remove, glob_linear_sweep_order);
+      }
+  }
+
+  // Populate the cache. A failure only costs a rebuild on the next run, so it is not an error.
+  if (not cache_folder_name.empty())
+  {
+    int folder_exists = 0;
+    if (location_id == 0)
+    {
+      std::error_code error;
+      std::filesystem::create_directories(cache_folder_name, error);
+      folder_exists = error ? 0 : 1;
+    }
+    mpi_comm.broadcast(folder_exists, 0);
+
+    const int local_written =
+      folder_exists == 1 and WriteSweepOrderings(cache_file_path, key, spds_list) ? 1 : 0;
+    int written = 0;
+    mpi_comm.all_reduce(local_written, written, mpi::op::min<int>());
+    if (written == 0)
+      log.Log0Warning() << "Failed to write the sweep ordering cache to \"" << cache_folder_name
+                        << "\". The sweep orderings will be rebuilt on the next run.";
+  }
+
+  opensn::mpi_comm.barrier();
+
+  log.Log0Verbose1() << program_timer.GetTimeString() << " Done computing sweep orderings.";
+
+  return spds_list;
+}
+
+} // namespace lbs
+} // namespace opensn
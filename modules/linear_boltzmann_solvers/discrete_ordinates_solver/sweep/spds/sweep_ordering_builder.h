@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/spds/spds.h"
+#include <string>
+
+namespace opensn
+{
+namespace lbs
+{
+
+/**
+ * Builds the sweep orderings (`sweep_type` "AAH" or "CBC") of a set of directions. The result is
+ * identical to constructing one SPDS per direction, but the work is reorganized so that it scales
+ * with the number of directions:
+ *
+ * - the location-local phase of all directions is executed on `num_threads` threads,
+ * - the location dependencies of all directions are gathered with a single collective,
+ * - the task dependency graph of direction `d` (AAH only) is computed on location `d % P`
+ *   instead of on location 0, and the results are exchanged with a single collective.
+ *
+ * When `cache_folder_name` is not empty, the orderings are read from a per-location file in that
+ * folder if one exists for the same mesh, partition, directions and options, and are written
+ * there otherwise. Collective.
+ *
+ * \param sweep_type The sweep type, "AAH" or "CBC".
+ * \param grid The mesh.
+ * \param omegas The directions.
+ * \param verbose Per direction, whether the ghosted graph is printed.
+ * \param cycle_allowance_flag Whether cyclic dependencies are removed.
+ * \param num_threads Number of threads for the location-local phase.
+ * \param cache_folder_name Folder of the sweep ordering cache. Empty disables the cache.
+ */
+std::vector<std::shared_ptr<SPDS>> BuildSweepOrderings(const std::string& sweep_type,
+                                                       const MeshContinuum& grid,
+                                                       const std::vector<Vector3>& omegas,
+                                                       const std::vector<bool>& verbose,
+                                                       bool cycle_allowance_flag,
+                                                       unsigned int num_threads,
+                                                       const std::string& cache_folder_name);
+
+} // namespace lbs
+} // namespace opensn
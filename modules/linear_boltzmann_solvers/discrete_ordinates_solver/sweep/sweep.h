@@ -62,6 +62,15 @@ struct STDG
 void CommunicateLocationDependencies(const std::vector<int>& location_dependencies,
                                      std::vector<std::vector<int>>& global_dependencies);
 
+/**
+ * Communicates the location by location dependencies of several sweep orderings with a single
+ * collective. On return `global_dependencies[d][loc]` holds the dependencies of location `loc`
+ * for sweep ordering `d`.
+ */
+void
+CommunicateLocationDependencies(const std::vector<const std::vector<int>*>& location_dependencies,
+                                std::vector<std::vector<std::vector<int>>>& global_dependencies);
+
 /**Print a sweep ordering to file.*/
 void PrintSweepOrdering(SPDS* sweep_order, std::shared_ptr<MeshContinuum> vol_continuum);
 
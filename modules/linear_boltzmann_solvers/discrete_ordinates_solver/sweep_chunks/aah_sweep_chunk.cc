@@ -4,7 +4,9 @@
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_chunks/aah_sweep_chunk.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/fluds/aah_fluds.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/math/batched_gauss_elimination.h"
 #include "caliper/cali.h"
+#include <algorithm>
 
 namespace opensn
 {
@@ -13,7 +15,7 @@ namespace lbs
 
 AahSweepChunk::AahSweepChunk(const MeshContinuum& grid,
                              const SpatialDiscretization& discretization,
-                             const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                             const UnitCellMatrixStore& unit_cell_matrices,
                              std::vector<lbs::CellLBSView>& cell_transport_views,
                              const std::vector<double>& densities,
                              std::vector<double>& destination_phi,
@@ -22,7 +24,8 @@ AahSweepChunk::AahSweepChunk(const MeshContinuum& grid,
                              const LBSGroupset& groupset,
                              const std::map<int, std::shared_ptr<MultiGroupXS>>& xs,
                              int num_moments,
-                             int max_num_cell_dofs)
+                             int max_num_cell_dofs,
+                             std::shared_ptr<const SweepGeometryCache> geometry_cache)
   : SweepChunk(destination_phi,
                destination_psi,
                grid,
@@ -34,8 +37,19 @@ AahSweepChunk::AahSweepChunk(const MeshContinuum& grid,
                groupset,
                xs,
                num_moments,
-               max_num_cell_dofs)
+               max_num_cell_dofs),
+    geometry_cache_(std::move(geometry_cache)),
+    max_group_subset_size_(0)
 {
+  for (const auto& grp_ss_info : groupset_.grp_subset_infos_)
+    max_group_subset_size_ = std::max(max_group_subset_size_, grp_ss_info.ss_size);
+
+  const size_t max_num_nodes = max_num_cell_dofs_;
+  Amat_.resize(max_num_nodes * max_num_nodes);
+  Atemp_.resize(max_num_nodes * max_num_nodes * max_group_subset_size_);
+  b_.resize(max_num_nodes * max_group_subset_size_);
+  source_.resize(max_num_nodes * max_group_subset_size_);
+  sigma_tg_.resize(max_group_subset_size_);
 }
 
 void
@@ -45,7 +59,7 @@ AahSweepChunk::Sweep(AngleSet& angle_set)
 
   const SubSetInfo& grp_ss_info = groupset_.grp_subset_infos_[angle_set.GetGroupSubset()];
 
-  auto gs_ss_size = grp_ss_info.ss_size;
+  const size_t gs_ss_size = grp_ss_info.ss_size;
   auto gs_ss_begin = grp_ss_info.ss_begin;
   auto gs_gi = groupset_.groups_[gs_ss_begin].id_;
 
@@ -56,13 +70,13 @@ AahSweepChunk::Sweep(AngleSet& angle_set)
   const auto& m2d_op = groupset_.quadrature_->GetMomentToDiscreteOperator();
   const auto& d2m_op = groupset_.quadrature_->GetDiscreteToMomentOperator();
 
-  std::vector<std::vector<double>> Amat(max_num_cell_dofs_,
-                                        std::vector<double>(max_num_cell_dofs_));
-  std::vector<std::vector<double>> Atemp(max_num_cell_dofs_,
-                                         std::vector<double>(max_num_cell_dofs_));
-  std::vector<std::vector<double>> b(groupset_.groups_.size(),
-                                     std::vector<double>(max_num_cell_dofs_));
-  std::vector<double> source(max_num_cell_dofs_);
+  const auto& geom = *geometry_cache_;
+  auto& output_phi = GetDestinationPhi();
+  double* Amat = Amat_.data();
+  double* Atemp = Atemp_.data();
+  double* b = b_.data();
+  double* source = source_.data();
+  double* sigma_tg = sigma_tg_.data();
 
   // Loop over each cell
   const auto& spds = angle_set.GetSPDS();
@@ -71,22 +85,23 @@ AahSweepChunk::Sweep(AngleSet& angle_set)
   for (size_t spls_index = 0; spls_index < num_spls; ++spls_index)
   {
     auto cell_local_id = spls[spls_index];
-    auto& cell = grid_.local_cells[cell_local_id];
-    auto& cell_mapping = discretization_.GetCellMapping(cell);
     auto& cell_transport_view = cell_transport_views_[cell_local_id];
-    auto cell_num_faces = cell.faces_.size();
-    auto cell_num_nodes = cell_mapping.NumNodes();
+    const size_t cell_num_faces = geom.CellNumFaces(cell_local_id);
+    const size_t cell_num_nodes = geom.CellNumNodes(cell_local_id);
+    const size_t cell_face_begin = geom.FaceBegin(cell_local_id);
 
     const auto& face_orientations = spds.CellFaceOrientations()[cell_local_id];
-    std::vector<double> face_mu_values(cell_num_faces);
+    if (face_mu_values_.size() < cell_num_faces)
+      face_mu_values_.resize(cell_num_faces);
 
-    const auto& rho = densities_[cell.local_id_];
-    const auto& sigma_t = xs_.at(cell.material_id_)->SigmaTotal();
+    const double rho = densities_[cell_local_id];
+    const auto& sigma_t = cell_transport_view.XS().SigmaTotal();
+    for (size_t gsg = 0; gsg < gs_ss_size; ++gsg)
+      sigma_tg[gsg] = rho * sigma_t[gs_gi + gsg];
 
     // Get cell matrices
-    const auto& G = unit_cell_matrices_[cell_local_id].intV_shapeI_gradshapeJ;
-    const auto& M = unit_cell_matrices_[cell_local_id].intV_shapeI_shapeJ;
-    const auto& M_surf = unit_cell_matrices_[cell_local_id].intS_shapeI_shapeJ;
+    const Vector3* G = geom.G(cell_local_id);
+    const double* M = geom.M(cell_local_id);
 
     // Loop over angles in set (as = angleset, ss = subset)
     const int ni_deploc_face_counter = deploc_face_counter;
@@ -102,27 +117,25 @@ AahSweepChunk::Sweep(AngleSet& angle_set)
       preloc_face_counter = ni_preloc_face_counter;
 
       // Reset right-hand side
-      for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-        b[gsg].assign(cell_num_nodes, 0.0);
+      std::fill_n(b, cell_num_nodes * gs_ss_size, 0.0);
 
-      for (int i = 0; i < cell_num_nodes; ++i)
-        for (int j = 0; j < cell_num_nodes; ++j)
-          Amat[i][j] = omega.Dot(G[i][j]);
+      for (size_t ij = 0; ij < cell_num_nodes * cell_num_nodes; ++ij)
+        Amat[ij] = omega.Dot(G[ij]);
 
       // Update face orientations
-      for (int f = 0; f < cell_num_faces; ++f)
-        face_mu_values[f] = omega.Dot(cell.faces_[f].normal_);
+      for (size_t f = 0; f < cell_num_faces; ++f)
+        face_mu_values_[f] = omega.Dot(geom.FaceNormal(cell_face_begin + f));
 
       // Surface integrals
       int in_face_counter = -1;
-      for (int f = 0; f < cell_num_faces; ++f)
+      for (size_t f = 0; f < cell_num_faces; ++f)
       {
         if (face_orientations[f] != FaceOrientation::INCOMING)
           continue;
 
-        auto& cell_face = cell.faces_[f];
-        const bool is_local_face = cell_transport_view.IsFaceLocal(f);
-        const bool is_boundary_face = not cell_face.has_neighbor_;
+        const size_t face = cell_face_begin + f;
+        const bool is_local_face = geom.IsFaceLocal(face);
+        const bool is_boundary_face = geom.IsFaceBoundary(face);
 
         if (is_local_face)
           ++in_face_counter;
@@ -130,17 +143,20 @@ AahSweepChunk::Sweep(AngleSet& angle_set)
           ++preloc_face_counter;
 
         // IntSf_mu_psi_Mij_dA
-        const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
-        for (int fi = 0; fi < num_face_nodes; ++fi)
+        const size_t num_face_nodes = geom.FaceNumNodes(face);
+        const int* face_node_map = geom.FaceNodeMap(face);
+        const double* M_surf = geom.FaceMSurf(face);
+        for (size_t fi = 0; fi < num_face_nodes; ++fi)
         {
-          const int i = cell_mapping.MapFaceNode(f, fi);
+          const int i = face_node_map[fi];
+          double* bi = &b[i * gs_ss_size];
 
-          for (int fj = 0; fj < num_face_nodes; ++fj)
+          for (size_t fj = 0; fj < num_face_nodes; ++fj)
           {
-            const int j = cell_mapping.MapFaceNode(f, fj);
+            const int j = face_node_map[fj];
 
-            const double mu_Nij = -face_mu_values[f] * M_surf[f][i][j];
-            Amat[i][j] += mu_Nij;
+            const double mu_Nij = -face_mu_values_[f] * M_surf[fi * num_face_nodes + fj];
+            Amat[i * cell_num_nodes + j] += mu_Nij;
 
             const double* psi;
             if (is_local_face)
@@ -148,7 +164,7 @@ AahSweepChunk::Sweep(AngleSet& angle_set)
             else if (not is_boundary_face)
               psi = fluds.NLUpwindPsi(preloc_face_counter, fj, 0, as_ss_idx);
             else
-              psi = angle_set.PsiBoundary(cell_face.neighbor_id_,
+              psi = angle_set.PsiBoundary(geom.FaceNeighborID(face),
                                           direction_num,
                                           cell_local_id,
                                           f,
@@ -160,58 +176,59 @@ AahSweepChunk::Sweep(AngleSet& angle_set)
             if (not psi)
               continue;
 
-            for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-              b[gsg][i] += psi[gsg] * mu_Nij;
+            for (size_t gsg = 0; gsg < gs_ss_size; ++gsg)
+              bi[gsg] += psi[gsg] * mu_Nij;
           } // for face node j
         }   // for face node i
       }     // for f
 
-      // Looping over groups, assembling mass terms
-      for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+      // Contribute source moments q = M_n^T * q_moms
+      std::fill_n(source, cell_num_nodes * gs_ss_size, 0.0);
+      for (size_t i = 0; i < cell_num_nodes; ++i)
       {
-        double sigma_tg = rho * sigma_t[gs_gi + gsg];
-
-        // Contribute source moments q = M_n^T * q_moms
-        for (int i = 0; i < cell_num_nodes; ++i)
+        double* qi = &source[i * gs_ss_size];
+        for (int m = 0; m < num_moments_; ++m)
         {
-          double temp_src = 0.0;
-          for (int m = 0; m < num_moments_; ++m)
-          {
-            const size_t ir = cell_transport_view.MapDOF(i, m, static_cast<int>(gs_gi + gsg));
-            temp_src += m2d_op[m][direction_num] * source_moments_[ir];
-          }
-          source[i] = temp_src;
+          const double m2d = m2d_op[m][direction_num];
+          const double* q_mom = &source_moments_[cell_transport_view.MapDOF(i, m, gs_gi)];
+          for (size_t gsg = 0; gsg < gs_ss_size; ++gsg)
+            qi[gsg] += m2d * q_mom[gsg];
         }
+      }
 
-        // Mass matrix and source
-        // Atemp = Amat + sigma_tgr * M
-        // b += M * q
-        for (int i = 0; i < cell_num_nodes; ++i)
+      // Mass matrix and source for all groups of the subset at once
+      // Atemp = Amat + sigma_tgr * M
+      // b += M * q
+      for (size_t i = 0; i < cell_num_nodes; ++i)
+      {
+        double* bi = &b[i * gs_ss_size];
+        for (size_t j = 0; j < cell_num_nodes; ++j)
         {
-          double temp = 0.0;
-          for (int j = 0; j < cell_num_nodes; ++j)
+          const double Mij = M[i * cell_num_nodes + j];
+          const double Aij = Amat[i * cell_num_nodes + j];
+          double* Atemp_ij = &Atemp[(i * cell_num_nodes + j) * gs_ss_size];
+          const double* qj = &source[j * gs_ss_size];
+          for (size_t gsg = 0; gsg < gs_ss_size; ++gsg)
           {
-            const double Mij = M[i][j];
-            Atemp[i][j] = Amat[i][j] + Mij * sigma_tg;
-            temp += Mij * source[j];
+            Atemp_ij[gsg] = Aij + Mij * sigma_tg[gsg];
+            bi[gsg] += Mij * qj[gsg];
           }
-          b[gsg][i] += temp;
         }
+      }
 
-        // Solve system
-        GaussElimination(Atemp, b[gsg], static_cast<int>(cell_num_nodes));
-      } // for gsg
+      // Solve the systems of all groups in the subset
+      BatchedGaussElimination(Atemp, b, static_cast<int>(cell_num_nodes), gs_ss_size);
 
       // Update phi
-      auto& output_phi = GetDestinationPhi();
       for (int m = 0; m < num_moments_; ++m)
       {
         const double wn_d2m = d2m_op[m][direction_num];
-        for (int i = 0; i < cell_num_nodes; ++i)
+        for (size_t i = 0; i < cell_num_nodes; ++i)
         {
           const size_t ir = cell_transport_view.MapDOF(i, m, gs_gi);
-          for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-            output_phi[ir + gsg] += wn_d2m * b[gsg][i];
+          const double* bi = &b[i * gs_ss_size];
+          for (size_t gsg = 0; gsg < gs_ss_size; ++gsg)
+            output_phi[ir + gsg] += wn_d2m * bi[gsg];
         }
       }
 
@@ -219,6 +236,7 @@ AahSweepChunk::Sweep(AngleSet& angle_set)
       if (save_angular_flux_)
       {
         auto& output_psi = GetDestinationPsi();
+        const auto& cell = grid_.local_cells[cell_local_id];
         double* cell_psi_data =
           &output_psi[discretization_.MapDOFLocal(cell, 0, groupset_.psi_uk_man_, 0, 0)];
 
@@ -226,40 +244,42 @@ AahSweepChunk::Sweep(AngleSet& angle_set)
         {
           const size_t imap =
             i * groupset_angle_group_stride_ + direction_num * groupset_group_stride_ + gs_ss_begin;
-          for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-            cell_psi_data[imap + gsg] = b[gsg][i];
+          std::copy_n(&b[i * gs_ss_size], gs_ss_size, &cell_psi_data[imap]);
         }
       }
 
       // For outoing, non-boundary faces, copy angular flux to fluds and
       // accumulate outflow
       int out_face_counter = -1;
-      for (int f = 0; f < cell_num_faces; ++f)
+      for (size_t f = 0; f < cell_num_faces; ++f)
       {
         if (face_orientations[f] != FaceOrientation::OUTGOING)
           continue;
 
         out_face_counter++;
-        const auto& face = cell.faces_[f];
-        const bool is_local_face = cell_transport_view.IsFaceLocal(f);
-        const bool is_boundary_face = not face.has_neighbor_;
+        const size_t face = cell_face_begin + f;
+        const uint64_t neighbor_id = geom.FaceNeighborID(face);
+        const bool is_local_face = geom.IsFaceLocal(face);
+        const bool is_boundary_face = geom.IsFaceBoundary(face);
         const bool is_reflecting_boundary_face =
-          (is_boundary_face and angle_set.GetBoundaries()[face.neighbor_id_]->IsReflecting());
-        const auto& IntF_shapeI = unit_cell_matrices_[cell_local_id].intS_shapeI[f];
+          (is_boundary_face and angle_set.GetBoundaries()[neighbor_id]->IsReflecting());
+        const double* IntF_shapeI = geom.FaceIntSShapeI(face);
 
         if (not is_boundary_face and not is_local_face)
           ++deploc_face_counter;
 
-        const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
-        for (int fi = 0; fi < num_face_nodes; ++fi)
+        const size_t num_face_nodes = geom.FaceNumNodes(face);
+        const int* face_node_map = geom.FaceNodeMap(face);
+        for (size_t fi = 0; fi < num_face_nodes; ++fi)
         {
-          const int i = cell_mapping.MapFaceNode(f, fi);
+          const int i = face_node_map[fi];
+          const double* bi = &b[i * gs_ss_size];
 
           if (is_boundary_face and not is_reflecting_boundary_face)
           {
-            for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+            for (size_t gsg = 0; gsg < gs_ss_size; ++gsg)
               cell_transport_view.AddOutflow(gs_gi + gsg,
-                                             wt * face_mu_values[f] * b[gsg][i] * IntF_shapeI[i]);
+                                             wt * face_mu_values_[f] * bi[gsg] * IntF_shapeI[fi]);
           }
 
           double* psi = nullptr;
@@ -269,15 +289,12 @@ AahSweepChunk::Sweep(AngleSet& angle_set)
             psi = fluds.NLOutgoingPsi(deploc_face_counter, fi, as_ss_idx);
           else if (is_reflecting_boundary_face)
             psi = angle_set.PsiReflected(
-              face.neighbor_id_, direction_num, cell_local_id, f, fi, gs_ss_begin);
+              neighbor_id, direction_num, cell_local_id, f, fi, gs_ss_begin);
           else
             continue;
 
           if (not is_boundary_face or is_reflecting_boundary_face)
-          {
-            for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-              psi[gsg] = b[gsg][i];
-          }
+            std::copy_n(bi, gs_ss_size, psi);
         } // for fi
       }   // for face
     }     // for angleset/subset
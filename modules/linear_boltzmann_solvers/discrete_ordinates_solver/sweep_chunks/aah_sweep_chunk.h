@@ -4,6 +4,7 @@
 #pragma once
 
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_chunks/sweep_chunk.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_chunks/sweep_geometry_cache.h"
 #include "framework/math/spatial_discretization/spatial_discretization.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/groupset/lbs_groupset.h"
 
@@ -17,7 +18,7 @@ class AahSweepChunk : public SweepChunk
 public:
   AahSweepChunk(const MeshContinuum& grid,
                 const SpatialDiscretization& discretization,
-                const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                const UnitCellMatrixStore& unit_cell_matrices,
                 std::vector<lbs::CellLBSView>& cell_transport_views,
                 const std::vector<double>& densities,
                 std::vector<double>& destination_phi,
@@ -26,9 +27,27 @@ public:
                 const LBSGroupset& groupset,
                 const std::map<int, std::shared_ptr<MultiGroupXS>>& xs,
                 int num_moments,
-                int max_num_cell_dofs);
+                int max_num_cell_dofs,
+                std::shared_ptr<const SweepGeometryCache> geometry_cache);
 
   void Sweep(AngleSet& angle_set) override;
+
+private:
+  /**Packed cell and face data, shared by all the sweep chunks of the solver.*/
+  std::shared_ptr<const SweepGeometryCache> geometry_cache_;
+
+  /**Largest group subset size of the groupset, i.e., the batch size of the cell solves.*/
+  size_t max_group_subset_size_;
+
+  // Work buffers, allocated once and reused for every cell. Group-indexed buffers are stored
+  // node-major with the group subset index running fastest so that all groups of a subset are
+  // assembled and solved as one contiguous batch.
+  std::vector<double> Amat_;
+  std::vector<double> Atemp_;
+  std::vector<double> b_;
+  std::vector<double> source_;
+  std::vector<double> sigma_tg_;
+  std::vector<double> face_mu_values_;
 };
 
 } // namespace lbs
@@ -18,7 +18,7 @@ CbcSweepChunk::CbcSweepChunk(std::vector<double>& destination_phi,
                              std::vector<double>& destination_psi,
                              const MeshContinuum& grid,
                              const SpatialDiscretization& discretization,
-                             const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                             const UnitCellMatrixStore& unit_cell_matrices,
                              std::vector<lbs::CellLBSView>& cell_transport_views,
                              const std::vector<double>& densities,
                              const std::vector<double>& source_moments,
@@ -50,7 +50,11 @@ CbcSweepChunk::CbcSweepChunk(std::vector<double>& destination_phi,
     cell_mapping_(nullptr),
     cell_transport_view_(nullptr),
     cell_num_faces_(0),
-    cell_num_nodes_(0)
+    cell_num_nodes_(0),
+    G_(nullptr),
+    M_(nullptr),
+    M_surf_(nullptr),
+    IntS_shapeI_(nullptr)
 {
 }
 
@@ -83,10 +87,12 @@ CbcSweepChunk::SetCell(const Cell* cell_ptr, AngleSet& angle_set)
   cell_num_nodes_ = cell_mapping_->NumNodes();
 
   // Get cell matrices
-  G_ = unit_cell_matrices_[cell_local_id_].intV_shapeI_gradshapeJ;
-  M_ = unit_cell_matrices_[cell_local_id_].intV_shapeI_shapeJ;
-  M_surf_ = unit_cell_matrices_[cell_local_id_].intS_shapeI_shapeJ;
-  IntS_shapeI_ = unit_cell_matrices_[cell_local_id_].intS_shapeI;
+  const auto& cell_matrices =
+    unit_cell_matrices_.Unique(cell_transport_view_->UnitCellMatricesIndex());
+  G_ = &cell_matrices.intV_shapeI_gradshapeJ;
+  M_ = &cell_matrices.intV_shapeI_shapeJ;
+  M_surf_ = &cell_matrices.intS_shapeI_shapeJ;
+  IntS_shapeI_ = &cell_matrices.intS_shapeI;
 }
 
 void
@@ -124,7 +130,7 @@ CbcSweepChunk::Sweep(AngleSet& angle_set)
 
     for (int i = 0; i < cell_num_nodes_; ++i)
       for (int j = 0; j < cell_num_nodes_; ++j)
-        Amat[i][j] = omega.Dot(G_[i][j]);
+        Amat[i][j] = omega.Dot((*G_)[i][j]);
 
     // Update face orientations
     for (int f = 0; f < cell_num_faces_; ++f)
@@ -164,7 +170,7 @@ CbcSweepChunk::Sweep(AngleSet& angle_set)
         {
           const int j = cell_mapping_->MapFaceNode(f, fj);
 
-          const double mu_Nij = -face_mu_values[f] * M_surf_[f][i][j];
+          const double mu_Nij = -face_mu_values[f] * (*M_surf_)[f][i][j];
           Amat[i][j] += mu_Nij;
 
           const double* psi = nullptr;
@@ -225,7 +231,7 @@ CbcSweepChunk::Sweep(AngleSet& angle_set)
         double temp = 0.0;
         for (int j = 0; j < cell_num_nodes_; ++j)
         {
-          const double Mij = M_[i][j];
+          const double Mij = (*M_)[i][j];
           Atemp[i][j] = Amat[i][j] + Mij * sigma_tg;
           temp += Mij * source[j];
         }
@@ -276,7 +282,7 @@ CbcSweepChunk::Sweep(AngleSet& angle_set)
       const bool is_boundary_face = not face.has_neighbor_;
       const bool is_reflecting_boundary_face =
         (is_boundary_face and angle_set.GetBoundaries()[face.neighbor_id_]->IsReflecting());
-      const auto& IntF_shapeI = IntS_shapeI_[f];
+      const auto& IntF_shapeI = (*IntS_shapeI_)[f];
 
       const int locality = cell_transport_view_->FaceLocality(f);
       const size_t num_face_nodes = cell_mapping_->NumFaceNodes(f);
@@ -20,7 +20,7 @@ public:
                 std::vector<double>& destination_psi,
                 const MeshContinuum& grid,
                 const SpatialDiscretization& discretization,
-                const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                const UnitCellMatrixStore& unit_cell_matrices,
                 std::vector<lbs::CellLBSView>& cell_transport_views,
                 const std::vector<double>& densities,
                 const std::vector<double>& source_moments,
@@ -51,10 +51,10 @@ private:
   size_t cell_num_faces_;
   size_t cell_num_nodes_;
 
-  MatVec3 G_;
-  MatDbl M_;
-  std::vector<MatDbl> M_surf_;
-  std::vector<VecDbl> IntS_shapeI_;
+  const MatVec3* G_;
+  const MatDbl* M_;
+  const std::vector<MatDbl>* M_surf_;
+  const std::vector<VecDbl>* IntS_shapeI_;
 };
 
 } // namespace lbs
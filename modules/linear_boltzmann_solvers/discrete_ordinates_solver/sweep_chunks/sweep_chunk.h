@@ -6,6 +6,7 @@
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/angle_aggregation/angle_aggregation.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/groupset/lbs_groupset.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/lbs_structs.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/unit_cell_matrix_store.h"
 #include <functional>
 
 namespace opensn
@@ -34,7 +35,7 @@ public:
              std::vector<double>& destination_psi,
              const MeshContinuum& grid,
              const SpatialDiscretization& discretization,
-             const std::vector<lbs::UnitCellMatrices>& unit_cell_matrices,
+             const lbs::UnitCellMatrixStore& unit_cell_matrices,
              std::vector<lbs::CellLBSView>& cell_transport_views,
              const std::vector<double>& densities,
              const std::vector<double>& source_moments,
@@ -100,7 +101,7 @@ protected:
 
   const MeshContinuum& grid_;
   const SpatialDiscretization& discretization_;
-  const std::vector<lbs::UnitCellMatrices>& unit_cell_matrices_;
+  const lbs::UnitCellMatrixStore& unit_cell_matrices_;
   std::vector<lbs::CellLBSView>& cell_transport_views_;
   const std::vector<double>& densities_;
   const std::vector<double>& source_moments_;
@@ -0,0 +1,99 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_chunks/sweep_geometry_cache.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "caliper/cali.h"
+
+namespace opensn
+{
+namespace lbs
+{
+
+SweepGeometryCache::SweepGeometryCache(const MeshContinuum& grid,
+                                       const SpatialDiscretization& discretization,
+                                       const UnitCellMatrixStore& unit_cell_matrices,
+                                       const std::vector<CellLBSView>& cell_transport_views)
+  : unit_cell_matrices_(unit_cell_matrices)
+{
+  CALI_CXX_MARK_SCOPE("SweepGeometryCache::SweepGeometryCache");
+
+  const size_t num_local_cells = grid.local_cells.size();
+
+  // Sizes
+  size_t num_faces = 0;
+  size_t num_face_nodes = 0;
+  size_t num_face_matrix_entries = 0;
+  for (const auto& cell : grid.local_cells)
+  {
+    const auto& cell_mapping = discretization.GetCellMapping(cell);
+    num_faces += cell.faces_.size();
+    for (size_t f = 0; f < cell.faces_.size(); ++f)
+    {
+      const size_t nfn = cell_mapping.NumFaceNodes(f);
+      num_face_nodes += nfn;
+      num_face_matrix_entries += nfn * nfn;
+    }
+  }
+
+  cell_num_nodes_.resize(num_local_cells);
+  face_begin_.assign(num_local_cells + 1, 0);
+
+  face_normal_.reserve(num_faces);
+  face_flags_.reserve(num_faces);
+  face_neighbor_id_.reserve(num_faces);
+  face_node_begin_.reserve(num_faces + 1);
+  face_M_surf_begin_.reserve(num_faces);
+  face_M_surf_.reserve(num_face_matrix_entries);
+
+  face_node_map_.reserve(num_face_nodes);
+  face_intS_shapeI_.reserve(num_face_nodes);
+
+  // Fill, in cell local id order
+  face_node_begin_.push_back(0);
+  for (const auto& cell : grid.local_cells)
+  {
+    const uint64_t c = cell.local_id_;
+    const auto& cell_mapping = discretization.GetCellMapping(cell);
+    const auto& cell_transport_view = cell_transport_views[c];
+    const auto& matrices = unit_cell_matrices[c];
+    const size_t num_nodes = cell_mapping.NumNodes();
+    const size_t cell_num_faces = cell.faces_.size();
+
+    cell_num_nodes_[c] = static_cast<uint32_t>(num_nodes);
+    face_begin_[c + 1] = face_begin_[c] + cell_num_faces;
+
+    for (size_t f = 0; f < cell_num_faces; ++f)
+    {
+      const auto& face = cell.faces_[f];
+      const size_t nfn = cell_mapping.NumFaceNodes(f);
+
+      uint8_t flags = 0;
+      if (cell_transport_view.IsFaceLocal(static_cast<int>(f)))
+        flags |= FACE_IS_LOCAL;
+      if (not face.has_neighbor_)
+        flags |= FACE_IS_BOUNDARY;
+
+      face_normal_.push_back(face.normal_);
+      face_flags_.push_back(flags);
+      face_neighbor_id_.push_back(face.neighbor_id_);
+      face_node_begin_.push_back(face_node_begin_.back() + nfn);
+      face_M_surf_begin_.push_back(face_M_surf_.size());
+
+      for (size_t fi = 0; fi < nfn; ++fi)
+      {
+        const int i = cell_mapping.MapFaceNode(f, fi);
+        face_node_map_.push_back(i);
+        face_intS_shapeI_.push_back(matrices.intS_shapeI[f][i]);
+        for (size_t fj = 0; fj < nfn; ++fj)
+        {
+          const int j = cell_mapping.MapFaceNode(f, fj);
+          face_M_surf_.push_back(matrices.intS_shapeI_shapeJ[f][i][j]);
+        }
+      }
+    }
+  }
+}
+
+} // namespace lbs
+} // namespace opensn
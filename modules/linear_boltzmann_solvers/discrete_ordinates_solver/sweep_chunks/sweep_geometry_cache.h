@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "modules/linear_boltzmann_solvers/lbs_solver/unit_cell_matrix_store.h"
+#include "framework/math/spatial_discretization/spatial_discretization.h"
+#include <vector>
+#include <cstdint>
+
+namespace opensn
+{
+class MeshContinuum;
+
+namespace lbs
+{
+
+/**
+ * Compact, structure-of-arrays copy of the cell and face data read by the sweep kernels.
+ *
+ * The sweep visits every local cell once per angle set and, for every cell, walks its faces and
+ * face nodes. Reading this data from the mesh, the cell mappings and the nested unit cell matrices
+ * touches many small, scattered heap allocations. This cache packs everything into a handful of
+ * flat arrays indexed by cell local id (cells), `FaceBegin(c) + f` (faces) and
+ * `FaceNodeBegin(c, f) + fi` (face nodes). The data only depends on the mesh and the
+ * discretization, so a single cache can be shared by all sweep chunks of a solver. The volumetric
+ * matrices are not copied: they are read from the packed arrays of the unit cell matrix store,
+ * where congruent cells share one copy.
+ */
+class SweepGeometryCache
+{
+public:
+  SweepGeometryCache(const MeshContinuum& grid,
+                     const SpatialDiscretization& discretization,
+                     const UnitCellMatrixStore& unit_cell_matrices,
+                     const std::vector<CellLBSView>& cell_transport_views);
+
+  /**Returns the number of cells in the cache.*/
+  size_t NumCells() const { return cell_num_nodes_.size(); }
+
+  /**Returns the number of nodes of a cell.*/
+  size_t CellNumNodes(uint64_t c) const { return cell_num_nodes_[c]; }
+
+  /**Returns the number of faces of a cell.*/
+  size_t CellNumFaces(uint64_t c) const { return face_begin_[c + 1] - face_begin_[c]; }
+
+  /**Returns the index of the first face of a cell in the face arrays.*/
+  size_t FaceBegin(uint64_t c) const { return face_begin_[c]; }
+
+  /**Returns the row-major `intV_shapeI_gradshapeJ` matrix of a cell.*/
+  const Vector3* G(uint64_t c) const { return unit_cell_matrices_.FlatG(c); }
+
+  /**Returns the row-major `intV_shapeI_shapeJ` matrix of a cell.*/
+  const double* M(uint64_t c) const { return unit_cell_matrices_.FlatM(c); }
+
+  /**Returns the outward normal of a face.*/
+  const Vector3& FaceNormal(size_t face) const { return face_normal_[face]; }
+
+  /**Returns true if the face neighbor is a local cell.*/
+  bool IsFaceLocal(size_t face) const { return face_flags_[face] & FACE_IS_LOCAL; }
+
+  /**Returns true if the face lies on a domain boundary.*/
+  bool IsFaceBoundary(size_t face) const { return face_flags_[face] & FACE_IS_BOUNDARY; }
+
+  /**Returns the neighbor global id of a face, or the boundary id for boundary faces.*/
+  uint64_t FaceNeighborID(size_t face) const { return face_neighbor_id_[face]; }
+
+  /**Returns the number of nodes on a face.*/
+  size_t FaceNumNodes(size_t face) const
+  {
+    return face_node_begin_[face + 1] - face_node_begin_[face];
+  }
+
+  /**Returns the cell node indices of the nodes of a face.*/
+  const int* FaceNodeMap(size_t face) const { return &face_node_map_[face_node_begin_[face]]; }
+
+  /**Returns the surface integral of each face node's shape function over a face.*/
+  const double* FaceIntSShapeI(size_t face) const
+  {
+    return &face_intS_shapeI_[face_node_begin_[face]];
+  }
+
+  /**
+   * Returns the row-major `intS_shapeI_shapeJ` matrix of a face restricted to the face nodes,
+   * i.e. entry `(fi, fj)` is the integral of the shape functions of face nodes `fi` and `fj`.
+   */
+  const double* FaceMSurf(size_t face) const { return &face_M_surf_[face_M_surf_begin_[face]]; }
+
+private:
+  static constexpr uint8_t FACE_IS_LOCAL = 1;
+  static constexpr uint8_t FACE_IS_BOUNDARY = 2;
+
+  const UnitCellMatrixStore& unit_cell_matrices_;
+
+  // Cells
+  std::vector<uint32_t> cell_num_nodes_;
+  std::vector<size_t> face_begin_;
+
+  // Faces
+  std::vector<Vector3> face_normal_;
+  std::vector<uint8_t> face_flags_;
+  std::vector<uint64_t> face_neighbor_id_;
+  std::vector<size_t> face_node_begin_;
+  std::vector<size_t> face_M_surf_begin_;
+  std::vector<double> face_M_surf_;
+
+  // Face nodes
+  std::vector<int> face_node_map_;
+  std::vector<double> face_intS_shapeI_;
+};
+
+} // namespace lbs
+} // namespace opensn
@@ -62,6 +62,14 @@ SteadyStateSolver::Execute()
     lbs_solver_.ReorientAdjointSolution();
 
   lbs_solver_.UpdateFieldFunctions();
+
+  const auto& options = lbs_solver_.Options();
+  if (options.write_restart_data)
+    lbs_solver_.WriteRestartData(options.write_restart_folder_name,
+                                 options.write_restart_file_base);
+
+  if (lbs_solver_.Options().log_performance_counters)
+    LogPerformanceCounters(lbs_solver_.GetPerformanceCounters());
 }
 
 } // namespace lbs
@@ -104,6 +104,9 @@ XXNonLinearKEigen::Execute()
 
   lbs_solver_.UpdateFieldFunctions();
 
+  if (lbs_solver_.Options().log_performance_counters)
+    LogPerformanceCounters(lbs_solver_.GetPerformanceCounters());
+
   log.Log() << "LinearBoltzmann::KEigenvalueSolver execution completed\n\n";
 }
 
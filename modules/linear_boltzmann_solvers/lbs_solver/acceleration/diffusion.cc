@@ -18,7 +18,7 @@ DiffusionSolver::DiffusionSolver(std::string text_name,
                                  const UnknownManager& uk_man,
                                  std::map<uint64_t, BoundaryCondition> bcs,
                                  MatID2XSMap map_mat_id_2_xs,
-                                 const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                                 const UnitCellMatrixStore& unit_cell_matrices,
                                  const bool verbose,
                                  const bool requires_ghosts)
   : text_name_(std::move(text_name)),
@@ -110,6 +110,12 @@ DiffusionSolver::AddToRHS(const std::vector<double>& values)
   VecAssemblyEnd(rhs_);
 }
 
+void
+DiffusionSolver::InitializeMatrixFree()
+{
+  OpenSnLogicalError(text_name_ + ": The matrix-free operator is not supported by this solver.");
+}
+
 void
 DiffusionSolver::Initialize()
 {
@@ -119,21 +125,29 @@ DiffusionSolver::Initialize()
   if (options.verbose)
     log.Log() << text_name_ << ": Global number of DOFs=" << num_global_dofs_;
 
-  opensn::mpi_comm.barrier();
-  log.Log() << "Sparsity pattern";
-  opensn::mpi_comm.barrier();
-  // Create Matrix
-  std::vector<int64_t> nodal_nnz_in_diag;
-  std::vector<int64_t> nodal_nnz_off_diag;
-  sdm_.BuildSparsityPattern(nodal_nnz_in_diag, nodal_nnz_off_diag, uk_man_);
-  opensn::mpi_comm.barrier();
-  log.Log() << "Done Sparsity pattern";
-  opensn::mpi_comm.barrier();
-  A_ = CreateSquareMatrix(num_local_dofs_, num_global_dofs_);
-  InitMatrixSparsity(A_, nodal_nnz_in_diag, nodal_nnz_off_diag);
-  opensn::mpi_comm.barrier();
-  log.Log() << "Done matrix creation";
-  opensn::mpi_comm.barrier();
+  if (options.matrix_free)
+  {
+    InitializeMatrixFree();
+    log.Log() << "Done matrix-free operator creation";
+  }
+  else
+  {
+    opensn::mpi_comm.barrier();
+    log.Log() << "Sparsity pattern";
+    opensn::mpi_comm.barrier();
+    // Create Matrix
+    std::vector<int64_t> nodal_nnz_in_diag;
+    std::vector<int64_t> nodal_nnz_off_diag;
+    sdm_.BuildSparsityPattern(nodal_nnz_in_diag, nodal_nnz_off_diag, uk_man_);
+    opensn::mpi_comm.barrier();
+    log.Log() << "Done Sparsity pattern";
+    opensn::mpi_comm.barrier();
+    A_ = CreateSquareMatrix(num_local_dofs_, num_global_dofs_);
+    InitMatrixSparsity(A_, nodal_nnz_in_diag, nodal_nnz_off_diag);
+    opensn::mpi_comm.barrier();
+    log.Log() << "Done matrix creation";
+    opensn::mpi_comm.barrier();
+  }
 
   // Create RHS
   if (not requires_ghosts_)
@@ -200,7 +214,8 @@ DiffusionSolver::Solve(std::vector<double>& solution, bool use_initial_guess)
   KSPSetTolerances(
     ksp_, options.residual_tolerance, options.residual_tolerance, 1.0e50, options.max_iters);
 
-  if (options.perform_symmetry_check)
+  // Symmetry can only be checked on an assembled matrix
+  if (options.perform_symmetry_check and not options.matrix_free)
   {
     PetscBool symmetry = PETSC_FALSE;
     MatIsSymmetric(A_, 1.0e-6, &symmetry);
@@ -272,7 +287,8 @@ DiffusionSolver::Solve(Vec petsc_solution, bool use_initial_guess)
   KSPSetTolerances(
     ksp_, options.residual_tolerance, options.residual_tolerance, 1.0e50, options.max_iters);
 
-  if (options.perform_symmetry_check)
+  // Symmetry can only be checked on an assembled matrix
+  if (options.perform_symmetry_check and not options.matrix_free)
   {
     PetscBool symmetry = PETSC_FALSE;
     MatIsSymmetric(A_, 1.0e-6, &symmetry);
@@ -16,7 +16,7 @@ class SpatialDiscretization;
 
 namespace lbs
 {
-struct UnitCellMatrices;
+class UnitCellMatrixStore;
 struct Multigroup_D_and_sigR;
 
 /**
@@ -36,7 +36,7 @@ protected:
 
   const MatID2XSMap mat_id_2_xs_map_;
 
-  const std::vector<UnitCellMatrices>& unit_cell_matrices_;
+  const UnitCellMatrixStore& unit_cell_matrices_;
 
   const int64_t num_local_dofs_;
   const int64_t num_global_dofs_;
@@ -47,6 +47,13 @@ protected:
 
   const bool requires_ghosts_;
 
+  /**
+   * Creates the matrix-free operator `A_` and whatever else the solver needs to apply it. Called
+   * by Initialize instead of creating the assembled matrix when `options.matrix_free` is set. The
+   * default implementation throws.
+   */
+  virtual void InitializeMatrixFree();
+
 public:
   struct Options
   {
@@ -56,6 +63,14 @@ public:
     bool perform_symmetry_check = false; ///< For debugging only (very expensive)
     std::string additional_options_string;
     double penalty_factor = 4.0;
+    /**Applies the operator without assembling it. The Krylov solver is then preconditioned with
+     * a cheaper, assembled low-order operator. Only supported by solvers that implement
+     * InitializeMatrixFree.*/
+    bool matrix_free = false;
+    /**With `matrix_free`, also assembles the operator once and logs the relative difference of
+     * the two operators applied to the same vector, throwing if they differ beyond round-off.
+     * For debugging only (very expensive).*/
+    bool perform_matrix_free_check = false;
   } options;
 
 public:
@@ -64,7 +79,7 @@ public:
                   const UnknownManager& uk_man,
                   std::map<uint64_t, BoundaryCondition> bcs,
                   MatID2XSMap map_mat_id_2_xs,
-                  const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                  const UnitCellMatrixStore& unit_cell_matrices,
                   bool verbose,
                   bool requires_ghosts);
 
@@ -7,10 +7,12 @@
 #include "framework/math/spatial_discretization/finite_element/finite_element_data.h"
 #include "framework/math/spatial_discretization/spatial_discretization.h"
 #include "framework/math/functions/scalar_spatial_function.h"
-#include "modules/linear_boltzmann_solvers/lbs_solver/lbs_structs.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/unit_cell_matrix_store.h"
+#include "framework/math/petsc_utils/petsc_utils.h"
 #include "framework/runtime.h"
 #include "framework/logging/log.h"
 #include "framework/utils/timer.h"
+#include <cmath>
 #include <utility>
 
 namespace opensn
@@ -18,6 +20,23 @@ namespace opensn
 namespace lbs
 {
 
+namespace
+{
+
+/**MATOP_MULT of the matrix-free MIP operator.*/
+int
+MIPMatrixFreeMult(Mat A, Vec x, Vec y)
+{
+  DiffusionMIPSolver* solver;
+  MatShellGetContext(A, &solver);
+
+  solver->ApplyMatrixFree(x, y);
+
+  return 0;
+}
+
+} // namespace
+
 void
 DiffusionMIPSolver::SetSourceFunction(std::shared_ptr<ScalarSpatialFunction> function)
 {
@@ -35,7 +54,7 @@ DiffusionMIPSolver::DiffusionMIPSolver(std::string text_name,
                                        const UnknownManager& uk_man,
                                        std::map<uint64_t, BoundaryCondition> bcs,
                                        MatID2XSMap map_mat_id_2_xs,
-                                       const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                                       const UnitCellMatrixStore& unit_cell_matrices,
                                        const bool verbose)
   : DiffusionSolver(std::move(text_name),
                     sdm,
@@ -54,6 +73,473 @@ DiffusionMIPSolver::DiffusionMIPSolver(std::string text_name,
                            " used with PWLD.");
 }
 
+DiffusionMIPSolver::~DiffusionMIPSolver()
+{
+  MatDestroy(&P_);
+  VecDestroy(&mf_ghost_x_);
+  VecDestroy(&mf_ghost_y_);
+  VecScatterDestroy(&mf_ghost_scatter_);
+}
+
+void
+DiffusionMIPSolver::InitializeMatrixFree()
+{
+  const size_t num_groups = uk_man_.unknowns_.front().num_components_;
+
+  // Precompute the cell and face data. Adjacent nodes owned by other locations are numbered
+  // in the order they are encountered and stored group-contiguous in the ghost vectors.
+  std::map<std::pair<uint64_t, int>, int64_t> ghost_node_ids;
+  std::vector<int64_t> ghost_dofs;
+
+  mf_cells_.assign(grid_.local_cells.size(), {});
+  for (const auto& cell : grid_.local_cells)
+  {
+    const auto& cell_mapping = sdm_.GetCellMapping(cell);
+    const auto cc_nodes = cell_mapping.GetNodeLocations();
+    const size_t num_faces = cell.faces_.size();
+
+    auto& mf_cell = mf_cells_[cell.local_id_];
+    mf_cell.xs = &mat_id_2_xs_map_.at(cell.material_id_);
+    mf_cell.kappa_factor = (cell.Type() == CellType::POLYHEDRON) ? 2.0 : 1.0;
+    sdm_.MapDOFsLocal(cell, uk_man_, 0, 0, mf_cell.dofs);
+    if (num_groups > 1)
+      mf_group_stride_ = sdm_.MapDOFLocal(cell, 0, uk_man_, 0, 1) - mf_cell.dofs[0];
+
+    mf_cell.faces.resize(num_faces);
+    for (size_t f = 0; f < num_faces; ++f)
+    {
+      const auto& face = cell.faces_[f];
+      auto& mf_face = mf_cell.faces[f];
+      mf_face.hm = HPerpendicular(cell, f);
+
+      if (not face.has_neighbor_)
+      {
+        if (bcs_.count(face.neighbor_id_) > 0)
+          mf_face.bc = bcs_.at(face.neighbor_id_);
+        continue;
+      }
+
+      const auto& adj_cell = grid_.cells[face.neighbor_id_];
+      const auto ac_nodes = sdm_.GetCellMapping(adj_cell).GetNodeLocations();
+      const size_t acf = MeshContinuum::MapCellFace(cell, adj_cell, f);
+      const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
+
+      mf_face.hp = HPerpendicular(adj_cell, acf);
+      mf_face.adj_cell = &adj_cell;
+      mf_face.adj_xs = &mat_id_2_xs_map_.at(adj_cell.material_id_);
+      mf_face.adj_is_local = grid_.IsCellLocal(adj_cell.global_id_);
+      mf_face.plus_nodes.resize(num_face_nodes);
+      mf_face.plus_dofs.resize(num_face_nodes);
+      for (size_t fj = 0; fj < num_face_nodes; ++fj)
+      {
+        const int jp = MapFaceNodeDisc(cell, adj_cell, cc_nodes, ac_nodes, f, acf, fj);
+        mf_face.plus_nodes[fj] = jp;
+
+        if (mf_face.adj_is_local)
+          mf_face.plus_dofs[fj] = sdm_.MapDOFLocal(adj_cell, jp, uk_man_, 0, 0);
+        else
+        {
+          const auto key = std::make_pair(adj_cell.global_id_, jp);
+          auto it = ghost_node_ids.find(key);
+          if (it == ghost_node_ids.end())
+          {
+            it = ghost_node_ids.emplace(key, static_cast<int64_t>(ghost_node_ids.size())).first;
+            for (size_t g = 0; g < num_groups; ++g)
+              ghost_dofs.push_back(sdm_.MapDOF(adj_cell, jp, uk_man_, 0, g));
+          }
+          mf_face.plus_dofs[fj] = it->second * static_cast<int64_t>(num_groups);
+        }
+      } // for fj
+    }   // for f
+  }     // for cell
+
+  // Ghost exchange
+  const auto num_ghost_dofs = static_cast<int64_t>(ghost_dofs.size());
+  VecCreateSeq(PETSC_COMM_SELF, num_ghost_dofs, &mf_ghost_x_);
+  VecDuplicate(mf_ghost_x_, &mf_ghost_y_);
+
+  IS ghost_set;
+  ISCreateGeneral(PETSC_COMM_SELF, num_ghost_dofs, ghost_dofs.data(), PETSC_COPY_VALUES, &ghost_set);
+  Vec x_template = CreateVector(num_local_dofs_, num_global_dofs_);
+  VecScatterCreate(x_template, ghost_set, mf_ghost_x_, nullptr, &mf_ghost_scatter_);
+  VecDestroy(&x_template);
+  ISDestroy(&ghost_set);
+
+  // Operator
+  MatCreateShell(opensn::mpi_comm,
+                 num_local_dofs_,
+                 num_local_dofs_,
+                 num_global_dofs_,
+                 num_global_dofs_,
+                 this,
+                 &A_);
+  MatShellSetOperation(A_, MATOP_MULT, (void (*)())MIPMatrixFreeMult);
+
+  // Low-order preconditioner sparsity: the nodes of the cell plus, for face nodes, the matching
+  // face nodes of the adjacent cells
+  std::vector<int64_t> nnz_in_diag(num_local_dofs_, 0);
+  std::vector<int64_t> nnz_off_diag(num_local_dofs_, 0);
+  for (const auto& cell : grid_.local_cells)
+  {
+    const auto& cell_mapping = sdm_.GetCellMapping(cell);
+    const auto& mf_cell = mf_cells_[cell.local_id_];
+    const size_t num_nodes = mf_cell.dofs.size();
+
+    for (size_t g = 0; g < num_groups; ++g)
+    {
+      const int64_t go = static_cast<int64_t>(g) * mf_group_stride_;
+      for (size_t i = 0; i < num_nodes; ++i)
+        nnz_in_diag[mf_cell.dofs[i] + go] += static_cast<int64_t>(num_nodes);
+
+      for (size_t f = 0; f < mf_cell.faces.size(); ++f)
+      {
+        const auto& mf_face = mf_cell.faces[f];
+        if (not mf_face.adj_cell)
+          continue;
+        auto& nnz = mf_face.adj_is_local ? nnz_in_diag : nnz_off_diag;
+        const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
+        for (size_t fi = 0; fi < num_face_nodes; ++fi)
+          nnz[mf_cell.dofs[cell_mapping.MapFaceNode(f, fi)] + go] +=
+            static_cast<int64_t>(num_face_nodes);
+      }
+    }
+  }
+
+  P_ = CreateSquareMatrix(num_local_dofs_, num_global_dofs_);
+  InitMatrixSparsity(P_, nnz_in_diag, nnz_off_diag);
+}
+
+void
+DiffusionMIPSolver::ApplyMatrixFree(Vec x, Vec y)
+{
+  const size_t num_groups = uk_man_.unknowns_.front().num_components_;
+
+  // Gather the adjacent values owned by other locations
+  VecScatterBegin(mf_ghost_scatter_, x, mf_ghost_x_, INSERT_VALUES, SCATTER_FORWARD);
+  VecScatterEnd(mf_ghost_scatter_, x, mf_ghost_x_, INSERT_VALUES, SCATTER_FORWARD);
+  VecSet(mf_ghost_y_, 0.0);
+  VecSet(y, 0.0);
+
+  const double* x_local;
+  const double* x_ghost;
+  double* y_local;
+  double* y_ghost;
+  VecGetArrayRead(x, &x_local);
+  VecGetArrayRead(mf_ghost_x_, &x_ghost);
+  VecGetArray(y, &y_local);
+  VecGetArray(mf_ghost_y_, &y_ghost);
+
+  for (const auto& cell : grid_.local_cells)
+  {
+    const auto& cell_mapping = sdm_.GetCellMapping(cell);
+    const auto& unit_cell_matrices = unit_cell_matrices_[cell.local_id_];
+    const auto& intV_gradshapeI_gradshapeJ = unit_cell_matrices.intV_gradshapeI_gradshapeJ;
+    const auto& intV_shapeI_shapeJ = unit_cell_matrices.intV_shapeI_shapeJ;
+
+    const auto& mf_cell = mf_cells_[cell.local_id_];
+    const auto& dofs = mf_cell.dofs;
+    const size_t num_nodes = dofs.size();
+    const size_t num_faces = mf_cell.faces.size();
+
+    for (size_t g = 0; g < num_groups; ++g)
+    {
+      const double Dg = mf_cell.xs->Dg[g];
+      const double sigr_g = mf_cell.xs->sigR[g];
+      const int64_t go = static_cast<int64_t>(g) * mf_group_stride_;
+
+      // Continuous terms
+      for (size_t i = 0; i < num_nodes; ++i)
+      {
+        double yi = 0.0;
+        for (size_t j = 0; j < num_nodes; ++j)
+          yi += (Dg * intV_gradshapeI_gradshapeJ[i][j] + sigr_g * intV_shapeI_shapeJ[i][j]) *
+                x_local[dofs[j] + go];
+        y_local[dofs[i] + go] += yi;
+      }
+
+      // Face terms
+      for (size_t f = 0; f < num_faces; ++f)
+      {
+        const auto& mf_face = mf_cell.faces[f];
+        const auto& n_f = cell.faces_[f].normal_;
+        const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
+
+        const auto& intS_shapeI_shapeJ = unit_cell_matrices.intS_shapeI_shapeJ[f];
+        const auto& intS_shapeI_gradshapeJ = unit_cell_matrices.intS_shapeI_gradshapeJ[f];
+
+        if (mf_face.adj_cell)
+        {
+          const double* x_plus = mf_face.adj_is_local ? x_local : x_ghost;
+          double* y_plus = mf_face.adj_is_local ? y_local : y_ghost;
+          const int64_t gp = mf_face.adj_is_local ? go : static_cast<int64_t>(g);
+          const auto& plus_dofs = mf_face.plus_dofs;
+
+          const double adj_Dg = mf_face.adj_xs->Dg[g];
+          const double kappa = fmax(options.penalty_factor * mf_cell.kappa_factor *
+                                      (adj_Dg / mf_face.hp + Dg / mf_face.hm) * 0.5,
+                                    0.25);
+
+          // Penalty terms
+          for (size_t fi = 0; fi < num_face_nodes; ++fi)
+          {
+            const int i = cell_mapping.MapFaceNode(f, fi);
+            double yi = 0.0;
+            for (size_t fj = 0; fj < num_face_nodes; ++fj)
+            {
+              const int jm = cell_mapping.MapFaceNode(f, fj);
+              yi += kappa * intS_shapeI_shapeJ[i][jm] *
+                    (x_local[dofs[jm] + go] - x_plus[plus_dofs[fj] + gp]);
+            }
+            y_local[dofs[i] + go] += yi;
+          }
+
+          // 0.5*D* n dot (b_j^+ - b_j^-)*nabla b_i^-
+          for (size_t i = 0; i < num_nodes; ++i)
+          {
+            double yi = 0.0;
+            for (size_t fj = 0; fj < num_face_nodes; ++fj)
+            {
+              const int jm = cell_mapping.MapFaceNode(f, fj);
+              const double aij = -0.5 * Dg * n_f.Dot(intS_shapeI_gradshapeJ[jm][i]);
+              yi += aij * (x_local[dofs[jm] + go] - x_plus[plus_dofs[fj] + gp]);
+            }
+            y_local[dofs[i] + go] += yi;
+          }
+
+          // 0.5*D* n dot (b_i^+ - b_i^-)*nabla b_j^-
+          for (size_t fi = 0; fi < num_face_nodes; ++fi)
+          {
+            const int im = cell_mapping.MapFaceNode(f, fi);
+            double yi = 0.0;
+            for (size_t j = 0; j < num_nodes; ++j)
+              yi += -0.5 * Dg * n_f.Dot(intS_shapeI_gradshapeJ[im][j]) * x_local[dofs[j] + go];
+            y_local[dofs[im] + go] += yi;
+            y_plus[plus_dofs[fi] + gp] -= yi;
+          }
+        } // internal face
+        else if (mf_face.bc.type == BCType::DIRICHLET)
+        {
+          const double kappa =
+            fmax(options.penalty_factor * mf_cell.kappa_factor * Dg / mf_face.hm, 0.25);
+
+          // Penalty terms
+          for (size_t fi = 0; fi < num_face_nodes; ++fi)
+          {
+            const int i = cell_mapping.MapFaceNode(f, fi);
+            double yi = 0.0;
+            for (size_t fj = 0; fj < num_face_nodes; ++fj)
+            {
+              const int jm = cell_mapping.MapFaceNode(f, fj);
+              yi += kappa * intS_shapeI_shapeJ[i][jm] * x_local[dofs[jm] + go];
+            }
+            y_local[dofs[i] + go] += yi;
+          }
+
+          // D* n dot (b_j^+ - b_j^-)*nabla b_i^-
+          for (size_t i = 0; i < num_nodes; ++i)
+          {
+            double yi = 0.0;
+            for (size_t j = 0; j < num_nodes; ++j)
+              yi += -Dg * n_f.Dot(intS_shapeI_gradshapeJ[j][i] + intS_shapeI_gradshapeJ[i][j]) *
+                    x_local[dofs[j] + go];
+            y_local[dofs[i] + go] += yi;
+          }
+        } // Dirichlet BC
+        else if (mf_face.bc.type == BCType::ROBIN)
+        {
+          const double aval = mf_face.bc.values[0];
+          const double bval = mf_face.bc.values[1];
+
+          if (std::fabs(bval) < 1.0e-12 or std::fabs(aval) < 1.0e-12)
+            continue;
+
+          for (size_t fi = 0; fi < num_face_nodes; ++fi)
+          {
+            const int i = cell_mapping.MapFaceNode(f, fi);
+            double yi = 0.0;
+            for (size_t fj = 0; fj < num_face_nodes; ++fj)
+            {
+              const int j = cell_mapping.MapFaceNode(f, fj);
+              yi += (aval / bval) * intS_shapeI_shapeJ[i][j] * x_local[dofs[j] + go];
+            }
+            y_local[dofs[i] + go] += yi;
+          }
+        } // Robin BC
+      }   // for face
+    }     // for g
+  }       // for cell
+
+  VecRestoreArrayRead(x, &x_local);
+  VecRestoreArrayRead(mf_ghost_x_, &x_ghost);
+  VecRestoreArray(y, &y_local);
+  VecRestoreArray(mf_ghost_y_, &y_ghost);
+
+  // Add the contributions to rows owned by other locations
+  VecScatterBegin(mf_ghost_scatter_, mf_ghost_y_, y, ADD_VALUES, SCATTER_REVERSE);
+  VecScatterEnd(mf_ghost_scatter_, mf_ghost_y_, y, ADD_VALUES, SCATTER_REVERSE);
+}
+
+void
+DiffusionMIPSolver::AssembleLowOrderPreconditioner()
+{
+  const size_t num_groups = uk_man_.unknowns_.front().num_components_;
+
+  std::vector<int64_t> cell_dofs;
+  for (const auto& cell : grid_.local_cells)
+  {
+    const auto& cell_mapping = sdm_.GetCellMapping(cell);
+    const auto& unit_cell_matrices = unit_cell_matrices_[cell.local_id_];
+    const auto& intV_gradshapeI_gradshapeJ = unit_cell_matrices.intV_gradshapeI_gradshapeJ;
+    const auto& intV_shapeI_shapeJ = unit_cell_matrices.intV_shapeI_shapeJ;
+
+    const auto& mf_cell = mf_cells_[cell.local_id_];
+    const size_t num_nodes = mf_cell.dofs.size();
+    const size_t num_faces = mf_cell.faces.size();
+
+    for (size_t g = 0; g < num_groups; ++g)
+    {
+      const double Dg = mf_cell.xs->Dg[g];
+      const double sigr_g = mf_cell.xs->sigR[g];
+
+      sdm_.MapDOFs(cell, uk_man_, 0, g, cell_dofs);
+
+      // Continuous terms
+      for (size_t i = 0; i < num_nodes; ++i)
+        for (size_t j = 0; j < num_nodes; ++j)
+          MatSetValue(P_,
+                      cell_dofs[i],
+                      cell_dofs[j],
+                      Dg * intV_gradshapeI_gradshapeJ[i][j] + sigr_g * intV_shapeI_shapeJ[i][j],
+                      ADD_VALUES);
+
+      // Face terms
+      for (size_t f = 0; f < num_faces; ++f)
+      {
+        const auto& mf_face = mf_cell.faces[f];
+        const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
+        const auto& intS_shapeI_shapeJ = unit_cell_matrices.intS_shapeI_shapeJ[f];
+
+        if (mf_face.adj_cell)
+        {
+          const double adj_Dg = mf_face.adj_xs->Dg[g];
+          const double kappa = fmax(options.penalty_factor * mf_cell.kappa_factor *
+                                      (adj_Dg / mf_face.hp + Dg / mf_face.hm) * 0.5,
+                                    0.25);
+
+          for (size_t fi = 0; fi < num_face_nodes; ++fi)
+          {
+            const int i = cell_mapping.MapFaceNode(f, fi);
+            for (size_t fj = 0; fj < num_face_nodes; ++fj)
+            {
+              const int jm = cell_mapping.MapFaceNode(f, fj);
+              const int64_t jpmap =
+                sdm_.MapDOF(*mf_face.adj_cell, mf_face.plus_nodes[fj], uk_man_, 0, g);
+              const double aij = kappa * intS_shapeI_shapeJ[i][jm];
+
+              MatSetValue(P_, cell_dofs[i], cell_dofs[jm], aij, ADD_VALUES);
+              MatSetValue(P_, cell_dofs[i], jpmap, -aij, ADD_VALUES);
+            }
+          }
+        } // internal face
+        else if (mf_face.bc.type == BCType::DIRICHLET)
+        {
+          const double kappa =
+            fmax(options.penalty_factor * mf_cell.kappa_factor * Dg / mf_face.hm, 0.25);
+
+          for (size_t fi = 0; fi < num_face_nodes; ++fi)
+          {
+            const int i = cell_mapping.MapFaceNode(f, fi);
+            for (size_t fj = 0; fj < num_face_nodes; ++fj)
+            {
+              const int jm = cell_mapping.MapFaceNode(f, fj);
+              MatSetValue(
+                P_, cell_dofs[i], cell_dofs[jm], kappa * intS_shapeI_shapeJ[i][jm], ADD_VALUES);
+            }
+          }
+        } // Dirichlet BC
+        else if (mf_face.bc.type == BCType::ROBIN)
+        {
+          const double aval = mf_face.bc.values[0];
+          const double bval = mf_face.bc.values[1];
+
+          if (std::fabs(bval) < 1.0e-12 or std::fabs(aval) < 1.0e-12)
+            continue;
+
+          for (size_t fi = 0; fi < num_face_nodes; ++fi)
+          {
+            const int i = cell_mapping.MapFaceNode(f, fi);
+            for (size_t fj = 0; fj < num_face_nodes; ++fj)
+            {
+              const int j = cell_mapping.MapFaceNode(f, fj);
+              MatSetValue(P_,
+                          cell_dofs[i],
+                          cell_dofs[j],
+                          (aval / bval) * intS_shapeI_shapeJ[i][j],
+                          ADD_VALUES);
+            }
+          }
+        } // Robin BC
+      }   // for face
+    }     // for g
+  }       // for cell
+
+  MatAssemblyBegin(P_, MAT_FINAL_ASSEMBLY);
+  MatAssemblyEnd(P_, MAT_FINAL_ASSEMBLY);
+}
+
+void
+DiffusionMIPSolver::CheckMatrixFreeOperator(const std::vector<double>& q_vector)
+{
+  // Assemble the operator with the production assembly in place of the shell operator
+  Mat shell = A_;
+  std::vector<int64_t> nodal_nnz_in_diag;
+  std::vector<int64_t> nodal_nnz_off_diag;
+  sdm_.BuildSparsityPattern(nodal_nnz_in_diag, nodal_nnz_off_diag, uk_man_);
+  A_ = CreateSquareMatrix(num_local_dofs_, num_global_dofs_);
+  InitMatrixSparsity(A_, nodal_nnz_in_diag, nodal_nnz_off_diag);
+
+  options.matrix_free = false;
+  AssembleAand_b(q_vector);
+  options.matrix_free = true;
+
+  // A non-trivial test vector
+  Vec x, y_assembled, y_matrix_free;
+  VecDuplicate(rhs_, &x);
+  VecDuplicate(rhs_, &y_assembled);
+  VecDuplicate(rhs_, &y_matrix_free);
+
+  PetscInt first_dof, last_dof;
+  VecGetOwnershipRange(x, &first_dof, &last_dof);
+  double* x_raw;
+  VecGetArray(x, &x_raw);
+  for (PetscInt i = first_dof; i < last_dof; ++i)
+    x_raw[i - first_dof] = 1.0 + 0.5 * std::sin(static_cast<double>(i));
+  VecRestoreArray(x, &x_raw);
+
+  MatMult(A_, x, y_assembled);
+  ApplyMatrixFree(x, y_matrix_free);
+
+  double norm_assembled;
+  double norm_difference;
+  VecNorm(y_assembled, NORM_2, &norm_assembled);
+  VecAXPY(y_matrix_free, -1.0, y_assembled);
+  VecNorm(y_matrix_free, NORM_2, &norm_difference);
+
+  const double relative_difference = norm_difference / norm_assembled;
+  log.Log() << text_name_ << ": Matrix-free operator relative difference "
+            << relative_difference;
+
+  VecDestroy(&x);
+  VecDestroy(&y_assembled);
+  VecDestroy(&y_matrix_free);
+  MatDestroy(&A_);
+  A_ = shell;
+
+  if (relative_difference > 1.0e-10)
+    throw std::logic_error("lbs::acceleration::DiffusionMIPSolver::CheckMatrixFreeOperator: "
+                           "Matrix-free check failed");
+}
+
 void
 DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
 {
@@ -62,6 +548,8 @@ DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
   if (A_ == nullptr or rhs_ == nullptr or ksp_ == nullptr)
     throw std::logic_error(fname + ": Some or all PETSc elements are null. "
                                    "Check that Initialize has been called.");
+  if (options.matrix_free)
+    throw std::logic_error(fname + ": Not supported with the matrix-free operator.");
   if (options.verbose)
     log.Log() << program_timer.GetTimeString() << " Starting assembly";
 
@@ -69,6 +557,7 @@ DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
 
   VecSet(rhs_, 0.0);
 
+  std::vector<int64_t> cell_dofs, cell_local_dofs, adj_cell_dofs;
   for (const auto& cell : grid_.local_cells)
   {
     const size_t num_faces = cell.faces_.size();
@@ -86,18 +575,21 @@ DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
       const double Dg = xs.Dg[g];
       const double sigr_g = xs.sigR[g];
 
+      sdm_.MapDOFs(cell, uk_man_, 0, g, cell_dofs);
+      sdm_.MapDOFsLocal(cell, uk_man_, 0, g, cell_local_dofs);
+
       std::vector<double> qg(num_nodes, 0.0);
       for (size_t j = 0; j < num_nodes; j++)
-        qg[j] = q_vector[sdm_.MapDOFLocal(cell, j, uk_man_, 0, g)];
+        qg[j] = q_vector[cell_local_dofs[j]];
 
       // Assemble continuous terms
       for (size_t i = 0; i < num_nodes; i++)
       {
-        const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+        const int64_t imap = cell_dofs[i];
         double entry_rhs_i = 0.0; // entry may accumulate over j
         for (size_t j = 0; j < num_nodes; j++)
         {
-          const int64_t jmap = sdm_.MapDOF(cell, j, uk_man_, 0, g);
+          const int64_t jmap = cell_dofs[j];
           double entry_aij = 0.0;
           for (size_t qp : fe_vol_data.QuadraturePointIndices())
           {
@@ -139,6 +631,7 @@ DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
         if (face.has_neighbor_)
         {
           const auto& adj_cell = grid_.cells[face.neighbor_id_];
+          sdm_.MapDOFs(adj_cell, uk_man_, 0, g, adj_cell_dofs);
           const auto& adj_cell_mapping = sdm_.GetCellMapping(adj_cell);
           const auto ac_nodes = adj_cell_mapping.GetNodeLocations();
           const size_t acf = Grid::MapCellFace(cell, adj_cell, f);
@@ -160,15 +653,15 @@ DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
           for (size_t fi = 0; fi < num_face_nodes; ++fi)
           {
             const int i = cell_mapping.MapFaceNode(f, fi);
-            const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+            const int64_t imap = cell_dofs[i];
 
             for (size_t fj = 0; fj < num_face_nodes; ++fj)
             {
               const int jm = cell_mapping.MapFaceNode(f, fj); // j-minus
               const int jp =
                 MapFaceNodeDisc(cell, adj_cell, cc_nodes, ac_nodes, f, acf, fj); // j-plus
-              const int64_t jmmap = sdm_.MapDOF(cell, jm, uk_man_, 0, g);
-              const int64_t jpmap = sdm_.MapDOF(adj_cell, jp, uk_man_, 0, g);
+              const int64_t jmmap = cell_dofs[jm];
+              const int64_t jpmap = adj_cell_dofs[jp];
 
               double aij = 0.0;
               for (size_t qp : fe_srf_data.QuadraturePointIndices())
@@ -187,15 +680,15 @@ DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
           // 0.5*D* n dot (b_j^+ - b_j^-)*nabla b_i^-
           for (int i = 0; i < num_nodes; i++)
           {
-            const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+            const int64_t imap = cell_dofs[i];
 
             for (int fj = 0; fj < num_face_nodes; fj++)
             {
               const int jm = cell_mapping.MapFaceNode(f, fj); // j-minus
               const int jp =
                 MapFaceNodeDisc(cell, adj_cell, cc_nodes, ac_nodes, f, acf, fj); // j-plus
-              const int64_t jmmap = sdm_.MapDOF(cell, jm, uk_man_, 0, g);
-              const int64_t jpmap = sdm_.MapDOF(adj_cell, jp, uk_man_, 0, g);
+              const int64_t jmmap = cell_dofs[jm];
+              const int64_t jpmap = adj_cell_dofs[jp];
 
               Vector3 vec_aij;
               for (size_t qp : fe_srf_data.QuadraturePointIndices())
@@ -214,12 +707,12 @@ DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
             const int im = cell_mapping.MapFaceNode(f, fi); // i-minus
             const int ip =
               MapFaceNodeDisc(cell, adj_cell, cc_nodes, ac_nodes, f, acf, fi); // i-plus
-            const int64_t immap = sdm_.MapDOF(cell, im, uk_man_, 0, g);
-            const int64_t ipmap = sdm_.MapDOF(adj_cell, ip, uk_man_, 0, g);
+            const int64_t immap = cell_dofs[im];
+            const int64_t ipmap = adj_cell_dofs[ip];
 
             for (int j = 0; j < num_nodes; j++)
             {
-              const int64_t jmap = sdm_.MapDOF(cell, j, uk_man_, 0, g);
+              const int64_t jmap = cell_dofs[j];
 
               Vector3 vec_aij;
               for (size_t qp : fe_srf_data.QuadraturePointIndices())
@@ -256,12 +749,12 @@ DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
             for (size_t fi = 0; fi < num_face_nodes; ++fi)
             {
               const int i = cell_mapping.MapFaceNode(f, fi);
-              const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+              const int64_t imap = cell_dofs[i];
 
               for (size_t fj = 0; fj < num_face_nodes; ++fj)
               {
                 const int jm = cell_mapping.MapFaceNode(f, fj);
-                const int64_t jmmap = sdm_.MapDOF(cell, jm, uk_man_, 0, g);
+                const int64_t jmmap = cell_dofs[jm];
 
                 double aij = 0.0;
                 for (size_t qp : fe_srf_data.QuadraturePointIndices())
@@ -291,11 +784,11 @@ DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
             // D* n dot (b_j^+ - b_j^-)*nabla b_i^-
             for (size_t i = 0; i < num_nodes; i++)
             {
-              const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+              const int64_t imap = cell_dofs[i];
 
               for (size_t j = 0; j < num_nodes; j++)
               {
-                const int64_t jmap = sdm_.MapDOF(cell, j, uk_man_, 0, g);
+                const int64_t jmap = cell_dofs[j];
 
                 Vector3 vec_aij;
                 for (size_t qp : fe_srf_data.QuadraturePointIndices())
@@ -336,14 +829,14 @@ DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
             for (size_t fi = 0; fi < num_face_nodes; fi++)
             {
               const int i = cell_mapping.MapFaceNode(f, fi);
-              const int64_t ir = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+              const int64_t ir = cell_dofs[i];
 
               if (std::fabs(aval) >= 1.0e-12)
               {
                 for (size_t fj = 0; fj < num_face_nodes; fj++)
                 {
                   const int j = cell_mapping.MapFaceNode(f, fj);
-                  const int64_t jr = sdm_.MapDOF(cell, j, uk_man_, 0, g);
+                  const int64_t jr = cell_dofs[j];
 
                   double aij = 0.0;
                   for (size_t qp : fe_srf_data.QuadraturePointIndices())
@@ -409,6 +902,7 @@ DiffusionMIPSolver::Assemble_b_wQpoints(const std::vector<double>& q_vector)
 
   VecSet(rhs_, 0.0);
 
+  std::vector<int64_t> cell_dofs, cell_local_dofs;
   for (const auto& cell : grid_.local_cells)
   {
     const size_t num_faces = cell.faces_.size();
@@ -425,14 +919,17 @@ DiffusionMIPSolver::Assemble_b_wQpoints(const std::vector<double>& q_vector)
       // Get coefficient and nodal src
       const double Dg = xs.Dg[g];
 
+      sdm_.MapDOFs(cell, uk_man_, 0, g, cell_dofs);
+      sdm_.MapDOFsLocal(cell, uk_man_, 0, g, cell_local_dofs);
+
       std::vector<double> qg(num_nodes, 0.0);
       for (size_t j = 0; j < num_nodes; j++)
-        qg[j] = q_vector[sdm_.MapDOFLocal(cell, j, uk_man_, 0, g)];
+        qg[j] = q_vector[cell_local_dofs[j]];
 
       // Assemble continuous terms
       for (size_t i = 0; i < num_nodes; i++)
       {
-        const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+        const int64_t imap = cell_dofs[i];
         double entry_rhs_i = 0.0; // entry may accumulate over j
         if (not source_function_)
           for (size_t j = 0; j < num_nodes; j++)
@@ -486,7 +983,7 @@ DiffusionMIPSolver::Assemble_b_wQpoints(const std::vector<double>& q_vector)
             for (size_t fi = 0; fi < num_face_nodes; ++fi)
             {
               const int i = cell_mapping.MapFaceNode(f, fi);
-              const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+              const int64_t imap = cell_dofs[i];
 
               for (size_t fj = 0; fj < num_face_nodes; ++fj)
               {
@@ -518,7 +1015,7 @@ DiffusionMIPSolver::Assemble_b_wQpoints(const std::vector<double>& q_vector)
             // 0.5*D* n dot (b_j^+ - b_j^-)*nabla b_i^-
             for (size_t i = 0; i < num_nodes; i++)
             {
-              const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+              const int64_t imap = cell_dofs[i];
 
               for (size_t j = 0; j < num_nodes; j++)
               {
@@ -559,7 +1056,7 @@ DiffusionMIPSolver::Assemble_b_wQpoints(const std::vector<double>& q_vector)
             for (size_t fi = 0; fi < num_face_nodes; fi++)
             {
               const int i = cell_mapping.MapFaceNode(f, fi);
-              const int64_t ir = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+              const int64_t ir = cell_dofs[i];
 
               if (std::fabs(fval) >= 1.0e-12)
               {
@@ -600,12 +1097,33 @@ DiffusionMIPSolver::AssembleAand_b(const std::vector<double>& q_vector)
   if (A_ == nullptr or rhs_ == nullptr or ksp_ == nullptr)
     throw std::logic_error(fname + ": Some or all PETSc elements are null. "
                                    "Check that Initialize has been called.");
+  if (options.matrix_free)
+  {
+    // The operator is applied cell-by-cell, only the preconditioner is assembled
+    if (options.verbose)
+      log.Log() << program_timer.GetTimeString() << " Starting low-order preconditioner assembly";
+    if (options.perform_matrix_free_check)
+      CheckMatrixFreeOperator(q_vector);
+    AssembleLowOrderPreconditioner();
+    Assemble_b(q_vector);
+
+    KSPSetOperators(ksp_, A_, P_);
+
+    PC pc;
+    KSPGetPC(ksp_, &pc);
+    PCSetUp(pc);
+
+    KSPSetUp(ksp_);
+    return;
+  }
+
   if (options.verbose)
     log.Log() << program_timer.GetTimeString() << " Starting assembly";
 
   const size_t num_groups = uk_man_.unknowns_.front().num_components_;
 
   VecSet(rhs_, 0.0);
+  std::vector<int64_t> cell_dofs, cell_local_dofs, adj_cell_dofs;
   for (const auto& cell : grid_.local_cells)
   {
     const size_t num_faces = cell.faces_.size();
@@ -625,18 +1143,21 @@ DiffusionMIPSolver::AssembleAand_b(const std::vector<double>& q_vector)
       const double Dg = xs.Dg[g];
       const double sigr_g = xs.sigR[g];
 
+      sdm_.MapDOFs(cell, uk_man_, 0, g, cell_dofs);
+      sdm_.MapDOFsLocal(cell, uk_man_, 0, g, cell_local_dofs);
+
       std::vector<double> qg(num_nodes, 0.0);
       for (size_t j = 0; j < num_nodes; j++)
-        qg[j] = q_vector[sdm_.MapDOFLocal(cell, j, uk_man_, 0, g)];
+        qg[j] = q_vector[cell_local_dofs[j]];
 
       // Assemble continuous terms
       for (size_t i = 0; i < num_nodes; i++)
       {
-        const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+        const int64_t imap = cell_dofs[i];
         double entry_rhs_i = 0.0;
         for (size_t j = 0; j < num_nodes; j++)
         {
-          const int64_t jmap = sdm_.MapDOF(cell, j, uk_man_, 0, g);
+          const int64_t jmap = cell_dofs[j];
 
           const double entry_aij =
             Dg * intV_gradshapeI_gradshapeJ[i][j] + sigr_g * intV_shapeI_shapeJ[i][j];
@@ -667,6 +1188,7 @@ DiffusionMIPSolver::AssembleAand_b(const std::vector<double>& q_vector)
         if (face.has_neighbor_)
         {
           const auto& adj_cell = grid_.cells[face.neighbor_id_];
+          sdm_.MapDOFs(adj_cell, uk_man_, 0, g, adj_cell_dofs);
           const auto& adj_cell_mapping = sdm_.GetCellMapping(adj_cell);
           const auto ac_nodes = adj_cell_mapping.GetNodeLocations();
           const size_t acf = Grid::MapCellFace(cell, adj_cell, f);
@@ -688,15 +1210,15 @@ DiffusionMIPSolver::AssembleAand_b(const std::vector<double>& q_vector)
           for (size_t fi = 0; fi < num_face_nodes; ++fi)
           {
             const int i = cell_mapping.MapFaceNode(f, fi);
-            const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+            const int64_t imap = cell_dofs[i];
 
             for (size_t fj = 0; fj < num_face_nodes; ++fj)
             {
               const int jm = cell_mapping.MapFaceNode(f, fj); // j-minus
               const int jp =
                 MapFaceNodeDisc(cell, adj_cell, cc_nodes, ac_nodes, f, acf, fj); // j-plus
-              const int64_t jmmap = sdm_.MapDOF(cell, jm, uk_man_, 0, g);
-              const int64_t jpmap = sdm_.MapDOF(adj_cell, jp, uk_man_, 0, g);
+              const int64_t jmmap = cell_dofs[jm];
+              const int64_t jpmap = adj_cell_dofs[jp];
 
               const double aij = kappa * intS_shapeI_shapeJ[i][jm];
 
@@ -712,15 +1234,15 @@ DiffusionMIPSolver::AssembleAand_b(const std::vector<double>& q_vector)
           // 0.5*D* n dot (b_j^+ - b_j^-)*nabla b_i^-
           for (int i = 0; i < num_nodes; i++)
           {
-            const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+            const int64_t imap = cell_dofs[i];
 
             for (int fj = 0; fj < num_face_nodes; fj++)
             {
               const int jm = cell_mapping.MapFaceNode(f, fj); // j-minus
               const int jp =
                 MapFaceNodeDisc(cell, adj_cell, cc_nodes, ac_nodes, f, acf, fj); // j-plus
-              const int64_t jmmap = sdm_.MapDOF(cell, jm, uk_man_, 0, g);
-              const int64_t jpmap = sdm_.MapDOF(adj_cell, jp, uk_man_, 0, g);
+              const int64_t jmmap = cell_dofs[jm];
+              const int64_t jpmap = adj_cell_dofs[jp];
 
               const double aij = -0.5 * Dg * n_f.Dot(intS_shapeI_gradshapeJ[jm][i]);
 
@@ -735,12 +1257,12 @@ DiffusionMIPSolver::AssembleAand_b(const std::vector<double>& q_vector)
             const int im = cell_mapping.MapFaceNode(f, fi); // i-minus
             const int ip =
               MapFaceNodeDisc(cell, adj_cell, cc_nodes, ac_nodes, f, acf, fi); // i-plus
-            const int64_t immap = sdm_.MapDOF(cell, im, uk_man_, 0, g);
-            const int64_t ipmap = sdm_.MapDOF(adj_cell, ip, uk_man_, 0, g);
+            const int64_t immap = cell_dofs[im];
+            const int64_t ipmap = adj_cell_dofs[ip];
 
             for (int j = 0; j < num_nodes; j++)
             {
-              const int64_t jmap = sdm_.MapDOF(cell, j, uk_man_, 0, g);
+              const int64_t jmap = cell_dofs[j];
 
               const double aij = -0.5 * Dg * n_f.Dot(intS_shapeI_gradshapeJ[im][j]);
 
@@ -773,12 +1295,12 @@ DiffusionMIPSolver::AssembleAand_b(const std::vector<double>& q_vector)
             for (size_t fi = 0; fi < num_face_nodes; ++fi)
             {
               const int i = cell_mapping.MapFaceNode(f, fi);
-              const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+              const int64_t imap = cell_dofs[i];
 
               for (size_t fj = 0; fj < num_face_nodes; ++fj)
               {
                 const int jm = cell_mapping.MapFaceNode(f, fj);
-                const int64_t jmmap = sdm_.MapDOF(cell, jm, uk_man_, 0, g);
+                const int64_t jmmap = cell_dofs[jm];
 
                 const double aij = kappa * intS_shapeI_shapeJ[i][jm];
                 const double aij_bc_value = aij * bc_value;
@@ -795,11 +1317,11 @@ DiffusionMIPSolver::AssembleAand_b(const std::vector<double>& q_vector)
             // D* n dot (b_j^+ - b_j^-)*nabla b_i^-
             for (size_t i = 0; i < num_nodes; i++)
             {
-              const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+              const int64_t imap = cell_dofs[i];
 
               for (size_t j = 0; j < num_nodes; j++)
               {
-                const int64_t jmap = sdm_.MapDOF(cell, j, uk_man_, 0, g);
+                const int64_t jmap = cell_dofs[j];
 
                 const double aij =
                   -Dg * n_f.Dot(intS_shapeI_gradshapeJ[j][i] + intS_shapeI_gradshapeJ[i][j]);
@@ -822,14 +1344,14 @@ DiffusionMIPSolver::AssembleAand_b(const std::vector<double>& q_vector)
             for (size_t fi = 0; fi < num_face_nodes; fi++)
             {
               const int i = cell_mapping.MapFaceNode(f, fi);
-              const int64_t ir = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+              const int64_t ir = cell_dofs[i];
 
               if (std::fabs(aval) >= 1.0e-12)
               {
                 for (size_t fj = 0; fj < num_face_nodes; fj++)
                 {
                   const int j = cell_mapping.MapFaceNode(f, fj);
-                  const int64_t jr = sdm_.MapDOF(cell, j, uk_man_, 0, g);
+                  const int64_t jr = cell_dofs[j];
 
                   const double aij = (aval / bval) * intS_shapeI_shapeJ[i][j];
 
@@ -900,6 +1422,7 @@ DiffusionMIPSolver::Assemble_b(const std::vector<double>& q_vector)
   const size_t num_groups = uk_man_.unknowns_.front().num_components_;
 
   VecSet(rhs_, 0.0);
+  std::vector<int64_t> cell_dofs, cell_local_dofs;
   for (const auto& cell : grid_.local_cells)
   {
     const size_t num_faces = cell.faces_.size();
@@ -917,14 +1440,17 @@ DiffusionMIPSolver::Assemble_b(const std::vector<double>& q_vector)
       // Get coefficient and nodal src
       const double Dg = xs.Dg[g];
 
+      sdm_.MapDOFs(cell, uk_man_, 0, g, cell_dofs);
+      sdm_.MapDOFsLocal(cell, uk_man_, 0, g, cell_local_dofs);
+
       std::vector<double> qg(num_nodes, 0.0);
       for (size_t j = 0; j < num_nodes; j++)
-        qg[j] = q_vector[sdm_.MapDOFLocal(cell, j, uk_man_, 0, g)];
+        qg[j] = q_vector[cell_local_dofs[j]];
 
       // Assemble continuous terms
       for (size_t i = 0; i < num_nodes; i++)
       {
-        const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+        const int64_t imap = cell_dofs[i];
         double entry_rhs_i = 0.0;
         for (size_t j = 0; j < num_nodes; j++)
           entry_rhs_i += intV_shapeI_shapeJ[i][j] * qg[j];
@@ -968,7 +1494,7 @@ DiffusionMIPSolver::Assemble_b(const std::vector<double>& q_vector)
             for (size_t fi = 0; fi < num_face_nodes; ++fi)
             {
               const int i = cell_mapping.MapFaceNode(f, fi);
-              const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+              const int64_t imap = cell_dofs[i];
 
               for (size_t fj = 0; fj < num_face_nodes; ++fj)
               {
@@ -988,7 +1514,7 @@ DiffusionMIPSolver::Assemble_b(const std::vector<double>& q_vector)
             // D* n dot (b_j^+ - b_j^-)*nabla b_i^-
             for (size_t i = 0; i < num_nodes; i++)
             {
-              const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+              const int64_t imap = cell_dofs[i];
 
               for (size_t j = 0; j < num_nodes; j++)
               {
@@ -1011,7 +1537,7 @@ DiffusionMIPSolver::Assemble_b(const std::vector<double>& q_vector)
             for (size_t fi = 0; fi < num_face_nodes; fi++)
             {
               const int i = cell_mapping.MapFaceNode(f, fi);
-              const int64_t ir = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+              const int64_t ir = cell_dofs[i];
 
               if (std::fabs(fval) >= 1.0e-12)
               {
@@ -1050,6 +1576,7 @@ DiffusionMIPSolver::Assemble_b(Vec petsc_q_vector)
   VecGetArrayRead(petsc_q_vector, &q_vector);
 
   VecSet(rhs_, 0.0);
+  std::vector<int64_t> cell_dofs, cell_local_dofs;
   for (const auto& cell : grid_.local_cells)
   {
     const size_t num_faces = cell.faces_.size();
@@ -1067,14 +1594,17 @@ DiffusionMIPSolver::Assemble_b(Vec petsc_q_vector)
       // Get coefficient and nodal src
       const double Dg = xs.Dg[g];
 
+      sdm_.MapDOFs(cell, uk_man_, 0, g, cell_dofs);
+      sdm_.MapDOFsLocal(cell, uk_man_, 0, g, cell_local_dofs);
+
       std::vector<double> qg(num_nodes, 0.0);
       for (size_t j = 0; j < num_nodes; j++)
-        qg[j] = q_vector[sdm_.MapDOFLocal(cell, j, uk_man_, 0, g)];
+        qg[j] = q_vector[cell_local_dofs[j]];
 
       // Assemble continuous terms
       for (size_t i = 0; i < num_nodes; i++)
       {
-        const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+        const int64_t imap = cell_dofs[i];
         double entry_rhs_i = 0.0;
         for (size_t j = 0; j < num_nodes; j++)
           entry_rhs_i += intV_shapeI_shapeJ[i][j] * qg[j];
@@ -1118,7 +1648,7 @@ DiffusionMIPSolver::Assemble_b(Vec petsc_q_vector)
             for (size_t fi = 0; fi < num_face_nodes; ++fi)
             {
               const int i = cell_mapping.MapFaceNode(f, fi);
-              const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+              const int64_t imap = cell_dofs[i];
 
               for (size_t fj = 0; fj < num_face_nodes; ++fj)
               {
@@ -1138,7 +1668,7 @@ DiffusionMIPSolver::Assemble_b(Vec petsc_q_vector)
             // D* n dot (b_j^+ - b_j^-)*nabla b_i^-
             for (size_t i = 0; i < num_nodes; i++)
             {
-              const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+              const int64_t imap = cell_dofs[i];
 
               for (size_t j = 0; j < num_nodes; j++)
               {
@@ -1161,7 +1691,7 @@ DiffusionMIPSolver::Assemble_b(Vec petsc_q_vector)
             for (size_t fi = 0; fi < num_face_nodes; fi++)
             {
               const int i = cell_mapping.MapFaceNode(f, fi);
-              const int64_t ir = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+              const int64_t ir = cell_dofs[i];
 
               if (std::fabs(fval) >= 1.0e-12)
               {
@@ -11,7 +11,7 @@ class MeshContinuum;
 class Cell;
 struct Vector3;
 class SpatialDiscretization;
-struct UnitCellMatrices;
+class UnitCellMatrixStore;
 class ScalarSpatialFunction;
 
 namespace lbs
@@ -28,9 +28,9 @@ public:
                      const UnknownManager& uk_man,
                      std::map<uint64_t, BoundaryCondition> bcs,
                      MatID2XSMap map_mat_id_2_xs,
-                     const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                     const UnitCellMatrixStore& unit_cell_matrices,
                      bool verbose);
-  virtual ~DiffusionMIPSolver() = default;
+  virtual ~DiffusionMIPSolver();
 
   void SetSourceFunction(std::shared_ptr<ScalarSpatialFunction> function);
 
@@ -49,7 +49,8 @@ public:
 
   /**
    * Assembles both the matrix and the RHS using unit cell-matrices. These are the routines used in
-   * the production versions.
+   * the production versions. With `options.matrix_free` only the low-order preconditioner matrix
+   * and the RHS are assembled.
    */
   void AssembleAand_b(const std::vector<double>& q_vector) override;
 
@@ -86,9 +87,63 @@ public:
                       size_t ccfi,
                       double epsilon = 1.0e-12);
 
+  /**
+   * Applies the MIP operator, `y = A x`, cell-by-cell from the unit cell matrices. Values on
+   * adjacent cells owned by other locations are gathered before, and their contributions
+   * scattered back after, the cell loop. Requires `options.matrix_free`.
+   */
+  void ApplyMatrixFree(Vec x, Vec y);
+
+protected:
+  void InitializeMatrixFree() override;
+
 private:
+  /**Face data of the matrix-free operator.*/
+  struct MatrixFreeFace
+  {
+    double hm = 0.0;                ///< HPerpendicular of the cell
+    double hp = 0.0;                ///< HPerpendicular of the adjacent cell
+    const Cell* adj_cell = nullptr; ///< Adjacent cell, null on boundaries
+    const Multigroup_D_and_sigR* adj_xs = nullptr;
+    bool adj_is_local = false;      ///< Whether the adjacent cell is local
+    std::vector<int> plus_nodes;    ///< Per face node, the matching adjacent cell node
+    std::vector<int64_t> plus_dofs; ///< Per face node, the group-0 address of the adjacent node
+    BoundaryCondition bc;           ///< Boundary condition of boundary faces
+  };
+
+  /**Cell data of the matrix-free operator.*/
+  struct MatrixFreeCell
+  {
+    const Multigroup_D_and_sigR* xs = nullptr;
+    double kappa_factor = 1.0;  ///< 2 for polyhedra, 1 otherwise
+    std::vector<int64_t> dofs;  ///< Per node, the local group-0 address
+    std::vector<MatrixFreeFace> faces;
+  };
+
+  /**
+   * Assembles the low-order preconditioner of the matrix-free operator: the volume terms and
+   * the interior penalty terms of MIP, without the gradient (consistency) face terms. It is
+   * symmetric positive definite and only couples the face nodes of adjacent cells.
+   */
+  void AssembleLowOrderPreconditioner();
+
+  /**
+   * Assembles the operator into a temporary matrix, applies it and the matrix-free operator to the
+   * same vector, and logs the relative difference of the results. Throws if the difference
+   * exceeds round-off.
+   */
+  void CheckMatrixFreeOperator(const std::vector<double>& q_vector);
+
   std::shared_ptr<ScalarSpatialFunction> source_function_;
   std::shared_ptr<ScalarSpatialFunction> ref_solution_function_;
+
+  // Matrix-free operator
+  std::vector<MatrixFreeCell> mf_cells_;
+  int64_t mf_group_stride_ = 1; ///< Local address stride between groups
+  Mat P_ = nullptr;             ///< Assembled low-order preconditioner
+  Vec mf_ghost_x_ = nullptr;    ///< Adjacent values owned by other locations
+  Vec mf_ghost_y_ = nullptr;    ///< Contributions to rows owned by other locations
+  VecScatter mf_ghost_scatter_ = nullptr;
 };
 
 } // namespace lbs
@@ -5,7 +5,7 @@
 #include "modules/linear_boltzmann_solvers/lbs_solver/acceleration/acceleration.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
 #include "framework/math/spatial_discretization/spatial_discretization.h"
-#include "modules/linear_boltzmann_solvers/lbs_solver/lbs_structs.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/unit_cell_matrix_store.h"
 #include "framework/runtime.h"
 #include "framework/logging/log.h"
 #include "framework/utils/timer.h"
@@ -20,7 +20,7 @@ DiffusionPWLCSolver::DiffusionPWLCSolver(std::string text_name,
                                          const UnknownManager& uk_man,
                                          std::map<uint64_t, BoundaryCondition> bcs,
                                          MatID2XSMap map_mat_id_2_xs,
-                                         const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                                         const UnitCellMatrixStore& unit_cell_matrices,
                                          bool verbose)
   : DiffusionSolver(std::move(text_name),
                     sdm,
@@ -18,7 +18,7 @@ public:
                       const UnknownManager& uk_man,
                       std::map<uint64_t, BoundaryCondition> bcs,
                       MatID2XSMap map_mat_id_2_xs,
-                      const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                      const UnitCellMatrixStore& unit_cell_matrices,
                       bool verbose);
 
   /**
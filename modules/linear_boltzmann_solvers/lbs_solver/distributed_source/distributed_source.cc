@@ -37,6 +37,11 @@ DistributedSource::GetInputParameters()
     "function_handle",
     SIZE_T_INVALID,
     "Handle to a ResponseFunction object to be used to define the source.");
+  params.AddOptionalParameter("cache_values",
+                              false,
+                              "If true, the function is evaluated at the nodes of the subscribing "
+                              "cells once, on initialization, and the values are reused in every "
+                              "source evaluation. This trades memory for function evaluations.");
 
   return params;
 }
@@ -47,7 +52,8 @@ DistributedSource::DistributedSource(const InputParameters& params)
     function_(params.ParametersAtAssignment().Has("function_handle")
                 ? GetStackItemPtrAsType<opensn::SpatialMaterialFunction>(
                     object_stack, params.GetParamValue<size_t>("function_handle"))
-                : nullptr)
+                : nullptr),
+    cache_values_(params.GetParamValue<bool>("cache_values"))
 {
 }
 
@@ -62,6 +68,26 @@ lbs::DistributedSource::Initialize(const LBSSolver& lbs_solver)
   num_local_subsribers_ = subscribers_.size();
   mpi_comm.all_reduce(num_local_subsribers_, num_global_subscribers_, mpi::op::sum<size_t>());
 
+  // Evaluate the function at the nodes of the subscribing cells, in one batch per cell
+  cached_values_.clear();
+  cached_values_begin_.clear();
+  if (cache_values_ and function_)
+  {
+    const auto& grid = lbs_solver.Grid();
+    const auto& discretization = lbs_solver.SpatialDiscretization();
+    cached_num_groups_ = lbs_solver.NumGroups();
+    cached_values_begin_.reserve(subscribers_.size() + 1);
+    cached_values_begin_.push_back(0);
+    for (const auto local_id : subscribers_)
+    {
+      const auto& cell = grid.local_cells[local_id];
+      const auto values = function_->EvaluateBatch(
+        discretization.GetCellNodeLocations(cell), cell.material_id_, cached_num_groups_);
+      cached_values_.insert(cached_values_.end(), values.begin(), values.end());
+      cached_values_begin_.push_back(cached_values_.size());
+    }
+  }
+
   log.LogAll() << "Distributed source has " << num_local_subsribers_
                << " subscribing cells on processor " << opensn::mpi_comm.rank() << ".";
   log.Log() << "Distributed source has " << num_global_subscribers_ << " total subscribing cells.";
@@ -78,4 +104,30 @@ lbs::DistributedSource::operator()(const Cell& cell, const Vector3& xyz, const i
     return function_->Evaluate(xyz, cell.material_id_, num_groups);
 }
 
+const double*
+lbs::DistributedSource::EvaluateSubscriber(const size_t subscriber,
+                                           const Cell& cell,
+                                           const std::vector<Vector3>& nodes,
+                                           const int num_groups,
+                                           std::vector<double>& buffer) const
+{
+  if (not function_)
+  {
+    buffer.assign(nodes.size() * num_groups, 1.0);
+    return buffer.data();
+  }
+
+  if (not cached_values_begin_.empty())
+  {
+    OpenSnLogicalErrorIf(static_cast<size_t>(num_groups) != cached_num_groups_,
+                         "The distributed source values were cached for " +
+                           std::to_string(cached_num_groups_) + " groups, not " +
+                           std::to_string(num_groups) + ".");
+    return cached_values_.data() + cached_values_begin_[subscriber];
+  }
+
+  buffer = function_->EvaluateBatch(nodes, cell.material_id_, num_groups);
+  return buffer.data();
+}
+
 } // namespace opensn::lbs
@@ -45,6 +45,19 @@ public:
    */
   std::vector<double> operator()(const Cell& cell, const Vector3& xyz, const int num_groups) const;
 
+  /**
+   * Evaluate the distributed source at the nodes of the subscribing cell with index `subscriber`
+   * in Subscribers(), for all groups, with one batched function evaluation. Returns a pointer to
+   * the `nodes.size() * num_groups` node-major values. If the source caches its values, the
+   * pointer refers to the cache and no function is evaluated. Otherwise the values are stored in
+   * `buffer`, which the pointer then refers to.
+   */
+  const double* EvaluateSubscriber(size_t subscriber,
+                                   const Cell& cell,
+                                   const std::vector<Vector3>& nodes,
+                                   int num_groups,
+                                   std::vector<double>& buffer) const;
+
   size_t NumLocalSubscribers() const { return num_local_subsribers_; }
   size_t NumGlobalSubsribers() const { return num_global_subscribers_; }
 
@@ -57,11 +70,17 @@ public:
 private:
   const std::shared_ptr<opensn::LogicalVolume> logical_volume_ptr_;
   const std::shared_ptr<SpatialMaterialFunction> function_;
+  const bool cache_values_;
 
   size_t num_local_subsribers_ = 0;
   size_t num_global_subscribers_ = 0;
 
   std::vector<uint64_t> subscribers_;
+
+  /// Cached node-major values of the subscribing cells, and where each cell's values begin
+  std::vector<double> cached_values_;
+  std::vector<size_t> cached_values_begin_;
+  size_t cached_num_groups_ = 0;
 };
 
 } // namespace lbs
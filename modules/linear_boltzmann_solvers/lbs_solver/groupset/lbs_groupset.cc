@@ -43,6 +43,14 @@ lbs::LBSGroupset::GetInputParameters()
     "The number of subsets to apply to the set of groups in this set. This is "
     "useful for increasing pipeline size for parallel simulations");
 
+  params.AddOptionalParameter(
+    "auto_groupset_num_subsets",
+    false,
+    "Flag to choose the number of group subsets automatically, overriding "
+    "\"groupset_num_subsets\". At initialization, the measured message latency is weighed against "
+    "the estimated compute time of an angle set so that group subsets are small enough to hide "
+    "the latency in the sweep pipeline. Only supported with sweep_type \"AAH\".");
+
   params.AddOptionalParameter(
     "inner_linear_method", "richardson", "The iterative method to use for inner linear solves");
 
@@ -68,6 +76,12 @@ lbs::LBSGroupset::GetInputParameters()
   params.AddOptionalParameter(
     "wgdsa_verbose", false, "If true, WGDSA routines will print verbosely");
   params.AddOptionalParameter("wgdsa_petsc_options", "", "PETSc options to pass to WGDSA solver");
+  params.AddOptionalParameter(
+    "wgdsa_matrix_free", false, "If true, the WGDSA operator is applied without assembling it");
+  params.AddOptionalParameter("wgdsa_matrix_free_check",
+                              false,
+                              "If true, the matrix-free WGDSA operator is compared with the "
+                              "assembled operator on setup. For debugging only (very expensive)");
 
   // TG DSA options
   params.AddOptionalParameter(
@@ -77,6 +91,12 @@ lbs::LBSGroupset::GetInputParameters()
   params.AddOptionalParameter(
     "tgdsa_verbose", false, "If true, TGDSA routines will print verbosely");
   params.AddOptionalParameter("tgdsa_petsc_options", "", "PETSc options to pass to TGDSA solver");
+  params.AddOptionalParameter(
+    "tgdsa_matrix_free", false, "If true, the TGDSA operator is applied without assembling it");
+  params.AddOptionalParameter("tgdsa_matrix_free_check",
+                              false,
+                              "If true, the matrix-free TGDSA operator is compared with the "
+                              "assembled operator on setup. For debugging only (very expensive)");
 
   // Constraints
   params.ConstrainParameterRange("angle_aggregation_type",
@@ -129,6 +149,7 @@ lbs::LBSGroupset::LBSGroupset(const InputParameters& params,
   }
 
   master_num_grp_subsets_ = params.GetParamValue<int>("groupset_num_subsets");
+  auto_num_grp_subsets_ = params.GetParamValue<bool>("auto_groupset_num_subsets");
 
   // Add quadrature
   const size_t quad_handle = params.GetParamValue<size_t>("angular_quadrature_handle");
@@ -173,6 +194,12 @@ lbs::LBSGroupset::LBSGroupset(const InputParameters& params,
 
   wgdsa_string_ = params.GetParamValue<std::string>("wgdsa_petsc_options");
   tgdsa_string_ = params.GetParamValue<std::string>("tgdsa_petsc_options");
+
+  wgdsa_matrix_free_ = params.GetParamValue<bool>("wgdsa_matrix_free");
+  tgdsa_matrix_free_ = params.GetParamValue<bool>("tgdsa_matrix_free");
+
+  wgdsa_matrix_free_check_ = params.GetParamValue<bool>("wgdsa_matrix_free_check");
+  tgdsa_matrix_free_check_ = params.GetParamValue<bool>("tgdsa_matrix_free_check");
 }
 
 void
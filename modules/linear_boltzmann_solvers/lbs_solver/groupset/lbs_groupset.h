@@ -35,6 +35,8 @@ public:
 
   int master_num_grp_subsets_ = 1;
   int master_num_ang_subsets_ = 1;
+  /// When set, the number of group subsets is chosen for pipelined sweeping at initialization.
+  bool auto_num_grp_subsets_ = false;
 
   std::vector<SubSetInfo> grp_subset_infos_;
 
@@ -56,6 +58,10 @@ public:
   bool tgdsa_verbose_ = false;
   std::string wgdsa_string_;
   std::string tgdsa_string_;
+  bool wgdsa_matrix_free_ = false;
+  bool tgdsa_matrix_free_ = false;
+  bool wgdsa_matrix_free_check_ = false;
+  bool tgdsa_matrix_free_check_ = false;
 
   std::shared_ptr<DiffusionMIPSolver> wgdsa_solver_;
   std::shared_ptr<DiffusionMIPSolver> tgdsa_solver_;
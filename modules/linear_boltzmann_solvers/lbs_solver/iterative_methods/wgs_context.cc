@@ -45,11 +45,7 @@ WGSContext::MatrixAction(Mat& matrix, Vec& action_vector, Vec& action)
   // Setting the source using updated phi_old
   auto& q_moments_local = lbs_solver_.QMomentsLocal();
   q_moments_local.assign(q_moments_local.size(), 0.0);
-  set_source_function_(groupset,
-                       q_moments_local,
-                       lbs_solver.PhiOldLocal(),
-                       lbs_solver.DensitiesLocal(),
-                       lhs_src_scope_);
+  gs_context_ptr->ApplySourceFunction(q_moments_local, lbs_solver.PhiOldLocal(), lhs_src_scope_);
 
   // Apply transport operator
   gs_context_ptr->ApplyInverseTransportOperator(lhs_src_scope_);
@@ -69,5 +65,22 @@ WGSContext::MatrixAction(Mat& matrix, Vec& action_vector, Vec& action)
   return 0;
 }
 
+void
+WGSContext::ApplySourceFunction(std::vector<double>& q,
+                                const std::vector<double>& phi,
+                                SourceFlags scope)
+{
+  CALI_CXX_MARK_SCOPE("WGSContext::ApplySourceFunction");
+
+  const auto& counters = lbs_solver_.GetPerformanceCounters();
+  const double start_source_time = counters.source_time;
+  const size_t start_num_source_evaluations = counters.num_source_evaluations;
+
+  set_source_function_(groupset_, q, phi, lbs_solver_.DensitiesLocal(), scope);
+
+  source_time_ += counters.source_time - start_source_time;
+  num_source_evaluations_ += counters.num_source_evaluations - start_num_source_evaluations;
+}
+
 } // namespace lbs
 } // namespace opensn
@@ -26,6 +26,9 @@ struct WGSContext : public LinearSolverContext
   SourceFlags rhs_src_scope_;
   bool log_info_ = true;
   size_t counter_applications_of_inv_op_ = 0;
+  /**Wall time, in seconds, and number of the source evaluations of this context.*/
+  double source_time_ = 0.0;
+  size_t num_source_evaluations_ = 0;
 
   WGSContext(LBSSolver& lbs_solver,
              LBSGroupset& groupset,
@@ -42,6 +45,14 @@ struct WGSContext : public LinearSolverContext
 
   int MatrixAction(Mat& matrix, Vec& action_vector, Vec& action) override;
 
+  /**Calls the set source function for this context's groupset. Its wall
+   * time is recorded in the performance counters of the solver by the
+   * source function, and the part due to this context is also added to
+   * source_time_.*/
+  void ApplySourceFunction(std::vector<double>& q,
+                           const std::vector<double>& phi,
+                           SourceFlags scope);
+
   virtual std::pair<int64_t, int64_t> SystemSize() = 0;
 
   /**This operation applies the inverse of the transform operator in the form
@@ -11,6 +11,7 @@
 #include "framework/runtime.h"
 #include <petscksp.h>
 #include "caliper/cali.h"
+#include <algorithm>
 #include <memory>
 #include <iomanip>
 
@@ -124,6 +125,11 @@ WGSLinearSolver::PreSolveCallback()
 
   auto gs_context_ptr = std::dynamic_pointer_cast<WGSContext>(context_ptr_);
 
+  const auto& counters = gs_context_ptr->lbs_solver_.GetPerformanceCounters();
+  solve_start_time_ = std::chrono::steady_clock::now();
+  solve_start_sweep_time_ = counters.sweep_time;
+  solve_start_source_time_ = counters.source_time;
+
   gs_context_ptr->PreSolveCallback();
 }
 
@@ -175,11 +181,8 @@ WGSLinearSolver::SetRHS()
   if (not single_richardson)
   {
     const auto scope = gs_context_ptr->rhs_src_scope_ | ZERO_INCOMING_DELAYED_PSI;
-    gs_context_ptr->set_source_function_(groupset,
-                                         lbs_solver.QMomentsLocal(),
-                                         lbs_solver.PhiOldLocal(),
-                                         lbs_solver.DensitiesLocal(),
-                                         scope);
+    gs_context_ptr->ApplySourceFunction(
+      lbs_solver.QMomentsLocal(), lbs_solver.PhiOldLocal(), scope);
 
     // Apply transport operator
     gs_context_ptr->ApplyInverseTransportOperator(scope);
@@ -206,11 +209,8 @@ WGSLinearSolver::SetRHS()
   else
   {
     const auto scope = gs_context_ptr->rhs_src_scope_ | gs_context_ptr->lhs_src_scope_;
-    gs_context_ptr->set_source_function_(groupset,
-                                         lbs_solver.QMomentsLocal(),
-                                         lbs_solver.PhiOldLocal(),
-                                         lbs_solver.DensitiesLocal(),
-                                         scope);
+    gs_context_ptr->ApplySourceFunction(
+      lbs_solver.QMomentsLocal(), lbs_solver.PhiOldLocal(), scope);
 
     // Apply transport operator
     gs_context_ptr->ApplyInverseTransportOperator(scope);
@@ -265,6 +265,22 @@ WGSLinearSolver::PostSolveCallback()
 
   // Context specific callback
   gs_context_ptr->PostSolveCallback();
+
+  // Attribute the time not spent sweeping or evaluating sources to the Krylov solver
+  auto& counters = lbs_solver.GetPerformanceCounters();
+  const double solve_time =
+    std::chrono::duration<double>(std::chrono::steady_clock::now() - solve_start_time_).count();
+  counters.wgs_time += solve_time;
+  counters.krylov_time += std::max(0.0,
+                                   solve_time - (counters.sweep_time - solve_start_sweep_time_) -
+                                     (counters.source_time - solve_start_source_time_));
+  ++counters.num_wgs_solves;
+  if (not GetKSPSolveSuppressionFlag())
+  {
+    PetscInt num_iterations = 0;
+    KSPGetIterationNumber(ksp_, &num_iterations);
+    counters.num_krylov_iterations += static_cast<size_t>(num_iterations);
+  }
 }
 
 } // namespace lbs
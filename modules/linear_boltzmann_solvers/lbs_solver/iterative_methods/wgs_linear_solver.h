@@ -7,6 +7,7 @@
 
 #include "modules/linear_boltzmann_solvers/lbs_solver/iterative_methods/wgs_context.h"
 
+#include <chrono>
 #include <memory>
 #include <vector>
 #include <functional>
@@ -40,6 +41,12 @@ protected:
   void PostSolveCallback() override;
 
   std::vector<double> saved_q_moments_local_;
+
+  /**The time and the sweep and source times of the performance counters at the start of the
+   * current solve, from which the solve's share of the counters is computed.*/
+  std::chrono::steady_clock::time_point solve_start_time_;
+  double solve_start_sweep_time_ = 0.0;
+  double solve_start_source_time_ = 0.0;
 };
 
 } // namespace lbs
@@ -20,6 +20,7 @@
 #include "framework/logging/log.h"
 #include "framework/runtime.h"
 #include "framework/object_factory.h"
+#include "framework/utils/thread_pool.h"
 #include "caliper/cali.h"
 #include <algorithm>
 #include <iomanip>
@@ -33,6 +34,125 @@ namespace opensn
 namespace lbs
 {
 
+namespace
+{
+
+/**
+ * Byte layout of a shared nodal vectors file written by LBSSolver::WriteNodalVectorsParallel,
+ * computed from its macro data.
+ */
+struct NodalVectorsFileLayout
+{
+  static constexpr size_t header_size = 500;
+  static constexpr MPI_Offset macro_offset = header_size;
+
+  MPI_Offset cell_table_offset = 0;
+  std::vector<size_t> block_sizes;
+  std::vector<MPI_Offset> vector_offsets;
+
+  explicit NodalVectorsFileLayout(const std::vector<uint64_t>& macro)
+  {
+    const uint64_t num_global_cells = macro[0];
+    const uint64_t num_global_nodes = macro[1];
+    const uint64_t num_vectors = macro[2];
+
+    cell_table_offset = macro_offset + static_cast<MPI_Offset>(macro.size() * sizeof(uint64_t));
+    MPI_Offset offset =
+      cell_table_offset + static_cast<MPI_Offset>(2 * num_global_cells * sizeof(uint64_t));
+    for (uint64_t v = 0; v < num_vectors; ++v)
+    {
+      block_sizes.push_back(macro[4 + 2 * v]);
+      vector_offsets.push_back(offset);
+      offset += static_cast<MPI_Offset>(num_global_nodes * block_sizes.back() * sizeof(double));
+    }
+  }
+};
+
+/**MPI-IO counts are ints, so large transfers are split into pieces of this many bytes.*/
+constexpr size_t max_io_chunk_bytes = size_t(1) << 30;
+
+/**Writes `num_bytes` bytes at `offset`. Returns false if any piece fails.*/
+bool
+WriteAt(MPI_File file, MPI_Offset offset, const void* data, size_t num_bytes)
+{
+  const auto bytes = static_cast<const char*>(data);
+  for (size_t b = 0; b < num_bytes; b += max_io_chunk_bytes)
+  {
+    const auto count = static_cast<int>(std::min(max_io_chunk_bytes, num_bytes - b));
+    const int err = MPI_File_write_at(
+      file, offset + static_cast<MPI_Offset>(b), bytes + b, count, MPI_BYTE, MPI_STATUS_IGNORE);
+    if (err != MPI_SUCCESS)
+      return false;
+  }
+  return true;
+}
+
+/**
+ * Collective version of WriteAt. All ranks make the same number of calls, even if some have
+ * nothing (left) to write or a previous piece failed.
+ */
+bool
+WriteAtAll(MPI_File file, MPI_Offset offset, const void* data, size_t num_bytes)
+{
+  const size_t num_chunks = (num_bytes + max_io_chunk_bytes - 1) / max_io_chunk_bytes;
+  size_t max_num_chunks = 0;
+  mpi_comm.all_reduce(num_chunks, max_num_chunks, mpi::op::max<size_t>());
+
+  bool success = true;
+  const auto bytes = static_cast<const char*>(data);
+  for (size_t c = 0; c < max_num_chunks; ++c)
+  {
+    const size_t b = std::min(c * max_io_chunk_bytes, num_bytes);
+    const auto count = static_cast<int>(std::min(max_io_chunk_bytes, num_bytes - b));
+    const int err = MPI_File_write_at_all(
+      file, offset + static_cast<MPI_Offset>(b), bytes + b, count, MPI_BYTE, MPI_STATUS_IGNORE);
+    success = success and err == MPI_SUCCESS;
+  }
+  return success;
+}
+
+/**Reads `num_bytes` bytes at `offset`. Returns false if any piece fails or comes up short.*/
+bool
+ReadAt(MPI_File file, MPI_Offset offset, void* data, size_t num_bytes)
+{
+  const auto bytes = static_cast<char*>(data);
+  for (size_t b = 0; b < num_bytes; b += max_io_chunk_bytes)
+  {
+    const auto count = static_cast<int>(std::min(max_io_chunk_bytes, num_bytes - b));
+    MPI_Status status;
+    const int err = MPI_File_read_at(
+      file, offset + static_cast<MPI_Offset>(b), bytes + b, count, MPI_BYTE, &status);
+    int num_read = 0;
+    MPI_Get_count(&status, MPI_BYTE, &num_read);
+    if (err != MPI_SUCCESS or num_read != count)
+      return false;
+  }
+  return true;
+}
+
+/**
+ * Collective error check on a shared file. If `error` is non-empty on any rank, `file` is closed
+ * (unless it is MPI_FILE_NULL) and every rank throws, so that no rank is left waiting in a later
+ * collective call. Ranks without an error of their own report the number of failed ranks.
+ */
+void
+CheckSharedFileError(const std::string& error, MPI_File& file, const std::string& file_name)
+{
+  const int local_failed = error.empty() ? 0 : 1;
+  int num_failed = 0;
+  mpi_comm.all_reduce(local_failed, num_failed, mpi::op::sum<int>());
+  if (num_failed == 0)
+    return;
+
+  if (file != MPI_FILE_NULL)
+    MPI_File_close(&file);
+  OpenSnLogicalErrorIf(not error.empty(), error);
+  OpenSnLogicalError("Accessing " + file_name + " failed on " + std::to_string(num_failed) +
+                     " other rank(s).");
+}
+
+} // namespace
+
 std::map<std::string, uint64_t> LBSSolver::supported_boundary_names = {
   {"xmax", 0}, {"xmin", 1}, {"ymax", 2}, {"ymin", 3}, {"zmax", 4}, {"zmin", 5}};
 
@@ -243,7 +363,7 @@ LBSSolver::SpatialDiscretization() const
   return *discretization_;
 }
 
-const std::vector<UnitCellMatrices>&
+const UnitCellMatrixStore&
 LBSSolver::GetUnitCellMatrices() const
 {
   return unit_cell_matrices_;
@@ -375,6 +495,26 @@ LBSSolver::GetActiveSetSourceFunction() const
   return active_set_source_function_;
 }
 
+const PerformanceCounters&
+LBSSolver::GetPerformanceCounters() const
+{
+  return performance_counters_;
+}
+
+PerformanceCounters&
+LBSSolver::GetPerformanceCounters()
+{
+  return performance_counters_;
+}
+
+ParameterBlock
+LBSSolver::GetInfo(const ParameterBlock& params) const
+{
+  const auto param_name = params.GetParamValue<std::string>("name");
+
+  return ParameterBlock("", GlobalPerformanceCounter(performance_counters_, param_name));
+}
+
 std::shared_ptr<AGSLinearSolver>
 LBSSolver::GetPrimaryAGSSolver()
 {
@@ -452,6 +592,36 @@ LBSSolver::OptionsBlock()
   params.AddOptionalParameter("max_mpi_message_size",
                               32'768,
                               "The maximum MPI message size used during sweep initialization.");
+  params.AddOptionalParameter(
+    "use_persistent_sweep_comm",
+    false,
+    "Flag for pre-posting the receives of the AAH sweep as persistent requests that are reused "
+    "across sweeps. Outgoing data is then also sent with persistent requests, and messages are "
+    "only split when they exceed `max_mpi_message_size`.");
+  params.AddOptionalParameter(
+    "num_sweep_threads",
+    1,
+    "Number of threads used to execute angle sets concurrently within a rank. Only "
+    "supported for the AAH sweep type. Angle sets sharing a group subset are never executed "
+    "concurrently, so the number of group subsets limits the achievable concurrency.");
+  params.AddOptionalParameter("num_source_threads",
+                              1,
+                              "Number of threads used to assemble the source moments within a "
+                              "rank. Cells are split into contiguous blocks, one per thread.");
+  params.AddOptionalParameter("num_sweep_ordering_threads",
+                              1,
+                              "Number of threads used to build the sweep orderings of the "
+                              "different directions concurrently within a rank.");
+  params.AddOptionalParameter("num_initialization_threads",
+                              1,
+                              "Number of threads used within a rank to create the cell mappings "
+                              "and to compute the unit cell integrals during initialization.");
+  params.AddOptionalParameter(
+    "sweep_ordering_cache_folder_name",
+    "",
+    "Folder in which sweep orderings are cached. When set, sweep orderings are read from this "
+    "folder if they were built before for the same mesh, partition and quadrature, and are "
+    "written to it otherwise. Empty disables the cache.");
   params.AddOptionalParameter(
     "read_restart_data", false, "Flag indicating whether restart data is to be read.");
   params.AddOptionalParameter(
@@ -485,6 +655,11 @@ LBSSolver::OptionsBlock()
     "verbose_outer_iterations", true, "Flag to control verbosity of across-groupset iterations.");
   params.AddOptionalParameter(
     "verbose_ags_iterations", false, "Flag to control verbosity of across-groupset iterations.");
+  params.AddOptionalParameter("log_performance_counters",
+                              false,
+                              "Flag for logging the performance counters of the solver (source, "
+                              "sweep and Krylov times, messages and cell solves) at the end of "
+                              "each execution.");
   params.AddOptionalParameter(
     "power_field_function_on",
     false,
@@ -539,6 +714,10 @@ LBSSolver::OptionsBlock()
     "clear_distributed_sources", false, "A flag to clear existing distributed sources.");
 
   params.ConstrainParameterRange("spatial_discretization", AllowableRangeList::New({"pwld"}));
+  params.ConstrainParameterRange("num_sweep_threads", AllowableRangeLowLimit::New(1));
+  params.ConstrainParameterRange("num_source_threads", AllowableRangeLowLimit::New(1));
+  params.ConstrainParameterRange("num_sweep_ordering_threads", AllowableRangeLowLimit::New(1));
+  params.ConstrainParameterRange("num_initialization_threads", AllowableRangeLowLimit::New(1));
   params.ConstrainParameterRange("field_function_prefix_option",
                                  AllowableRangeList::New({"prefix", "solver_name"}));
 
@@ -643,6 +822,24 @@ LBSSolver::SetOptions(const InputParameters& params)
     else if (spec.Name() == "max_mpi_message_size")
       options_.max_mpi_message_size = spec.GetValue<int>();
 
+    else if (spec.Name() == "use_persistent_sweep_comm")
+      options_.use_persistent_sweep_comm = spec.GetValue<bool>();
+
+    else if (spec.Name() == "num_sweep_threads")
+      options_.num_sweep_threads = spec.GetValue<int>();
+
+    else if (spec.Name() == "num_source_threads")
+      options_.num_source_threads = spec.GetValue<int>();
+
+    else if (spec.Name() == "num_sweep_ordering_threads")
+      options_.num_sweep_ordering_threads = spec.GetValue<int>();
+
+    else if (spec.Name() == "num_initialization_threads")
+      options_.num_initialization_threads = spec.GetValue<int>();
+
+    else if (spec.Name() == "sweep_ordering_cache_folder_name")
+      options_.sweep_ordering_cache_folder_name = spec.GetValue<std::string>();
+
     else if (spec.Name() == "read_restart_data")
       options_.read_restart_data = spec.GetValue<bool>();
 
@@ -682,6 +879,9 @@ LBSSolver::SetOptions(const InputParameters& params)
     else if (spec.Name() == "verbose_outer_iterations")
       options_.verbose_outer_iterations = spec.GetValue<bool>();
 
+    else if (spec.Name() == "log_performance_counters")
+      options_.log_performance_counters = spec.GetValue<bool>();
+
     else if (spec.Name() == "power_field_function_on")
       options_.power_field_function_on = spec.GetValue<bool>();
 
@@ -1064,7 +1264,10 @@ LBSSolver::InitializeSpatialDiscretization()
   CALI_CXX_MARK_SCOPE("LBSSolver::InitializeSpatialDiscretization");
 
   log.Log() << "Initializing spatial discretization.\n";
-  discretization_ = PieceWiseLinearDiscontinuous::New(*grid_ptr_);
+  discretization_ = PieceWiseLinearDiscontinuous::New(*grid_ptr_,
+                                                      QuadratureOrder::SECOND,
+                                                      CoordinateSystemType::CARTESIAN,
+                                                      options_.num_initialization_threads);
 
   ComputeUnitIntegrals();
 }
@@ -1077,136 +1280,51 @@ LBSSolver::ComputeUnitIntegrals()
   log.Log() << "Computing unit integrals.\n";
   const auto& sdm = *discretization_;
 
-  // Define spatial weighting functions
-  struct SpatialWeightFunction // SWF
-  {
-    virtual double operator()(const Vector3& pt) const { return 1.0; }
-    virtual ~SpatialWeightFunction() = default;
-  };
-
-  struct SphericalSWF : public SpatialWeightFunction
-  {
-    double operator()(const Vector3& pt) const override { return pt[2] * pt[2]; }
-  };
-
-  struct CylindricalSWF : public SpatialWeightFunction
-  {
-    double operator()(const Vector3& pt) const override { return pt[0]; }
-  };
-
-  auto swf_ptr = std::make_shared<SpatialWeightFunction>();
+  // Spatial weighting, left empty for unit weighting
+  std::function<double(const Vector3&)> swf;
   if (options_.geometry_type == lbs::GeometryType::ONED_SPHERICAL)
-    swf_ptr = std::make_shared<SphericalSWF>();
+    swf = [](const Vector3& pt) { return pt[2] * pt[2]; };
   if (options_.geometry_type == lbs::GeometryType::TWOD_CYLINDRICAL)
-    swf_ptr = std::make_shared<CylindricalSWF>();
+    swf = [](const Vector3& pt) { return pt[0]; };
 
-  auto ComputeCellUnitIntegrals = [&sdm](const Cell& cell, const SpatialWeightFunction& swf)
-  {
-    const auto& cell_mapping = sdm.GetCellMapping(cell);
-    const size_t cell_num_faces = cell.faces_.size();
-    const size_t cell_num_nodes = cell_mapping.NumNodes();
-    const auto fe_vol_data = cell_mapping.MakeVolumetricFiniteElementData();
-
-    MatDbl IntV_gradshapeI_gradshapeJ(cell_num_nodes, VecDbl(cell_num_nodes));
-    MatVec3 IntV_shapeI_gradshapeJ(cell_num_nodes, VecVec3(cell_num_nodes));
-    MatDbl IntV_shapeI_shapeJ(cell_num_nodes, VecDbl(cell_num_nodes));
-    VecDbl IntV_shapeI(cell_num_nodes);
+  const auto ComputeCellUnitIntegrals = [&sdm, &swf](const Cell& cell)
+  { return ComputeUnitCellMatrices(sdm.GetCellMapping(cell), swf); };
 
-    std::vector<MatDbl> IntS_shapeI_shapeJ(cell_num_faces);
-    std::vector<MatVec3> IntS_shapeI_gradshapeJ(cell_num_faces);
-    std::vector<VecDbl> IntS_shapeI(cell_num_faces);
-
-    // Volume integrals
-    for (unsigned int i = 0; i < cell_num_nodes; ++i)
-    {
-      for (unsigned int j = 0; j < cell_num_nodes; ++j)
-      {
-        for (const auto& qp : fe_vol_data.QuadraturePointIndices())
-        {
-          IntV_gradshapeI_gradshapeJ[i][j] +=
-            swf(fe_vol_data.QPointXYZ(qp)) *
-            fe_vol_data.ShapeGrad(i, qp).Dot(fe_vol_data.ShapeGrad(j, qp)) *
-            fe_vol_data.JxW(qp); // K-matrix
-
-          IntV_shapeI_gradshapeJ[i][j] +=
-            swf(fe_vol_data.QPointXYZ(qp)) * fe_vol_data.ShapeValue(i, qp) *
-            fe_vol_data.ShapeGrad(j, qp) * fe_vol_data.JxW(qp); // G-matrix
-
-          IntV_shapeI_shapeJ[i][j] +=
-            swf(fe_vol_data.QPointXYZ(qp)) * fe_vol_data.ShapeValue(i, qp) *
-            fe_vol_data.ShapeValue(j, qp) * fe_vol_data.JxW(qp); // M-matrix
-        }                                                        // for qp
-      }                                                          // for j
-
-      for (const auto& qp : fe_vol_data.QuadraturePointIndices())
-      {
-        IntV_shapeI[i] +=
-          swf(fe_vol_data.QPointXYZ(qp)) * fe_vol_data.ShapeValue(i, qp) * fe_vol_data.JxW(qp);
-      } // for qp
-    }   // for i
-
-    //  surface integrals
-    for (size_t f = 0; f < cell_num_faces; ++f)
-    {
-      const auto fe_srf_data = cell_mapping.MakeSurfaceFiniteElementData(f);
-      IntS_shapeI_shapeJ[f].resize(cell_num_nodes, VecDbl(cell_num_nodes));
-      IntS_shapeI[f].resize(cell_num_nodes);
-      IntS_shapeI_gradshapeJ[f].resize(cell_num_nodes, VecVec3(cell_num_nodes));
-
-      for (unsigned int i = 0; i < cell_num_nodes; ++i)
-      {
-        for (unsigned int j = 0; j < cell_num_nodes; ++j)
-        {
-          for (const auto& qp : fe_srf_data.QuadraturePointIndices())
-          {
-            IntS_shapeI_shapeJ[f][i][j] += swf(fe_srf_data.QPointXYZ(qp)) *
-                                           fe_srf_data.ShapeValue(i, qp) *
-                                           fe_srf_data.ShapeValue(j, qp) * fe_srf_data.JxW(qp);
-            IntS_shapeI_gradshapeJ[f][i][j] += swf(fe_srf_data.QPointXYZ(qp)) *
-                                               fe_srf_data.ShapeValue(i, qp) *
-                                               fe_srf_data.ShapeGrad(j, qp) * fe_srf_data.JxW(qp);
-          } // for qp
-        }   // for j
-
-        for (const auto& qp : fe_srf_data.QuadraturePointIndices())
-        {
-          IntS_shapeI[f][i] +=
-            swf(fe_srf_data.QPointXYZ(qp)) * fe_srf_data.ShapeValue(i, qp) * fe_srf_data.JxW(qp);
-        } // for qp
-      }   // for i
-    }     // for f
-
-    return UnitCellMatrices{IntV_gradshapeI_gradshapeJ,
-                            IntV_shapeI_gradshapeJ,
-                            IntV_shapeI_shapeJ,
-                            IntV_shapeI,
-
-                            IntS_shapeI_shapeJ,
-                            IntS_shapeI_gradshapeJ,
-                            IntS_shapeI};
-  };
-
-  const size_t num_local_cells = grid_ptr_->local_cells.size();
-  unit_cell_matrices_.resize(num_local_cells);
-
-  for (const auto& cell : grid_ptr_->local_cells)
-    unit_cell_matrices_[cell.local_id_] = ComputeCellUnitIntegrals(cell, *swf_ptr);
+  // Congruent cells share their matrices, unless the spatial weighting or the coordinate system
+  // makes the matrices depend on the position of the cell
+  const bool cartesian = options_.geometry_type == GeometryType::ONED_SLAB or
+                         options_.geometry_type == GeometryType::TWOD_CARTESIAN or
+                         options_.geometry_type == GeometryType::THREED_CARTESIAN;
+  const unsigned int num_threads = options_.num_initialization_threads;
+  unit_cell_matrices_ =
+    UnitCellMatrixStore(*grid_ptr_, cartesian, ComputeCellUnitIntegrals, num_threads);
 
+  unit_ghost_cell_matrices_.clear();
   const auto ghost_ids = grid_ptr_->cells.GetGhostGlobalIDs();
-  for (uint64_t ghost_id : ghost_ids)
-    unit_ghost_cell_matrices_[ghost_id] =
-      ComputeCellUnitIntegrals(grid_ptr_->cells[ghost_id], *swf_ptr);
+  std::vector<UnitCellMatrices> ghost_cell_matrices(ghost_ids.size());
+  ParallelFor(ghost_ids.size(),
+              num_threads,
+              [&](size_t g)
+              {
+                const auto& ghost_cell = grid_ptr_->cells[ghost_ids[g]];
+                ghost_cell_matrices[g] = ComputeCellUnitIntegrals(ghost_cell);
+              });
+  for (size_t g = 0; g < ghost_ids.size(); ++g)
+    unit_ghost_cell_matrices_[ghost_ids[g]] = std::move(ghost_cell_matrices[g]);
 
   // Assessing global unit cell matrix storage
-  std::array<size_t, 2> num_local_ucms = {unit_cell_matrices_.size(),
+  std::array<size_t, 3> num_local_ucms = {unit_cell_matrices_.size(),
+                                          unit_cell_matrices_.NumUnique(),
                                           unit_ghost_cell_matrices_.size()};
-  std::array<size_t, 2> num_globl_ucms = {0, 0};
+  std::array<size_t, 3> num_globl_ucms = {0, 0, 0};
 
-  mpi_comm.all_reduce(num_local_ucms.data(), 2, num_globl_ucms.data(), mpi::op::sum<size_t>());
+  mpi_comm.all_reduce(num_local_ucms.data(), 3, num_globl_ucms.data(), mpi::op::sum<size_t>());
 
   opensn::mpi_comm.barrier();
+  log.Log() << "Unique unit cell-matrix sets: " << num_globl_ucms[1] << " for "
+            << num_globl_ucms[0] << " cells";
   log.Log() << "Ghost cell unit cell-matrix ratio: "
-            << (double)num_globl_ucms[1] * 100 / (double)num_globl_ucms[0] << "%";
+            << (double)num_globl_ucms[2] * 100 / (double)num_globl_ucms[0] << "%";
   log.Log() << "Cell matrices computed.";
 }
 
@@ -1396,6 +1514,7 @@ LBSSolver::InitializeParrays()
                                        num_moments_,
                                        *matid_to_xs_map_[mat_id],
                                        cell_volume,
+                                       unit_cell_matrices_.Index(cell.local_id_),
                                        face_local_flags,
                                        face_locality,
                                        neighbor_cell_ptrs,
@@ -1682,6 +1801,8 @@ lbs::LBSSolver::InitWGDSA(LBSGroupset& groupset, bool vaccum_bcs_are_dirichlet)
     solver->options.max_iters = groupset.wgdsa_max_iters_;
     solver->options.verbose = groupset.wgdsa_verbose_;
     solver->options.additional_options_string = groupset.wgdsa_string_;
+    solver->options.matrix_free = groupset.wgdsa_matrix_free_;
+    solver->options.perform_matrix_free_check = groupset.wgdsa_matrix_free_check_;
 
     solver->Initialize();
 
@@ -1898,6 +2019,8 @@ lbs::LBSSolver::InitTGDSA(LBSGroupset& groupset)
     solver->options.max_iters = groupset.tgdsa_max_iters_;
     solver->options.verbose = groupset.tgdsa_verbose_;
     solver->options.additional_options_string = groupset.tgdsa_string_;
+    solver->options.matrix_free = groupset.tgdsa_matrix_free_;
+    solver->options.perform_matrix_free_check = groupset.tgdsa_matrix_free_check_;
 
     solver->Initialize();
 
@@ -1950,10 +2073,14 @@ LBSSolver::AssembleTGDSADeltaPhiVector(const LBSGroupset& groupset,
 
       for (size_t g = 0; g < gss; ++g)
       {
+        const size_t row_size = S.RowSize(gsi + g);
+        const uint32_t* cols = S.RowColumnIndices(gsi + g);
+        const double* vals = S.RowValues(gsi + g);
+
         double R_g = 0.0;
-        for (const auto& [row_g, gprime, sigma_sm] : S.Row(gsi + g))
-          if (gprime >= gsi and gprime != (gsi + g))
-            R_g += sigma_sm * phi_in_mapped[gprime];
+        for (size_t k = 0; k < row_size; ++k)
+          if (cols[k] >= gsi and cols[k] != (gsi + g))
+            R_g += vals[k] * phi_in_mapped[cols[k]];
 
         delta_phi_mapped += R_g;
       } // for g
@@ -2006,60 +2133,25 @@ LBSSolver::WriteRestartData(const std::string& folder_name, const std::string& f
   Stat st;
 
   // Make sure folder exists
+  bool folder_exists = true;
   if (opensn::mpi_comm.rank() == 0)
   {
     if (stat(folder_name.c_str(), &st) != 0) // if not exist, make it
       if ((mkdir(folder_name.c_str(), S_IRWXU | S_IRWXG | S_IRWXO) != 0) and (errno != EEXIST))
-      {
-        log.Log0Warning() << "Failed to create restart directory: " << folder_name;
-        return;
-      }
+        folder_exists = false;
   }
-
-  opensn::mpi_comm.barrier();
-
-  // Create files
-  // This step might fail for specific locations and
-  // can create quite a messy output if we print it all.
-  // We also need to consolidate the error to determine if
-  // the process as whole succeeded.
-  bool location_succeeded = true;
-  char location_cstr[20];
-  snprintf(location_cstr, 20, "%d.r", opensn::mpi_comm.rank());
-
-  std::string file_name = folder_name + std::string("/") + file_base + std::string(location_cstr);
-
-  std::ofstream ofile;
-  ofile.open(file_name, std::ios::out | std::ios::binary | std::ios::trunc);
-
-  if (not ofile.is_open())
+  mpi_comm.broadcast(folder_exists, 0);
+  if (not folder_exists)
   {
-    log.LogAllError() << "Failed to create restart file: " << file_name;
-    ofile.close();
-    location_succeeded = false;
-  }
-  else
-  {
-    size_t phi_old_size = phi_old_local_.size();
-    ofile.write((char*)&phi_old_size, sizeof(size_t));
-    for (auto val : phi_old_local_)
-      ofile.write((char*)&val, sizeof(double));
-
-    ofile.close();
+    log.Log0Warning() << "Failed to create restart directory: " << folder_name;
+    return;
   }
 
-  // Wait for all processes then check success status
-  opensn::mpi_comm.barrier();
-  bool global_succeeded = true;
-  mpi_comm.all_reduce(location_succeeded, global_succeeded, mpi::op::logical_and<bool>());
+  // All ranks write phi_old into a single shared file
+  const std::string file_name = folder_name + std::string("/") + file_base + std::string(".r");
+  WriteNodalVectorsParallel(file_name, "Restart file", {&phi_old_local_}, {&flux_moments_uk_man_});
 
-  // Write status message
-  if (global_succeeded)
-    log.Log() << "Successfully wrote restart data: "
-              << folder_name + std::string("/") + file_base + std::string("X.r");
-  else
-    log.Log0Error() << "Failed to write restart data: "
-                    << folder_name + std::string("/") + file_base + std::string("X.r");
+  log.Log() << "Successfully wrote restart data: " << file_name;
 }
 
 void
@@ -2067,71 +2159,15 @@ LBSSolver::ReadRestartData(const std::string& folder_name, const std::string& fi
 {
   CALI_CXX_MARK_SCOPE("LBSSolver::ReadRestartData");
 
-  opensn::mpi_comm.barrier();
-
-  // Open files
-  // This step might fail for specific locations and
-  // can create quite a messy output if we print it all.
-  // We also need to consolidate the error to determine if
-  // the process as whole succeeded.
-  bool location_succeeded = true;
-  char location_cstr[20];
-  snprintf(location_cstr, 20, "%d.r", opensn::mpi_comm.rank());
+  // The restart file is matched to the local cells by global id, so it can be read with a
+  // different number of ranks than it was written with.
+  const std::string file_name = folder_name + std::string("/") + file_base + std::string(".r");
 
-  std::string file_name = folder_name + std::string("/") + file_base + std::string(location_cstr);
+  std::vector<std::vector<double>> phi_old;
+  ReadNodalVectorsParallel(file_name, {&flux_moments_uk_man_}, phi_old);
+  phi_old_local_ = std::move(phi_old.front());
 
-  std::ifstream ifile;
-  ifile.open(file_name, std::ios::in | std::ios::binary);
-
-  if (not ifile.is_open())
-  {
-    ifile.close();
-    location_succeeded = false;
-  }
-  else
-  {
-    size_t number_of_unknowns;
-    ifile.read((char*)&number_of_unknowns, sizeof(size_t));
-
-    if (number_of_unknowns != phi_old_local_.size())
-    {
-      location_succeeded = false;
-      ifile.close();
-    }
-    else
-    {
-      std::vector<double> temp_phi_old(phi_old_local_.size(), 0.0);
-
-      size_t v = 0;
-      while (not ifile.eof())
-      {
-        ifile.read((char*)&temp_phi_old[v], sizeof(double));
-        ++v;
-      }
-
-      if (v != (number_of_unknowns + 1))
-      {
-        location_succeeded = false;
-        ifile.close();
-      }
-      else
-        phi_old_local_ = std::move(temp_phi_old);
-
-      ifile.close();
-    }
-  }
-
-  // Wait for all processes then check success status
-  opensn::mpi_comm.barrier();
-  bool global_succeeded = true;
-  mpi_comm.all_reduce(location_succeeded, global_succeeded, mpi::op::logical_and<bool>());
-
-  // Write status message
-  if (global_succeeded)
-    log.Log() << "Successfully read restart data";
-  else
-    log.Log0Error() << "Failed to read restart data: "
-                    << folder_name + std::string("/") + file_base + std::string("X.r");
+  log.Log() << "Successfully read restart data: " << file_name;
 }
 
 void
@@ -2461,6 +2497,414 @@ LBSSolver::ReadGroupsetAngularFluxes(const std::string& file_base,
   file.close();
 }
 
+void
+LBSSolver::WriteAngularFluxesParallel(const std::vector<std::vector<double>>& src,
+                                      const std::string& file_name) const
+{
+  CALI_CXX_MARK_SCOPE("LBSSolver::WriteAngularFluxesParallel");
+
+  OpenSnLogicalErrorIf(src.size() != groupsets_.size(),
+                       "Incompatible angular flux vector provided. One vector per groupset "
+                       "is required.");
+
+  std::vector<const std::vector<double>*> vectors;
+  std::vector<const opensn::UnknownManager*> uk_mans;
+  for (const auto& groupset : groupsets_)
+  {
+    vectors.push_back(&src[groupset.id_]);
+    uk_mans.push_back(&groupset.psi_uk_man_);
+  }
+
+  log.Log() << "Writing angular fluxes to " << file_name;
+  WriteNodalVectorsParallel(file_name, "Angular flux file", vectors, uk_mans);
+}
+
+void
+LBSSolver::ReadAngularFluxesParallel(const std::string& file_name,
+                                     std::vector<std::vector<double>>& dest,
+                                     const std::vector<size_t>& groups,
+                                     const std::vector<size_t>& angles) const
+{
+  CALI_CXX_MARK_SCOPE("LBSSolver::ReadAngularFluxesParallel");
+
+  for (const size_t g : groups)
+    OpenSnInvalidArgumentIf(g >= num_groups_,
+                            "Group " + std::to_string(g) + " is out of range for reading " +
+                              file_name + ".");
+
+  // Groupset quadratures may differ, so an angle only has to exist in one of them
+  size_t max_num_angles = 0;
+  for (const auto& groupset : groupsets_)
+    max_num_angles = std::max(max_num_angles, groupset.psi_uk_man_.NumberOfUnknowns());
+  for (const size_t n : angles)
+    OpenSnInvalidArgumentIf(n >= max_num_angles,
+                            "Angle " + std::to_string(n) + " is out of range for reading " +
+                              file_name + ".");
+
+  std::vector<const opensn::UnknownManager*> uk_mans;
+  std::vector<std::vector<size_t>> block_entries;
+  for (const auto& groupset : groupsets_)
+  {
+    uk_mans.push_back(&groupset.psi_uk_man_);
+
+    // Node blocks are ordered by angle, then by groupset group
+    const size_t num_angles = groupset.psi_uk_man_.NumberOfUnknowns();
+    const size_t first_group = groupset.groups_.front().id_;
+    const size_t num_gs_groups = groupset.groups_.size();
+
+    std::vector<size_t> gs_groups;
+    for (size_t gsg = 0; gsg < num_gs_groups; ++gsg)
+      if (groups.empty() or
+          std::find(groups.begin(), groups.end(), first_group + gsg) != groups.end())
+        gs_groups.push_back(gsg);
+
+    std::vector<size_t> gs_angles;
+    for (size_t n = 0; n < num_angles; ++n)
+      if (angles.empty() or std::find(angles.begin(), angles.end(), n) != angles.end())
+        gs_angles.push_back(n);
+
+    auto& entries = block_entries.emplace_back();
+    for (const size_t n : gs_angles)
+      for (const size_t gsg : gs_groups)
+        entries.push_back(n * num_gs_groups + gsg);
+  }
+
+  log.Log() << "Reading angular fluxes from " << file_name;
+  if (groups.empty() and angles.empty())
+    ReadNodalVectorsParallel(file_name, uk_mans, dest);
+  else
+    ReadNodalVectorsParallel(file_name, uk_mans, dest, block_entries);
+}
+
+void
+LBSSolver::WriteNodalVectorsParallel(const std::string& file_name,
+                                     const std::string& title,
+                                     const std::vector<const std::vector<double>*>& src,
+                                     const std::vector<const opensn::UnknownManager*>& uk_mans) const
+{
+  OpenSnLogicalErrorIf(src.size() != uk_mans.size(),
+                       "Each vector requires exactly one unknown manager.");
+
+  // Check the vectors before the file is touched. Vector sizes are rank-local, so the outcome is
+  // agreed on by all ranks.
+  MPI_File file = MPI_FILE_NULL;
+  std::string error;
+  for (size_t v = 0; v < src.size() and error.empty(); ++v)
+    if (uk_mans[v]->dof_storage_type_ != UnknownStorageType::NODAL)
+      error = "Only nodal unknown storage is supported.";
+    else if (src[v]->size() != discretization_->GetNumLocalDOFs(*uk_mans[v]))
+      error = "Incompatible vector " + std::to_string(v) + " provided for writing to " +
+              file_name + ".";
+  CheckSharedFileError(error, file, file_name);
+
+  // Determine where this rank's cells and nodes go in the global ordering
+  const auto NODES_ONLY = UnknownManager::GetUnitaryUnknownManager();
+  const uint64_t num_local_cells = grid_ptr_->local_cells.size();
+  const uint64_t num_local_nodes = discretization_->GetNumLocalDOFs(NODES_ONLY);
+
+  std::vector<uint64_t> cell_counts(opensn::mpi_comm.size(), 0);
+  std::vector<uint64_t> node_counts(opensn::mpi_comm.size(), 0);
+  mpi_comm.all_gather(num_local_cells, cell_counts);
+  mpi_comm.all_gather(num_local_nodes, node_counts);
+
+  uint64_t cell_offset = 0, num_global_cells = 0;
+  uint64_t node_offset = 0, num_global_nodes = 0;
+  for (int r = 0; r < opensn::mpi_comm.size(); ++r)
+  {
+    if (r < opensn::mpi_comm.rank())
+    {
+      cell_offset += cell_counts[r];
+      node_offset += node_counts[r];
+    }
+    num_global_cells += cell_counts[r];
+    num_global_nodes += node_counts[r];
+  }
+
+  // Macro data and layout
+  std::vector<uint64_t> macro = {num_global_cells, num_global_nodes, src.size()};
+  for (const auto* uk_man : uk_mans)
+  {
+    macro.push_back(uk_man->NumberOfUnknowns());
+    macro.push_back(uk_man->GetTotalUnknownStructureSize());
+  }
+
+  const NodalVectorsFileLayout layout(macro);
+
+  if (MPI_File_open(opensn::mpi_comm,
+                    file_name.c_str(),
+                    MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                    MPI_INFO_NULL,
+                    &file) != MPI_SUCCESS)
+  {
+    file = MPI_FILE_NULL;
+    error = "Failed to open " + file_name + ".";
+  }
+  CheckSharedFileError(error, file, file_name);
+
+  // From here on, all ranks take part in every collective write. Failures are recorded and
+  // checked once all data has been written.
+  if (MPI_File_set_size(file, 0) != MPI_SUCCESS)
+    error = "Failed to truncate " + file_name + ".";
+
+  // Header and macro data are written by the first rank only
+  if (opensn::mpi_comm.rank() == 0)
+  {
+    const std::string header_info = "OpenSn LinearBoltzmannSolver: " + title +
+                                    " (shared)\n"
+                                    "Header size: " +
+                                    std::to_string(NodalVectorsFileLayout::header_size) +
+                                    " bytes\n"
+                                    "Structure(type-info):\n"
+                                    "uint64_t    num_global_cells\n"
+                                    "uint64_t    num_global_nodes\n"
+                                    "uint64_t    num_vectors\n"
+                                    "Each vector:\n"
+                                    "  uint64_t    num_unknowns\n"
+                                    "  uint64_t    unknown_structure_size\n"
+                                    "Each cell:\n"
+                                    "  uint64_t    cell_global_id\n"
+                                    "  uint64_t    num_cell_nodes\n"
+                                    "Each vector:\n"
+                                    "  Each cell, node, unknown, component:\n"
+                                    "    double      value\n";
+
+    std::vector<char> header_bytes(NodalVectorsFileLayout::header_size, '-');
+    std::copy_n(header_info.begin(),
+                std::min(header_info.size(), header_bytes.size() - 1),
+                header_bytes.begin());
+    header_bytes.back() = '\0';
+
+    if (not WriteAt(file, 0, header_bytes.data(), header_bytes.size()) or
+        not WriteAt(file, layout.macro_offset, macro.data(), macro.size() * sizeof(uint64_t)))
+      error = "Failed to write the header of " + file_name + ".";
+  }
+
+  // Cell table, written once for all vectors
+  std::vector<uint64_t> cell_table;
+  cell_table.reserve(2 * num_local_cells);
+  for (const auto& cell : grid_ptr_->local_cells)
+  {
+    cell_table.push_back(cell.global_id_);
+    cell_table.push_back(discretization_->GetCellNumNodes(cell));
+  }
+  if (not WriteAtAll(file,
+                     layout.cell_table_offset + cell_offset * 2 * sizeof(uint64_t),
+                     cell_table.data(),
+                     cell_table.size() * sizeof(uint64_t)) and
+      error.empty())
+    error = "Failed to write the cell table of " + file_name + ".";
+
+  // One dense block per vector
+  std::vector<double> buffer;
+  for (size_t v = 0; v < src.size(); ++v)
+  {
+    const auto& uk_man = *uk_mans[v];
+    const auto& vec = *src[v];
+    const size_t block_size = layout.block_sizes[v];
+
+    buffer.resize(num_local_nodes * block_size);
+    auto out = buffer.begin();
+    for (const auto& cell : grid_ptr_->local_cells)
+      for (size_t i = 0; i < discretization_->GetCellNumNodes(cell); ++i)
+      {
+        const auto imap = discretization_->MapDOFLocal(cell, i, uk_man, 0, 0);
+        out = std::copy_n(vec.begin() + imap, block_size, out);
+      }
+
+    if (not WriteAtAll(file,
+                       layout.vector_offsets[v] + node_offset * block_size * sizeof(double),
+                       buffer.data(),
+                       buffer.size() * sizeof(double)) and
+        error.empty())
+      error = "Failed to write vector " + std::to_string(v) + " to " + file_name + ".";
+  }
+
+  CheckSharedFileError(error, file, file_name);
+  MPI_File_close(&file);
+}
+
+void
+LBSSolver::ReadNodalVectorsParallel(const std::string& file_name,
+                                    const std::vector<const opensn::UnknownManager*>& uk_mans,
+                                    std::vector<std::vector<double>>& dest,
+                                    const std::vector<std::vector<size_t>>& block_entries) const
+{
+  OpenSnLogicalErrorIf(not block_entries.empty() and block_entries.size() != uk_mans.size(),
+                       "Block entries must be given for all or none of the vectors.");
+
+  MPI_File file = MPI_FILE_NULL;
+  std::string error;
+  if (MPI_File_open(opensn::mpi_comm, file_name.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &file) !=
+      MPI_SUCCESS)
+  {
+    file = MPI_FILE_NULL;
+    error = "Failed to open " + file_name + ".";
+  }
+  CheckSharedFileError(error, file, file_name);
+
+  // The first rank reads the macro data and shares it, so that all ranks agree on compatibility
+  std::vector<uint64_t> macro(3, 0);
+  if (opensn::mpi_comm.rank() == 0 and
+      not ReadAt(file, NodalVectorsFileLayout::macro_offset, macro.data(), 3 * sizeof(uint64_t)))
+    error = "Failed to read the macro data of " + file_name + ". The file may be truncated.";
+  CheckSharedFileError(error, file, file_name);
+  mpi_comm.broadcast(macro.data(), 3, 0);
+
+  const uint64_t file_num_global_cells = macro[0];
+  const uint64_t file_num_vectors = macro[2];
+
+  if (file_num_global_cells != grid_ptr_->GetGlobalNumberOfCells())
+    error = "Incompatible number of cells found in file " + file_name + ".";
+  else if (file_num_vectors != uk_mans.size())
+    error = "Incompatible number of vectors found in file " + file_name + ".";
+  CheckSharedFileError(error, file, file_name);
+
+  macro.resize(3 + 2 * file_num_vectors);
+  if (opensn::mpi_comm.rank() == 0 and
+      not ReadAt(file,
+                 NodalVectorsFileLayout::macro_offset + 3 * sizeof(uint64_t),
+                 &macro[3],
+                 2 * file_num_vectors * sizeof(uint64_t)))
+    error = "Failed to read the macro data of " + file_name + ". The file may be truncated.";
+  CheckSharedFileError(error, file, file_name);
+  mpi_comm.broadcast(&macro[3], static_cast<int>(2 * file_num_vectors), 0);
+
+  const NodalVectorsFileLayout layout(macro);
+  for (size_t v = 0; v < uk_mans.size() and error.empty(); ++v)
+  {
+    const auto& uk_man = *uk_mans[v];
+    if (macro[3 + 2 * v] != uk_man.NumberOfUnknowns() or
+        macro[4 + 2 * v] != uk_man.GetTotalUnknownStructureSize())
+      error = "Incompatible unknown structure found in file " + file_name + " for vector " +
+              std::to_string(v) + ".";
+    else if (not block_entries.empty())
+      for (const size_t entry : block_entries[v])
+        if (entry >= layout.block_sizes[v])
+          error = "Block entry out of range for vector " + std::to_string(v) + ".";
+  }
+  CheckSharedFileError(error, file, file_name);
+
+  // The first rank streams the cell table and broadcasts it block by block. Every rank picks out
+  // its local cells, merging cells that are adjacent in the file into contiguous runs of nodes.
+  struct NodeRun
+  {
+    uint64_t file_node_begin;
+    uint64_t num_nodes;
+    std::vector<const Cell*> cells;
+  };
+  std::vector<NodeRun> runs;
+  size_t num_cells_found = 0;
+
+  const uint64_t table_block_size = 65536;
+  std::vector<uint64_t> cell_table;
+  uint64_t file_node = 0;
+  for (uint64_t c0 = 0; c0 < file_num_global_cells; c0 += table_block_size)
+  {
+    const uint64_t num_cells = std::min(table_block_size, file_num_global_cells - c0);
+    cell_table.resize(2 * num_cells);
+    if (opensn::mpi_comm.rank() == 0 and
+        not ReadAt(file,
+                   layout.cell_table_offset + c0 * 2 * sizeof(uint64_t),
+                   cell_table.data(),
+                   cell_table.size() * sizeof(uint64_t)))
+      error = "Failed to read the cell table of " + file_name + ". The file may be truncated.";
+    CheckSharedFileError(error, file, file_name);
+    mpi_comm.broadcast(cell_table.data(), static_cast<int>(cell_table.size()), 0);
+
+    for (uint64_t c = 0; c < num_cells; ++c)
+    {
+      const uint64_t cell_global_id = cell_table[2 * c];
+      const uint64_t num_cell_nodes = cell_table[2 * c + 1];
+
+      if (grid_ptr_->IsCellLocal(cell_global_id))
+      {
+        const auto& cell = grid_ptr_->cells[cell_global_id];
+        if (num_cell_nodes != discretization_->GetCellNumNodes(cell) and error.empty())
+          error = "Incompatible number of nodes found in file " + file_name + " for cell " +
+                  std::to_string(cell_global_id) + ".";
+
+        if (runs.empty() or runs.back().file_node_begin + runs.back().num_nodes != file_node)
+          runs.push_back({file_node, 0, {}});
+        runs.back().num_nodes += num_cell_nodes;
+        runs.back().cells.push_back(&cell);
+        ++num_cells_found;
+      }
+      file_node += num_cell_nodes;
+    }
+  }
+  if (num_cells_found != grid_ptr_->local_cells.size() and error.empty())
+    error = "Not all local cells were found in file " + file_name + ".";
+  CheckSharedFileError(error, file, file_name);
+
+  // Read the runs of each vector. Runs separated by less than max_read_gap_bytes are read
+  // together, up to max_read_window_bytes per read. Reads are independent, so a failed read
+  // only skips the remaining reads of this rank.
+  const size_t max_read_gap_bytes = size_t(4) << 20;
+  const size_t max_read_window_bytes = size_t(256) << 20;
+
+  dest.clear();
+  std::vector<double> buffer;
+  for (size_t v = 0; v < uk_mans.size(); ++v)
+  {
+    const auto& uk_man = *uk_mans[v];
+    const size_t block_size = layout.block_sizes[v];
+    const size_t node_bytes = block_size * sizeof(double);
+    const bool read_all_entries = block_entries.empty();
+
+    dest.emplace_back(discretization_->GetNumLocalDOFs(uk_man), 0.0);
+    auto& vec = dest.back();
+
+    if (not error.empty() or (not read_all_entries and block_entries[v].empty()))
+      continue;
+
+    for (size_t r0 = 0; r0 < runs.size();)
+    {
+      const uint64_t window_begin = runs[r0].file_node_begin;
+      uint64_t window_end = window_begin + runs[r0].num_nodes;
+      size_t r1 = r0 + 1;
+      for (; r1 < runs.size(); ++r1)
+      {
+        const uint64_t run_end = runs[r1].file_node_begin + runs[r1].num_nodes;
+        if ((runs[r1].file_node_begin - window_end) * node_bytes > max_read_gap_bytes or
+            (run_end - window_begin) * node_bytes > max_read_window_bytes)
+          break;
+        window_end = run_end;
+      }
+
+      buffer.resize((window_end - window_begin) * block_size);
+      if (not ReadAt(file,
+                     layout.vector_offsets[v] + window_begin * node_bytes,
+                     buffer.data(),
+                     buffer.size() * sizeof(double)))
+      {
+        error = "Failed to read vector " + std::to_string(v) + " from " + file_name +
+                ". The file may be truncated.";
+        break;
+      }
+
+      for (size_t r = r0; r < r1; ++r)
+      {
+        auto in = buffer.begin() + (runs[r].file_node_begin - window_begin) * block_size;
+        for (const auto* cell : runs[r].cells)
+          for (size_t i = 0; i < discretization_->GetCellNumNodes(*cell); ++i)
+          {
+            const auto imap = discretization_->MapDOFLocal(*cell, i, uk_man, 0, 0);
+            if (read_all_entries)
+              std::copy_n(in, block_size, vec.begin() + imap);
+            else
+              for (const size_t entry : block_entries[v])
+                vec[imap + entry] = in[entry];
+            in += block_size;
+          }
+      }
+      r0 = r1;
+    }
+  }
+
+  CheckSharedFileError(error, file, file_name);
+  MPI_File_close(&file);
+}
+
 std::vector<double>
 LBSSolver::MakeSourceMomentsFromPhi()
 {
@@ -2898,12 +3342,20 @@ LBSSolver::ComputeFissionProduction(const std::vector<double>& phi)
 
     // Obtain xs
     const auto& xs = transport_view.XS();
-    const auto& F = xs.ProductionMatrix();
+    const auto& F = xs.SparseProductionMatrix();
     const auto& nu_delayed_sigma_f = xs.NuDelayedSigmaF();
 
     if (not xs.IsFissionable())
       continue;
 
+    // For a separable production matrix F[g][g'] = chi[g] w[g'], the production summed over
+    // the groups is the spectrum fraction emitted into the groups times the fission rate
+    const bool separable = xs.IsProductionSeparable();
+    double spectrum_fraction = 0.0;
+    if (separable)
+      for (size_t g = first_grp; g <= last_grp; ++g)
+        spectrum_fraction += xs.ProductionSpectrum()[g];
+
     // Loop over nodes
     const int num_nodes = transport_view.NumNodes();
     for (int i = 0; i < num_nodes; ++i)
@@ -2911,12 +3363,27 @@ LBSSolver::ComputeFissionProduction(const std::vector<double>& phi)
       const size_t uk_map = transport_view.MapDOF(i, 0, 0);
       const double IntV_ShapeI = cell_matrices.intV_shapeI[i];
 
+      if (separable)
+      {
+        const auto& weights = xs.ProductionWeights();
+        double fission_rate = 0.0;
+        for (size_t gp = 0; gp <= last_grp; ++gp)
+          fission_rate += weights[gp] * phi[uk_map + gp];
+        local_production += spectrum_fraction * fission_rate * IntV_ShapeI;
+      }
+
       // Loop over groups
       for (size_t g = first_grp; g <= last_grp; ++g)
       {
-        const auto& prod = F[g];
-        for (size_t gp = 0; gp <= last_grp; ++gp)
-          local_production += prod[gp] * phi[uk_map + gp] * IntV_ShapeI;
+        if (not separable)
+        {
+          const size_t row_size = F.RowSize(g);
+          const uint32_t* cols = F.RowColumnIndices(g);
+          const double* vals = F.RowValues(g);
+          for (size_t k = 0; k < row_size; ++k)
+            if (cols[k] <= last_grp)
+              local_production += vals[k] * phi[uk_map + cols[k]] * IntV_ShapeI;
+        }
 
         if (options_.use_precursors)
           for (unsigned int j = 0; j < xs.NumPrecursors(); ++j)
@@ -9,6 +9,8 @@
 #include "modules/linear_boltzmann_solvers/lbs_solver/point_source/point_source.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/distributed_source/distributed_source.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/lbs_structs.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/performance_counters.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/unit_cell_matrix_store.h"
 #include "framework/math/spatial_discretization/spatial_discretization.h"
 #include "framework/math/linear_solver/linear_solver.h"
 #include "framework/physics/solver_base/solver.h"
@@ -156,9 +158,9 @@ public:
   const class SpatialDiscretization& SpatialDiscretization() const;
 
   /**
-   * Returns read-only access to the unit cell matrices.
+   * Returns read-only access to the unit cell matrices. Congruent cells share their matrices.
    */
-  const std::vector<UnitCellMatrices>& GetUnitCellMatrices() const;
+  const UnitCellMatrixStore& GetUnitCellMatrices() const;
 
   /**
    * Returns read-only access to the unit ghost cell matrices.
@@ -267,6 +269,22 @@ public:
 
   SetSourceFunction GetActiveSetSourceFunction() const;
 
+  /**Returns the performance counters of this location.*/
+  const PerformanceCounters& GetPerformanceCounters() const;
+
+  /**
+   * Returns the performance counters of this location, for the source functions, within-group
+   * solvers and sweeps of the solver to update.
+   */
+  PerformanceCounters& GetPerformanceCounters();
+
+  /**
+   * Returns the performance counter named by the "name" parameter, reduced over all locations
+   * (see GlobalPerformanceCounter). This is a collective operation: it must be called on all
+   * locations, with the same parameter, as it is by the solver info post-processors.
+   */
+  ParameterBlock GetInfo(const ParameterBlock& params) const override;
+
   std::shared_ptr<AGSLinearSolver> GetPrimaryAGSSolver();
 
   std::vector<std::shared_ptr<LinearSolver>>& GetWGSSolvers();
@@ -334,12 +352,13 @@ public:
                                       std::vector<double>& ref_phi_new);
 
   /**
-   * Writes phi_old to restart file.
+   * Writes phi_old to a single shared restart file.
    */
   void WriteRestartData(const std::string& folder_name, const std::string& file_base) const;
 
   /**
-   * Read phi_old from restart file.
+   * Read phi_old from a shared restart file. The file may have been written with a different
+   * number of ranks.
    */
   void ReadRestartData(const std::string& folder_name, const std::string& file_base);
 
@@ -369,6 +388,32 @@ public:
                                  const LBSGroupset& groupset,
                                  std::vector<double>& dest) const;
 
+  /**
+   * Writes the angular flux vectors of all groupsets to a single shared file using collective
+   * MPI-IO. Cell global ids are stored once and each groupset is written as one dense block, so
+   * the file can be read back on any number of ranks.
+   */
+  void WriteAngularFluxesParallel(const std::vector<std::vector<double>>& src,
+                                  const std::string& file_name) const;
+
+  /**
+   * Reads a shared angular flux file written by WriteAngularFluxesParallel into the specified
+   * vector. The file may have been written with a different number of ranks.
+   *
+   * \param file_name The shared file.
+   * \param dest One angular flux vector per groupset.
+   * \param groups The global ids of the groups to read. Empty reads all groups.
+   * \param angles The angle indices, within the groupset quadratures, to read. Empty reads all
+   *        angles.
+   *
+   * Entries of groups or angles that are not read are set to zero. Groupsets without any selected
+   * entry are not read from the file at all.
+   */
+  void ReadAngularFluxesParallel(const std::string& file_name,
+                                 std::vector<std::vector<double>>& dest,
+                                 const std::vector<size_t>& groups = {},
+                                 const std::vector<size_t>& angles = {}) const;
+
   /**
    * Makes a source-moments vector from scattering and fission based on the latest phi-solution.
    */
@@ -524,6 +569,35 @@ protected:
   /**Initializes the Within-Group DSA solver. */
   void InitTGDSA(LBSGroupset& groupset);
 
+  /**
+   * Writes a set of nodal vectors to a single shared binary file using collective MPI-IO. The
+   * file contains a table with the global id and node count of every cell, followed by one dense
+   * block per vector in the order of that table. Errors on any rank close the file and are
+   * raised on all ranks.
+   */
+  void WriteNodalVectorsParallel(const std::string& file_name,
+                                 const std::string& title,
+                                 const std::vector<const std::vector<double>*>& src,
+                                 const std::vector<const opensn::UnknownManager*>& uk_mans) const;
+
+  /**
+   * Reads nodal vectors written by WriteNodalVectorsParallel. Cells are matched by global id, so
+   * the file may have been written with a different number of ranks.
+   *
+   * The first rank reads the cell table and broadcasts it. Each rank then reads the parts of the
+   * file holding its own cells. Parts separated by small gaps are merged into large contiguous
+   * reads, and the gaps are discarded. Errors on any rank close the file and are raised on all
+   * ranks.
+   *
+   * \param block_entries Per vector, the entries of each node block (unknown-component pairs in
+   *        nodal order) to read. The other entries are set to zero and a vector without entries is
+   *        not read. Empty reads all entries of all vectors.
+   */
+  void ReadNodalVectorsParallel(const std::string& file_name,
+                                const std::vector<const opensn::UnknownManager*>& uk_mans,
+                                std::vector<std::vector<double>>& dest,
+                                const std::vector<std::vector<size_t>>& block_entries = {}) const;
+
   double last_restart_write_ = 0.0;
 
   lbs::Options options_;
@@ -548,7 +622,7 @@ protected:
   std::shared_ptr<MPICommunicatorSet> grid_local_comm_set_ = nullptr;
   std::shared_ptr<GridFaceHistogram> grid_face_histogram_ = nullptr;
 
-  std::vector<UnitCellMatrices> unit_cell_matrices_;
+  UnitCellMatrixStore unit_cell_matrices_;
   std::map<uint64_t, UnitCellMatrices> unit_ghost_cell_matrices_;
   std::vector<lbs::CellLBSView> cell_transport_views_;
 
@@ -569,6 +643,8 @@ protected:
 
   SetSourceFunction active_set_source_function_;
 
+  PerformanceCounters performance_counters_;
+
   std::vector<std::shared_ptr<AGSLinearSolver>> ags_solvers_;
   std::vector<std::shared_ptr<LinearSolver>> wgs_solvers_;
   std::shared_ptr<AGSLinearSolver> primary_ags_solver_;
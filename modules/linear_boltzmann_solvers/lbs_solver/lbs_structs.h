@@ -217,6 +217,12 @@ struct Options
   SDMType sd_type = SDMType::PIECEWISE_LINEAR_DISCONTINUOUS;
   unsigned int scattering_order = 1;
   int max_mpi_message_size = 32768;
+  bool use_persistent_sweep_comm = false;
+  unsigned int num_sweep_threads = 1;
+  unsigned int num_source_threads = 1;
+  unsigned int num_sweep_ordering_threads = 1;
+  unsigned int num_initialization_threads = 1;
+  std::string sweep_ordering_cache_folder_name;
 
   bool read_restart_data = false;
   std::string read_restart_folder_name = std::string("YRestart");
@@ -238,6 +244,8 @@ struct Options
   bool verbose_ags_iterations = false;
   bool verbose_outer_iterations = true;
 
+  bool log_performance_counters = false;
+
   bool power_field_function_on = false;
   double power_default_kappa = 3.20435e-11; // 200MeV to Joule
   double power_normalization = -1.0;
@@ -260,6 +268,7 @@ private:
   int num_grps_moms_;
   const MultiGroupXS* xs_;
   double volume_;
+  uint32_t unit_cell_matrices_index_;
   const std::vector<bool> face_local_flags_;
   const std::vector<int> face_locality_;
   const std::vector<const Cell*> neighbor_cell_ptrs_;
@@ -272,6 +281,7 @@ public:
               int num_moments,
               const MultiGroupXS& xs_mapping,
               double volume,
+              uint32_t unit_cell_matrices_index,
               const std::vector<bool>& face_local_flags,
               const std::vector<int>& face_locality,
               const std::vector<const Cell*>& neighbor_cell_ptrs,
@@ -282,6 +292,7 @@ public:
       num_grps_moms_(num_groups * num_moments),
       xs_(&xs_mapping),
       volume_(volume),
+      unit_cell_matrices_index_(unit_cell_matrices_index),
       face_local_flags_(face_local_flags),
       face_locality_(face_locality),
       neighbor_cell_ptrs_(neighbor_cell_ptrs)
@@ -305,6 +316,9 @@ public:
 
   double Volume() const { return volume_; }
 
+  /// Index of the cell's set of matrices in the unit cell matrix store.
+  uint32_t UnitCellMatricesIndex() const { return unit_cell_matrices_index_; }
+
   void ZeroOutflow() { outflow_.assign(outflow_.size(), 0.0); }
   void ZeroOutflow(int g)
   {
@@ -0,0 +1,169 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "modules/linear_boltzmann_solvers/lbs_solver/performance_counters.h"
+#include "framework/logging/log.h"
+#include "framework/logging/log_exceptions.h"
+#include "framework/runtime.h"
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+namespace opensn
+{
+namespace lbs
+{
+
+namespace
+{
+
+enum class Reduction
+{
+  MIN,
+  MAX,
+  SUM
+};
+
+struct CounterEntry
+{
+  const char* name;
+  const char* label;
+  double value;
+  Reduction reduction;
+};
+
+/**Returns the counters in reporting order.*/
+std::vector<CounterEntry>
+CounterEntries(const PerformanceCounters& c)
+{
+  const auto count = [](size_t value) { return static_cast<double>(value); };
+
+  return {
+    {"source_time", "Source evaluation time (s)", c.source_time, Reduction::MAX},
+    {"num_source_evaluations",
+     "Source evaluations",
+     count(c.num_source_evaluations),
+     Reduction::MAX},
+    {"wgs_time", "Within-group solve time (s)", c.wgs_time, Reduction::MAX},
+    {"krylov_time", "  Krylov and preconditioning time (s)", c.krylov_time, Reduction::MAX},
+    {"num_wgs_solves", "Within-group solves", count(c.num_wgs_solves), Reduction::MAX},
+    {"num_krylov_iterations",
+     "Krylov iterations",
+     count(c.num_krylov_iterations),
+     Reduction::MAX},
+    {"sweep_time", "Sweep time (s)", c.sweep_time, Reduction::MAX},
+    {"angle_set_time", "  Angle set execution time (s)", c.angle_set_time, Reduction::MAX},
+    {"sweep_idle_time", "  Sweep idle time (s)", c.sweep_idle_time, Reduction::MAX},
+    {"num_sweeps", "Sweeps", count(c.num_sweeps), Reduction::MAX},
+    {"num_angle_set_executions",
+     "Angle set executions",
+     count(c.num_angle_set_executions),
+     Reduction::MAX},
+    {"min_angle_set_execution_time",
+     "Shortest angle set execution (s)",
+     c.min_angle_set_execution_time,
+     Reduction::MIN},
+    {"max_angle_set_execution_time",
+     "Longest angle set execution (s)",
+     c.max_angle_set_execution_time,
+     Reduction::MAX},
+    {"poll_time", "CBC poll time (s)", c.poll_time, Reduction::MAX},
+    {"num_idle_advances", "CBC idle advances", count(c.num_idle_advances), Reduction::SUM},
+    {"num_cell_solves", "Cell solves", count(c.num_cell_solves), Reduction::SUM},
+    {"num_cell_solve_flops",
+     "Estimated cell solve FLOPs",
+     c.num_cell_solve_flops,
+     Reduction::SUM},
+    {"num_messages_sent", "Messages sent", count(c.num_messages_sent), Reduction::SUM},
+    {"num_bytes_sent", "Bytes sent", count(c.num_bytes_sent), Reduction::SUM},
+    {"num_messages_received", "Messages received", count(c.num_messages_received), Reduction::SUM},
+    {"num_bytes_received", "Bytes received", count(c.num_bytes_received), Reduction::SUM}};
+}
+
+/**The shortest angle set execution is infinite on locations that did not execute any.*/
+double
+FiniteOrZero(double value)
+{
+  return value == std::numeric_limits<double>::infinity() ? 0.0 : value;
+}
+
+} // namespace
+
+double
+GlobalPerformanceCounter(const PerformanceCounters& counters, const std::string& name)
+{
+  for (const auto& entry : CounterEntries(counters))
+  {
+    if (name != entry.name)
+      continue;
+
+    double value = 0.0;
+    if (entry.reduction == Reduction::MIN)
+      mpi_comm.all_reduce(entry.value, value, mpi::op::min<double>());
+    else if (entry.reduction == Reduction::MAX)
+      mpi_comm.all_reduce(entry.value, value, mpi::op::max<double>());
+    else
+      mpi_comm.all_reduce(entry.value, value, mpi::op::sum<double>());
+    return FiniteOrZero(value);
+  }
+
+  OpenSnInvalidArgument("Unknown performance counter \"" + name + "\".");
+}
+
+void
+LogPerformanceCounters(const PerformanceCounters& counters)
+{
+  const auto entries = CounterEntries(counters);
+  const size_t num_entries = entries.size();
+
+  // The local sweep idle fraction is reduced along with the counters
+  std::vector<double> local_values;
+  local_values.reserve(num_entries + 1);
+  for (const auto& entry : entries)
+    local_values.push_back(entry.value);
+  local_values.push_back(counters.sweep_time > 0.0
+                           ? counters.sweep_idle_time / counters.sweep_time
+                           : 0.0);
+
+  std::vector<double> local_finite_values;
+  for (const double value : local_values)
+    local_finite_values.push_back(FiniteOrZero(value));
+
+  const int count = static_cast<int>(local_values.size());
+  std::vector<double> min_values(count), max_values(count), sum_values(count);
+  mpi_comm.all_reduce(local_values.data(), count, min_values.data(), mpi::op::min<double>());
+  mpi_comm.all_reduce(local_finite_values.data(), count, max_values.data(), mpi::op::max<double>());
+  mpi_comm.all_reduce(local_finite_values.data(), count, sum_values.data(), mpi::op::sum<double>());
+
+  const auto num_locations = static_cast<double>(mpi_comm.size());
+  const auto Index = [&entries](const std::string& name)
+  {
+    size_t i = 0;
+    while (entries[i].name != name)
+      ++i;
+    return i;
+  };
+
+  std::stringstream outstr;
+  outstr << "\nPerformance counters over " << mpi_comm.size() << " location(s)\n"
+         << std::left << std::setw(40) << "" << std::right << std::setw(14) << "min"
+         << std::setw(14) << "avg" << std::setw(14) << "max" << "\n";
+  outstr << std::setprecision(5);
+  for (size_t i = 0; i < num_entries; ++i)
+    outstr << std::left << std::setw(40) << entries[i].label << std::right << std::setw(14)
+           << FiniteOrZero(min_values[i]) << std::setw(14) << sum_values[i] / num_locations
+           << std::setw(14) << max_values[i] << "\n";
+
+  const size_t angle_set_time = Index("angle_set_time");
+  const double avg_angle_set_time = sum_values[angle_set_time] / num_locations;
+  const double max_angle_set_time = max_values[angle_set_time];
+  outstr << "Sweep idle fraction (max over locations): " << max_values[num_entries] << "\n"
+         << "Sweep load imbalance (max/avg angle set execution time): "
+         << (avg_angle_set_time > 0.0 ? max_angle_set_time / avg_angle_set_time : 1.0) << "\n";
+
+  log.Log() << outstr.str();
+}
+
+} // namespace lbs
+} // namespace opensn
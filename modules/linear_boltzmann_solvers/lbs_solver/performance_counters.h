@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <string>
+
+namespace opensn
+{
+namespace lbs
+{
+
+/**
+ * Performance counters of an LBS solver, accumulated on each location over the lifetime of the
+ * solver. The counters are always collected: clocks are only read once per source evaluation,
+ * within-group solve, sweep and angle set execution, and message counters are incremented where
+ * messages are posted.
+ */
+struct PerformanceCounters
+{
+  /// Wall time, in seconds, spent evaluating source functions.
+  double source_time = 0.0;
+  size_t num_source_evaluations = 0;
+
+  /// Wall time, in seconds, of within-group solves.
+  double wgs_time = 0.0;
+  /// Part of `wgs_time` spent neither sweeping nor evaluating sources, i.e., in Krylov vector
+  /// operations and preconditioning.
+  double krylov_time = 0.0;
+  size_t num_wgs_solves = 0;
+  size_t num_krylov_iterations = 0;
+
+  /// Wall time, in seconds, of sweeps, including communication.
+  double sweep_time = 0.0;
+  /// Wall time, in seconds, of the sweep chunks executed by angle sets, summed over threads.
+  double angle_set_time = 0.0;
+  /// Wall time, in seconds, during sweeps in which no sweep chunk was executing on this location,
+  /// i.e., waiting for upstream data or for sends to complete.
+  double sweep_idle_time = 0.0;
+  size_t num_sweeps = 0;
+  size_t num_angle_set_executions = 0;
+  /// Shortest and longest time, in seconds, of a single angle set execution.
+  double min_angle_set_execution_time = std::numeric_limits<double>::infinity();
+  double max_angle_set_execution_time = 0.0;
+  /// Wall time, in seconds, that CBC angle sets spent receiving and sending messages.
+  double poll_time = 0.0;
+  /// Number of CBC angle set advances that found no cell ready because all remaining cells were
+  /// waiting on upstream data.
+  size_t num_idle_advances = 0;
+
+  /// Number of cell solves (one per cell, angle and group) and an estimate of their
+  /// floating-point operations.
+  size_t num_cell_solves = 0;
+  double num_cell_solve_flops = 0.0;
+
+  size_t num_messages_sent = 0;
+  size_t num_bytes_sent = 0;
+  size_t num_messages_received = 0;
+  size_t num_bytes_received = 0;
+};
+
+/**
+ * Returns the counter named `name` (e.g. "sweep_time"), reduced over all locations. Times and the
+ * numbers of evaluations, solves, iterations, sweeps and angle set executions, which are the same
+ * on all locations, are maxima. The shortest angle set execution is a minimum. Idle advances, cell
+ * solves, FLOPs, messages and bytes are sums. Collective.
+ */
+double GlobalPerformanceCounter(const PerformanceCounters& counters, const std::string& name);
+
+/**
+ * Logs a table of the counters (minimum, average and maximum over all locations) followed by the
+ * fractions of the sweep time spent computing and idling and the sweep load imbalance.
+ * Collective.
+ */
+void LogPerformanceCounters(const PerformanceCounters& counters);
+
+} // namespace lbs
+} // namespace opensn
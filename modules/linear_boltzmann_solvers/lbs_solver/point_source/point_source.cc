@@ -61,35 +61,33 @@ PointSource::Initialize(const LBSSolver& lbs_solver)
   // Find local subscribers
   double total_volume = 0.0;
   std::vector<Subscriber> subscribers;
-  for (const auto& cell : grid.local_cells)
+  for (uint64_t global_id : grid.FindCellsContainingPoint(location_))
   {
-    if (grid.CheckPointInsideCell(cell, location_))
-    {
-      const auto& cell_mapping = discretization.GetCellMapping(cell);
-      const auto& fe_values = unit_cell_matrices[cell.local_id_];
+    const auto& cell = grid.cells[global_id];
 
-      // Map the point source to the finite element space
-      std::vector<double> shape_vals;
-      cell_mapping.ShapeValues(location_, shape_vals);
-      const auto M_inv = Inverse(fe_values.intV_shapeI_shapeJ);
-      const auto node_wgts = MatMul(M_inv, shape_vals);
+    const auto& cell_mapping = discretization.GetCellMapping(cell);
+    const auto& fe_values = unit_cell_matrices[cell.local_id_];
 
-      // Increment the total volume
-      total_volume += cell_mapping.CellVolume();
+    // Map the point source to the finite element space
+    std::vector<double> shape_vals;
+    cell_mapping.ShapeValues(location_, shape_vals);
+    const auto M_inv = Inverse(fe_values.intV_shapeI_shapeJ);
+    const auto node_wgts = MatMul(M_inv, shape_vals);
 
-      // Add to subscribers
-      subscribers.push_back(
-        Subscriber{cell_mapping.CellVolume(), cell.local_id_, shape_vals, node_wgts});
-    }
+    // Increment the total volume
+    total_volume += cell_mapping.CellVolume();
+
+    // Add to subscribers
+    subscribers.push_back(
+      Subscriber{cell_mapping.CellVolume(), cell.local_id_, shape_vals, node_wgts});
   }
 
   // If the point source lies on a partition boundary, ghost cells must be
   // added to the total volume.
-  auto ghost_global_ids = grid.cells.GetGhostGlobalIDs();
-  for (uint64_t global_id : ghost_global_ids)
+  for (uint64_t global_id : grid.FindCellsContainingPoint(location_, true))
   {
     const auto& nbr_cell = grid.cells[global_id];
-    if (grid.CheckPointInsideCell(nbr_cell, location_))
+    if (not grid.IsCellLocal(global_id))
     {
       const auto& fe_values = ghost_unit_cell_matrices.at(nbr_cell.global_id_);
       total_volume +=
@@ -7,13 +7,16 @@
 #include "framework/runtime.h"
 #include "framework/logging/log.h"
 #include "caliper/cali.h"
+#include <algorithm>
+#include <chrono>
 
 namespace opensn
 {
 namespace lbs
 {
 
-SourceFunction::SourceFunction(const LBSSolver& lbs_solver) : lbs_solver_(lbs_solver)
+SourceFunction::SourceFunction(LBSSolver& lbs_solver)
+  : lbs_solver_(lbs_solver), performance_counters_(lbs_solver.GetPerformanceCounters())
 {
 }
 
@@ -29,6 +32,8 @@ SourceFunction::operator()(const LBSGroupset& groupset,
   if (source_flags.Empty())
     return;
 
+  const auto start_time = std::chrono::steady_clock::now();
+
   apply_fixed_src_ = (source_flags & APPLY_FIXED_SOURCES);
   apply_wgs_scatter_src_ = (source_flags & APPLY_WGS_SCATTER_SOURCES);
   apply_ags_scatter_src_ = (source_flags & APPLY_AGS_SCATTER_SOURCES);
@@ -45,33 +50,82 @@ SourceFunction::operator()(const LBSGroupset& groupset,
 
   default_zero_src_.assign(lbs_solver_.Groups().size(), 0.0);
 
+  // Apply all nodal sources. Each cell only writes its own entries of q, so contiguous blocks of
+  // cells can be processed concurrently.
+  const size_t num_local_cells = lbs_solver_.Grid().local_cells.size();
+  const size_t num_threads = std::max<size_t>(
+    1, std::min<size_t>(lbs_solver_.Options().num_source_threads, num_local_cells));
+  if (num_threads == 1)
+    AddCellSources(groupset, 0, num_local_cells, q, phi, densities);
+  else
+  {
+    if (not thread_pool_ or thread_pool_->NumThreads() != num_threads - 1)
+      thread_pool_ = std::make_unique<ThreadPool>(num_threads - 1);
+
+    const size_t block_size = (num_local_cells + num_threads - 1) / num_threads;
+    std::vector<std::future<void>> pending;
+    for (size_t t = 1; t < num_threads; ++t)
+    {
+      const size_t cell_begin = std::min(t * block_size, num_local_cells);
+      const size_t cell_end = std::min(cell_begin + block_size, num_local_cells);
+      pending.push_back(thread_pool_->Submit(
+        [&, cell_begin, cell_end]
+        { AddCellSources(groupset, cell_begin, cell_end, q, phi, densities); }));
+    }
+    AddCellSources(groupset, 0, std::min(block_size, num_local_cells), q, phi, densities);
+    for (auto& future : pending)
+      future.get();
+  }
+
+  AddAdditionalSources(groupset, q, phi, source_flags);
+
+  performance_counters_.source_time +=
+    std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+  ++performance_counters_.num_source_evaluations;
+}
+
+void
+SourceFunction::AddCellSources(const LBSGroupset& groupset,
+                               const size_t cell_begin,
+                               const size_t cell_end,
+                               std::vector<double>& q,
+                               const std::vector<double>& phi,
+                               const std::vector<double>& densities) const
+{
   const auto& cell_transport_views = lbs_solver_.GetCellTransportViews();
   const auto& matid_to_src_map = lbs_solver_.GetMatID2IsoSrcMap();
 
   const auto num_moments = lbs_solver_.NumMoments();
   const auto& ext_src_moments_local = lbs_solver_.ExtSrcMomentsLocal();
+  const bool use_src_moments = lbs_solver_.Options().use_src_moments;
+  const bool use_precursors = lbs_solver_.Options().use_precursors;
 
   const auto& m_to_ell_em_map = groupset.quadrature_->GetMomentToHarmonicsIndexMap();
 
-  // Apply all nodal sources
+  const bool apply_scatter_src = apply_ags_scatter_src_ or apply_wgs_scatter_src_;
+
   const auto& grid = lbs_solver_.Grid();
-  for (const auto& cell : grid.local_cells)
+  for (size_t c = cell_begin; c < cell_end; ++c)
   {
+    const auto& cell = grid.local_cells[c];
     const auto& rho = densities[cell.local_id_];
     const auto& transport_view = cell_transport_views[cell.local_id_];
-    cell_volume_ = transport_view.Volume();
+    const double cell_volume = transport_view.Volume();
 
     // Obtain xs
     const auto& xs = transport_view.XS();
 
-    std::shared_ptr<IsotropicMultiGrpSource> P0_src = nullptr;
-    if (matid_to_src_map.count(cell.material_id_) > 0)
-      P0_src = matid_to_src_map.at(cell.material_id_);
+    const auto src_it = matid_to_src_map.find(cell.material_id_);
+    const IsotropicMultiGrpSource* P0_src =
+      src_it != matid_to_src_map.end() ? src_it->second.get() : nullptr;
 
     const auto& S = xs.TransferMatrices();
-    const auto& F = xs.ProductionMatrix();
+    const auto& F = xs.SparseProductionMatrix();
     const auto& precursors = xs.Precursors();
     const auto& nu_delayed_sigma_f = xs.NuDelayedSigmaF();
+    const bool separable_fission = xs.IsFissionable() and xs.IsProductionSeparable();
+    const auto& fission_spectrum = xs.ProductionSpectrum();
+    const auto& fission_weights = xs.ProductionWeights();
 
     // Loop over nodes
     const auto num_nodes = transport_view.NumNodes();
@@ -85,61 +139,90 @@ SourceFunction::operator()(const LBSGroupset& groupset,
         const double* phi_im = &phi[uk_map];
 
         // Declare moment src
+        const double* fixed_src_moments = default_zero_src_.data();
         if (P0_src and ell == 0)
-          fixed_src_moments_ = P0_src->source_value_g.data();
-        else
-          fixed_src_moments_ = default_zero_src_.data();
+          fixed_src_moments = P0_src->source_value_g.data();
+        if (use_src_moments)
+          fixed_src_moments = &ext_src_moments_local[uk_map];
+
+        // A separable production matrix F[g][g'] = chi[g] w[g'] only needs the fission rate
+        // sum_g' w[g'] phi[g'], which is the same for all destination groups
+        double fission_rate = 0.0;
+        if (separable_fission and ell == 0)
+        {
+          if (apply_ags_fission_src_)
+            for (size_t gp = first_grp_; gp <= last_grp_; ++gp)
+              if (gp < gs_i_ or gp > gs_f_)
+                fission_rate += fission_weights[gp] * phi_im[gp];
 
-        if (lbs_solver_.Options().use_src_moments)
-          fixed_src_moments_ = &ext_src_moments_local[uk_map];
+          if (apply_wgs_fission_src_)
+            for (size_t gp = gs_i_; gp <= gs_f_; ++gp)
+              fission_rate += fission_weights[gp] * phi_im[gp];
+        }
 
         // Loop over groupset groups
         for (size_t g = gs_i_; g <= gs_f_; ++g)
         {
-          g_ = g;
-
           double rhs = 0.0;
 
           // Apply fixed sources
           if (apply_fixed_src_)
-            rhs += this->AddSourceMoments();
+            rhs += this->AddSourceMoments(fixed_src_moments, g);
 
-          // Apply scattering sources
-          if (ell < S.size())
+          // Apply scattering sources. Across GroupSet Scattering (AGS) comes from groups outside
+          // the groupset, Within GroupSet Scattering (WGS) from groups inside it.
+          if (apply_scatter_src and ell < S.size())
           {
             const auto& S_ell = S[ell];
-            // Add Across GroupSet Scattering (AGS)
-            if (apply_ags_scatter_src_)
-              for (const auto& [_, gp, sigma_sm] : S_ell.Row(g))
-                if (gp < gs_i_ or gp > gs_f_)
-                  rhs += rho * sigma_sm * phi_im[gp];
-
-            // Add Within GroupSet Scattering (WGS)
-            if (apply_wgs_scatter_src_)
-              for (const auto& [_, gp, sigma_sm] : S_ell.Row(g))
-                if (gp >= gs_i_ and gp <= gs_f_)
-                {
-                  if (suppress_wg_scatter_src_ and g_ == gp)
-                    continue;
-                  rhs += rho * sigma_sm * phi_im[gp];
-                }
+            const size_t row_size = S_ell.RowSize(g);
+            const uint32_t* cols = S_ell.RowColumnIndices(g);
+            const double* vals = S_ell.RowValues(g);
+            for (size_t k = 0; k < row_size; ++k)
+            {
+              const size_t gp = cols[k];
+              const bool within_groupset = gp >= gs_i_ and gp <= gs_f_;
+              if (within_groupset)
+              {
+                if (not apply_wgs_scatter_src_ or (suppress_wg_scatter_src_ and g == gp))
+                  continue;
+              }
+              else if (not apply_ags_scatter_src_)
+                continue;
+              rhs += rho * vals[k] * phi_im[gp];
+            }
           }
 
           // Apply fission sources
           if (xs.IsFissionable() and ell == 0)
           {
-            const auto& F_g = F[g];
-            if (apply_ags_fission_src_)
-              for (size_t gp = first_grp_; gp <= last_grp_; ++gp)
-                if (gp < gs_i_ or gp > gs_f_)
-                  rhs += rho * F_g[gp] * phi_im[gp];
-
-            if (apply_wgs_fission_src_)
-              for (size_t gp = gs_i_; gp <= gs_f_; ++gp)
-                rhs += rho * F_g[gp] * phi_im[gp];
-
-            if (lbs_solver_.Options().use_precursors)
-              rhs += this->AddDelayedFission(precursors, rho, nu_delayed_sigma_f, &phi[uk_map]);
+            if (separable_fission)
+              rhs += rho * fission_spectrum[g] * fission_rate;
+            else
+            {
+              // Only the non-zero entries of the production matrix are visited
+              const size_t row_size = F.RowSize(g);
+              const uint32_t* cols = F.RowColumnIndices(g);
+              const double* vals = F.RowValues(g);
+              if (apply_ags_fission_src_)
+                for (size_t k = 0; k < row_size; ++k)
+                {
+                  const size_t gp = cols[k];
+                  if (gp >= first_grp_ and gp <= last_grp_ and (gp < gs_i_ or gp > gs_f_))
+                    rhs += rho * vals[k] * phi_im[gp];
+                }
+
+              if (apply_wgs_fission_src_)
+                for (size_t k = 0; k < row_size; ++k)
+                {
+                  const size_t gp = cols[k];
+                  if (gp >= gs_i_ and gp <= gs_f_)
+                    rhs += rho * vals[k] * phi_im[gp];
+                }
+            }
+
+            if (use_precursors)
+              rhs += this->AddDelayedFission(
+                precursors, rho, nu_delayed_sigma_f, &phi[uk_map], g, cell_volume);
           }
 
           // Add to destination vector
@@ -149,34 +232,34 @@ SourceFunction::operator()(const LBSGroupset& groupset,
       }   // for m
     }     // for dof i
   }       // for cell
-
-  AddAdditionalSources(groupset, q, phi, source_flags);
 }
 
 double
-SourceFunction::AddSourceMoments() const
+SourceFunction::AddSourceMoments(const double* fixed_src_moments, const size_t g) const
 {
-  return fixed_src_moments_[g_];
+  return fixed_src_moments[g];
 }
 
 double
 SourceFunction::AddDelayedFission(const PrecursorList& precursors,
                                   const double& rho,
                                   const std::vector<double>& nu_delayed_sigma_f,
-                                  const double* phi) const
+                                  const double* phi,
+                                  const size_t g,
+                                  const double cell_volume) const
 {
   double value = 0.0;
   if (apply_ags_fission_src_)
     for (size_t gp = first_grp_; gp <= last_grp_; ++gp)
       if (gp < gs_i_ or gp > gs_f_)
         for (const auto& precursor : precursors)
-          value += precursor.emission_spectrum[g_] * precursor.fractional_yield * rho *
+          value += precursor.emission_spectrum[g] * precursor.fractional_yield * rho *
                    nu_delayed_sigma_f[gp] * phi[gp];
 
   if (apply_wgs_fission_src_)
     for (size_t gp = gs_i_; gp <= gs_f_; ++gp)
       for (const auto& precursor : precursors)
-        value += precursor.emission_spectrum[g_] * precursor.fractional_yield * rho *
+        value += precursor.emission_spectrum[g] * precursor.fractional_yield * rho *
                  nu_delayed_sigma_f[gp] * phi[gp];
 
   return value;
@@ -238,25 +321,29 @@ SourceFunction::AddDistributedSources(const LBSGroupset& groupset,
   // Go through each distributed source, and its subscribing cells
   if (not lbs_solver_.Options().use_src_moments and apply_fixed_src)
   {
+    std::vector<double> src_buffer;
     for (const auto& distributed_source : lbs_solver_.DistributedSources())
     {
-      for (const auto local_id : distributed_source.Subscribers())
+      const auto& subscribers = distributed_source.Subscribers();
+      for (size_t s = 0; s < subscribers.size(); ++s)
       {
+        const auto local_id = subscribers[s];
         const auto& cell = grid.local_cells[local_id];
         const auto& transport_view = cell_transport_views[local_id];
         const auto nodes = discretization.GetCellNodeLocations(cell);
         const auto num_cell_nodes = discretization.GetCellNumNodes(cell);
 
+        // Compute group-wise values for all cell nodes at once
+        const double* src =
+          distributed_source.EvaluateSubscriber(s, cell, nodes, num_groups, src_buffer);
+
         // Go through each of the cell nodes
         for (size_t i = 0; i < num_cell_nodes; ++i)
         {
-          // Compute group-wise values for this node
-          const auto src = distributed_source(cell, nodes[i], num_groups);
-
           // Contribute to the source moments
           const auto dof_map = transport_view.MapDOF(i, 0, 0);
           for (size_t g = gs_i; g <= gs_f; ++g)
-            q[dof_map + g] += src[g];
+            q[dof_map + g] += src[i * num_groups + g];
         } // for node i
       }   // for subscriber
     }     // for distributed source
@@ -4,7 +4,9 @@
 #pragma once
 
 #include "modules/linear_boltzmann_solvers/lbs_solver/lbs_structs.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/performance_counters.h"
 #include "framework/materials/multi_group_xs/multi_group_xs.h"
+#include "framework/utils/thread_pool.h"
 #include <memory>
 #include <utility>
 
@@ -22,6 +24,7 @@ class SourceFunction
 {
 protected:
   const LBSSolver& lbs_solver_;
+  PerformanceCounters& performance_counters_;
 
   bool apply_fixed_src_ = false;
   bool apply_wgs_scatter_src_ = false;
@@ -35,14 +38,15 @@ protected:
   size_t first_grp_ = 0;
   size_t last_grp_ = 0;
 
-  double cell_volume_ = 0.0;
-  size_t g_ = 0;
-  const double* fixed_src_moments_ = nullptr;
   std::vector<double> default_zero_src_;
 
+  /**Worker threads used in addition to the calling thread when the
+   * solver option `num_source_threads` is larger than one.*/
+  std::unique_ptr<ThreadPool> thread_pool_;
+
 public:
   /**Constructor.*/
-  explicit SourceFunction(const LBSSolver& lbs_solver);
+  explicit SourceFunction(LBSSolver& lbs_solver);
   virtual ~SourceFunction() = default;
 
   /**Sets the source moments for the groups in the current group set.
@@ -63,14 +67,20 @@ public:
                           const std::vector<double>& densities,
                           const SourceFlags source_flags);
 
-  virtual double AddSourceMoments() const;
+  /**Returns the fixed source moment of group `g`. Called concurrently
+   * from multiple threads when source threading is enabled.*/
+  virtual double AddSourceMoments(const double* fixed_src_moments, size_t g) const;
 
   typedef std::vector<MultiGroupXS::Precursor> PrecursorList;
-  /**Adds delayed particle precursor sources.*/
+  /**Adds delayed particle precursor sources for group `g` of a cell with
+   * volume `cell_volume`. Called concurrently from multiple threads when
+   * source threading is enabled.*/
   virtual double AddDelayedFission(const PrecursorList& precursors,
                                    const double& rho,
                                    const std::vector<double>& nu_delayed_sigma_f,
-                                   const double* phi) const;
+                                   const double* phi,
+                                   size_t g,
+                                   double cell_volume) const;
 
   virtual void AddAdditionalSources(const LBSGroupset& groupset,
                                     std::vector<double>& q,
@@ -92,6 +102,16 @@ public:
                              std::vector<double>& q,
                              const std::vector<double>& phi,
                              const SourceFlags source_flags);
+
+protected:
+  /**Adds the material, scattering and fission sources of the local cells
+   * with local ids in [cell_begin, cell_end) to `q`.*/
+  void AddCellSources(const LBSGroupset& groupset,
+                      size_t cell_begin,
+                      size_t cell_end,
+                      std::vector<double>& q,
+                      const std::vector<double>& phi,
+                      const std::vector<double>& densities) const;
 };
 
 } // namespace lbs
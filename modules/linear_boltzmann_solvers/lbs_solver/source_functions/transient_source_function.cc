@@ -8,7 +8,7 @@ namespace opensn
 namespace lbs
 {
 
-TransientSourceFunction::TransientSourceFunction(const LBSSolver& lbs_solver,
+TransientSourceFunction::TransientSourceFunction(LBSSolver& lbs_solver,
                                                  double& ref_dt,
                                                  SteppingMethod& method)
   : SourceFunction(lbs_solver), dt_(ref_dt), method_(method)
@@ -19,7 +19,9 @@ double
 TransientSourceFunction::AddDelayedFission(const PrecursorList& precursors,
                                            const double& rho,
                                            const std::vector<double>& nu_delayed_sigma_f,
-                                           const double* phi) const
+                                           const double* phi,
+                                           const size_t g,
+                                           const double cell_volume) const
 {
   const auto& BackwardEuler = SteppingMethod::IMPLICIT_EULER;
   const auto& CrankNicolson = SteppingMethod::CRANK_NICOLSON;
@@ -40,22 +42,22 @@ TransientSourceFunction::AddDelayedFission(const PrecursorList& precursors,
       if (gp < gs_i_ or gp > gs_f_)
         for (const auto& precursor : precursors)
         {
-          const double coeff = precursor.emission_spectrum[g_] * precursor.decay_constant /
+          const double coeff = precursor.emission_spectrum[g] * precursor.decay_constant /
                                (1.0 + eff_dt * precursor.decay_constant);
 
           value += coeff * eff_dt * precursor.fractional_yield * rho * nu_delayed_sigma_f[gp] *
-                   phi[gp] / cell_volume_;
+                   phi[gp] / cell_volume;
         }
 
   if (apply_wgs_fission_src_)
     for (size_t gp = gs_i_; gp <= gs_f_; ++gp)
       for (const auto& precursor : precursors)
       {
-        const double coeff = precursor.emission_spectrum[g_] * precursor.decay_constant /
+        const double coeff = precursor.emission_spectrum[g] * precursor.decay_constant /
                              (1.0 + eff_dt * precursor.decay_constant);
 
         value += coeff * eff_dt * precursor.fractional_yield * rho * nu_delayed_sigma_f[gp] *
-                 phi[gp] / cell_volume_;
+                 phi[gp] / cell_volume;
       }
 
   return value;
@@ -24,12 +24,14 @@ public:
   /**Constructor for the transient source function. The only difference
    * as compared to a steady source function is the treatment of delayed
    * fission.*/
-  TransientSourceFunction(const LBSSolver& lbs_solver, double& ref_dt, SteppingMethod& method);
+  TransientSourceFunction(LBSSolver& lbs_solver, double& ref_dt, SteppingMethod& method);
 
   double AddDelayedFission(const PrecursorList& precursors,
                            const double& rho,
                            const std::vector<double>& nu_delayed_sigma_f,
-                           const double* phi) const override;
+                           const double* phi,
+                           size_t g,
+                           double cell_volume) const override;
 };
 
 } // namespace lbs
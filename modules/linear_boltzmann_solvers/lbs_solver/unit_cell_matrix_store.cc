@@ -0,0 +1,291 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "modules/linear_boltzmann_solvers/lbs_solver/unit_cell_matrix_store.h"
+#include "framework/math/spatial_discretization/cell_mappings/cell_mapping.h"
+#include "framework/math/spatial_discretization/finite_element/finite_element_data.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/utils/thread_pool.h"
+#include "caliper/cali.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <type_traits>
+#include <unordered_map>
+
+namespace opensn
+{
+namespace lbs
+{
+
+namespace
+{
+
+/**
+ * Identifies the shape of a cell up to translation: cell type, vertex positions relative to the
+ * first vertex in units of a quantum, and the faces as lists of cell vertex positions.
+ */
+using CellShapeKey = std::vector<int64_t>;
+
+struct CellShapeKeyHash
+{
+  size_t operator()(const CellShapeKey& key) const
+  {
+    size_t hash = key.size();
+    for (int64_t value : key)
+      hash ^= std::hash<int64_t>{}(value) + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+    return hash;
+  }
+};
+
+CellShapeKey
+MakeCellShapeKey(const MeshContinuum& grid, const Cell& cell, double quantum)
+{
+  CellShapeKey key;
+  key.reserve(4 + 3 * cell.vertex_ids_.size() + 5 * cell.faces_.size());
+  key.push_back(static_cast<int64_t>(cell.Type()));
+  key.push_back(static_cast<int64_t>(cell.SubType()));
+
+  key.push_back(static_cast<int64_t>(cell.vertex_ids_.size()));
+  const Vector3& v0 = grid.vertices[cell.vertex_ids_.front()];
+  for (uint64_t vid : cell.vertex_ids_)
+  {
+    const Vector3 d = grid.vertices[vid] - v0;
+    key.push_back(std::llround(d.x / quantum));
+    key.push_back(std::llround(d.y / quantum));
+    key.push_back(std::llround(d.z / quantum));
+  }
+
+  key.push_back(static_cast<int64_t>(cell.faces_.size()));
+  for (const auto& face : cell.faces_)
+  {
+    key.push_back(static_cast<int64_t>(face.vertex_ids_.size()));
+    for (uint64_t vid : face.vertex_ids_)
+    {
+      const auto it = std::find(cell.vertex_ids_.begin(), cell.vertex_ids_.end(), vid);
+      key.push_back(it - cell.vertex_ids_.begin());
+    }
+  }
+  return key;
+}
+
+/**
+ * Row-major scratch matrices of a cell with at most `MaxNodes` nodes. The common cell types use
+ * fixed-size arrays, so that the integration loops do not touch the heap. `MaxNodes == 0` selects
+ * heap storage for cells with arbitrarily many nodes.
+ */
+template <size_t MaxNodes>
+struct UnitIntegralScratch
+{
+  template <typename T>
+  using Buffer =
+    std::conditional_t<MaxNodes == 0, std::vector<T>, std::array<T, MaxNodes * MaxNodes>>;
+
+  Buffer<double> K;
+  Buffer<Vector3> G;
+  Buffer<double> M;
+
+  void Reset(size_t num_nodes)
+  {
+    if constexpr (MaxNodes == 0)
+    {
+      K.assign(num_nodes * num_nodes, 0.0);
+      G.assign(num_nodes * num_nodes, Vector3());
+      M.assign(num_nodes * num_nodes, 0.0);
+    }
+    else
+    {
+      K.fill(0.0);
+      G.fill(Vector3());
+      M.fill(0.0);
+    }
+  }
+};
+
+/**Copies the leading `num_nodes` x `num_nodes` entries of a row-major buffer into a matrix.*/
+template <typename T, typename Buffer>
+std::vector<std::vector<T>>
+ToNestedMatrix(const Buffer& buffer, size_t num_nodes)
+{
+  std::vector<std::vector<T>> matrix(num_nodes);
+  for (size_t i = 0; i < num_nodes; ++i)
+    matrix[i].assign(buffer.begin() + i * num_nodes, buffer.begin() + (i + 1) * num_nodes);
+  return matrix;
+}
+
+template <size_t MaxNodes>
+UnitCellMatrices
+IntegrateCell(const CellMapping& cell_mapping, const std::function<double(const Vector3&)>& weight)
+{
+  const size_t num_nodes = cell_mapping.NumNodes();
+  const size_t num_faces = cell_mapping.ReferenceCell().faces_.size();
+
+  UnitIntegralScratch<MaxNodes> scratch;
+  UnitCellMatrices matrices;
+
+  // Volume integrals
+  const auto fe_vol_data = cell_mapping.MakeVolumetricFiniteElementData();
+  const auto& shape = fe_vol_data.ShapeValues();
+  const auto& shape_grad = fe_vol_data.ShapeGradValues();
+  scratch.Reset(num_nodes);
+  matrices.intV_shapeI.assign(num_nodes, 0.0);
+  for (const auto qp : fe_vol_data.QuadraturePointIndices())
+  {
+    const double w = (weight ? weight(fe_vol_data.QPointXYZ(qp)) : 1.0) * fe_vol_data.JxW(qp);
+    for (size_t i = 0; i < num_nodes; ++i)
+    {
+      const double shape_i = shape[i][qp];
+      const Vector3& shape_grad_i = shape_grad[i][qp];
+      for (size_t j = 0; j < num_nodes; ++j)
+      {
+        scratch.K[i * num_nodes + j] += shape_grad_i.Dot(shape_grad[j][qp]) * w;
+        scratch.G[i * num_nodes + j] += shape_i * shape_grad[j][qp] * w;
+        scratch.M[i * num_nodes + j] += shape_i * shape[j][qp] * w;
+      }
+      matrices.intV_shapeI[i] += shape_i * w;
+    }
+  }
+  matrices.intV_gradshapeI_gradshapeJ = ToNestedMatrix<double>(scratch.K, num_nodes);
+  matrices.intV_shapeI_gradshapeJ = ToNestedMatrix<Vector3>(scratch.G, num_nodes);
+  matrices.intV_shapeI_shapeJ = ToNestedMatrix<double>(scratch.M, num_nodes);
+
+  // Surface integrals
+  matrices.intS_shapeI_shapeJ.resize(num_faces);
+  matrices.intS_shapeI_gradshapeJ.resize(num_faces);
+  matrices.intS_shapeI.resize(num_faces);
+  for (size_t f = 0; f < num_faces; ++f)
+  {
+    const auto fe_srf_data = cell_mapping.MakeSurfaceFiniteElementData(f);
+    const auto& srf_shape = fe_srf_data.ShapeValues();
+    const auto& srf_shape_grad = fe_srf_data.ShapeGradValues();
+    scratch.Reset(num_nodes);
+    auto& intS_shapeI = matrices.intS_shapeI[f];
+    intS_shapeI.assign(num_nodes, 0.0);
+    for (const auto qp : fe_srf_data.QuadraturePointIndices())
+    {
+      const double w = (weight ? weight(fe_srf_data.QPointXYZ(qp)) : 1.0) * fe_srf_data.JxW(qp);
+      for (size_t i = 0; i < num_nodes; ++i)
+      {
+        const double shape_i = srf_shape[i][qp];
+        for (size_t j = 0; j < num_nodes; ++j)
+        {
+          scratch.M[i * num_nodes + j] += shape_i * srf_shape[j][qp] * w;
+          scratch.G[i * num_nodes + j] += shape_i * srf_shape_grad[j][qp] * w;
+        }
+        intS_shapeI[i] += shape_i * w;
+      }
+    }
+    matrices.intS_shapeI_shapeJ[f] = ToNestedMatrix<double>(scratch.M, num_nodes);
+    matrices.intS_shapeI_gradshapeJ[f] = ToNestedMatrix<Vector3>(scratch.G, num_nodes);
+  }
+
+  return matrices;
+}
+
+} // namespace
+
+UnitCellMatrices
+ComputeUnitCellMatrices(const CellMapping& cell_mapping,
+                        const std::function<double(const Vector3&)>& weight)
+{
+  // Slabs, triangles, quadrilaterals and tetrahedra; prisms and hexahedra; general polytopes
+  const size_t num_nodes = cell_mapping.NumNodes();
+  if (num_nodes <= 4)
+    return IntegrateCell<4>(cell_mapping, weight);
+  if (num_nodes <= 8)
+    return IntegrateCell<8>(cell_mapping, weight);
+  return IntegrateCell<0>(cell_mapping, weight);
+}
+
+UnitCellMatrixStore::UnitCellMatrixStore(std::vector<UnitCellMatrices> cell_matrices)
+  : matrices_(std::move(cell_matrices)), cell_index_(matrices_.size())
+{
+  for (size_t c = 0; c < cell_index_.size(); ++c)
+    cell_index_[c] = static_cast<uint32_t>(c);
+  Pack();
+}
+
+UnitCellMatrixStore::UnitCellMatrixStore(const MeshContinuum& grid,
+                                         bool deduplicate,
+                                         const ComputeFunction& compute,
+                                         unsigned int num_threads)
+{
+  CALI_CXX_MARK_SCOPE("UnitCellMatrixStore::UnitCellMatrixStore");
+
+  const size_t num_local_cells = grid.local_cells.size();
+  cell_index_.resize(num_local_cells);
+
+  // Local id of the cell from which each set of matrices is computed
+  std::vector<uint64_t> representative_cells;
+  if (not deduplicate)
+  {
+    representative_cells.resize(num_local_cells);
+    for (size_t c = 0; c < num_local_cells; ++c)
+    {
+      representative_cells[c] = c;
+      cell_index_[c] = static_cast<uint32_t>(c);
+    }
+  }
+  else
+  {
+    // Vertex positions are compared in units of a quantum that is small relative to the local
+    // extent of the mesh, yet well above the round-off of translated coordinates
+    double extent = 0.0;
+    if (num_local_cells > 0)
+    {
+      const Vector3& v0 = grid.vertices[grid.local_cells[0].vertex_ids_.front()];
+      for (const auto& cell : grid.local_cells)
+        for (uint64_t vid : cell.vertex_ids_)
+          extent = std::max(extent, (grid.vertices[vid] - v0).Norm());
+    }
+    const double quantum = 1.0e-12 * (extent > 0.0 ? extent : 1.0);
+
+    std::unordered_map<CellShapeKey, uint32_t, CellShapeKeyHash> shape_index;
+    for (const auto& cell : grid.local_cells)
+    {
+      const auto [it, inserted] =
+        shape_index.emplace(MakeCellShapeKey(grid, cell, quantum),
+                            static_cast<uint32_t>(representative_cells.size()));
+      if (inserted)
+        representative_cells.push_back(cell.local_id_);
+      cell_index_[cell.local_id_] = it->second;
+    }
+  }
+
+  matrices_.resize(representative_cells.size());
+  ParallelFor(representative_cells.size(),
+              num_threads,
+              [&](size_t m) { matrices_[m] = compute(grid.local_cells[representative_cells[m]]); });
+
+  Pack();
+}
+
+void
+UnitCellMatrixStore::Pack()
+{
+  size_t num_entries = 0;
+  for (const auto& matrices : matrices_)
+    num_entries += matrices.intV_shapeI_shapeJ.size() * matrices.intV_shapeI_shapeJ.size();
+
+  flat_begin_.clear();
+  flat_begin_.reserve(matrices_.size());
+  flat_G_.clear();
+  flat_G_.reserve(num_entries);
+  flat_M_.clear();
+  flat_M_.reserve(num_entries);
+  for (const auto& matrices : matrices_)
+  {
+    flat_begin_.push_back(flat_M_.size());
+    const size_t num_nodes = matrices.intV_shapeI_shapeJ.size();
+    const bool has_G = matrices.intV_shapeI_gradshapeJ.size() == num_nodes;
+    for (size_t i = 0; i < num_nodes; ++i)
+      for (size_t j = 0; j < num_nodes; ++j)
+      {
+        flat_G_.push_back(has_G ? matrices.intV_shapeI_gradshapeJ[i][j] : Vector3());
+        flat_M_.push_back(matrices.intV_shapeI_shapeJ[i][j]);
+      }
+  }
+}
+
+} // namespace lbs
+} // namespace opensn
@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "modules/linear_boltzmann_solvers/lbs_solver/lbs_structs.h"
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace opensn
+{
+class Cell;
+class CellMapping;
+class MeshContinuum;
+
+namespace lbs
+{
+
+/**
+ * Computes the unit integrals of a cell, weighted by the spatial weight function `weight`. The
+ * weight is evaluated once per quadrature point; an empty function denotes unit weighting.
+ */
+UnitCellMatrices ComputeUnitCellMatrices(const CellMapping& cell_mapping,
+                                         const std::function<double(const Vector3&)>& weight);
+
+/**
+ * Unit cell matrices of the local cells, shared between congruent cells.
+ *
+ * On orthogonal and extruded meshes almost all cells are translations of a handful of shapes and
+ * therefore have identical unit cell matrices. With deduplication, cells of the same type, with the
+ * same vertex and face structure and the same vertex positions relative to their first vertex
+ * (within a tolerance), share one set of matrices. Indexing the store with a cell local id returns
+ * the set of that cell. The volumetric `intV_shapeI_gradshapeJ` and `intV_shapeI_shapeJ` matrices
+ * of all sets are additionally packed, row-major, into contiguous arrays for the sweep kernels.
+ */
+class UnitCellMatrixStore
+{
+public:
+  using ComputeFunction = std::function<UnitCellMatrices(const Cell&)>;
+
+  UnitCellMatrixStore() = default;
+
+  /**Stores one set of matrices per cell, indexed by cell local id, without deduplication.*/
+  explicit UnitCellMatrixStore(std::vector<UnitCellMatrices> cell_matrices);
+
+  /**
+   * Computes the matrices of the local cells of `grid` with `compute`, on `num_threads` threads.
+   * If `deduplicate` is true, `compute` is only called once per group of congruent cells.
+   * Deduplication requires the matrices to be invariant under translation, which only holds for
+   * Cartesian geometries. `compute` is called concurrently when `num_threads` is larger than one.
+   */
+  UnitCellMatrixStore(const MeshContinuum& grid,
+                      bool deduplicate,
+                      const ComputeFunction& compute,
+                      unsigned int num_threads = 1);
+
+  /**Returns the matrices of the cell with the given local id.*/
+  const UnitCellMatrices& operator[](uint64_t cell_local_id) const
+  {
+    return matrices_[cell_index_[cell_local_id]];
+  }
+
+  /**Returns the number of cells.*/
+  size_t size() const { return cell_index_.size(); }
+
+  /**Returns the number of distinct sets of matrices.*/
+  size_t NumUnique() const { return matrices_.size(); }
+
+  /**Returns the index of the set of matrices of a cell.*/
+  uint32_t Index(uint64_t cell_local_id) const { return cell_index_[cell_local_id]; }
+
+  /**Returns the set of matrices with the given index.*/
+  const UnitCellMatrices& Unique(uint32_t index) const { return matrices_[index]; }
+
+  /**Returns the row-major `intV_shapeI_gradshapeJ` matrix of a cell.*/
+  const Vector3* FlatG(uint64_t cell_local_id) const
+  {
+    return &flat_G_[flat_begin_[cell_index_[cell_local_id]]];
+  }
+
+  /**Returns the row-major `intV_shapeI_shapeJ` matrix of a cell.*/
+  const double* FlatM(uint64_t cell_local_id) const
+  {
+    return &flat_M_[flat_begin_[cell_index_[cell_local_id]]];
+  }
+
+private:
+  /**Packs the volumetric matrices of all sets into the flat arrays.*/
+  void Pack();
+
+  std::vector<UnitCellMatrices> matrices_;
+  std::vector<uint32_t> cell_index_;
+
+  std::vector<size_t> flat_begin_;
+  std::vector<Vector3> flat_G_;
+  std::vector<double> flat_M_;
+};
+
+} // namespace lbs
+} // namespace opensn
@@ -121,6 +121,20 @@ ResponseEvaluator::BufferOptionsBlock()
     "file_prefixes",
     "A table containing file prefixes for flux moments and angular flux binary files. "
     "These are keyed by \"flux_moments\" and \"angular_fluxes\", respectively.");
+  params.AddOptionalParameter(
+    "angular_flux_file",
+    "",
+    "A shared angular flux file written by lbs.WriteSharedAngularFluxes. Unlike the files given "
+    "by the \"angular_fluxes\" prefix, it may have been written with a different number of "
+    "ranks.");
+  params.AddOptionalParameterArray<size_t>(
+    "angular_flux_groups",
+    {},
+    "The groups to read from the shared angular flux file. Empty reads all groups.");
+  params.AddOptionalParameterArray<size_t>(
+    "angular_flux_angles",
+    {},
+    "The angles to read from the shared angular flux file. Empty reads all angles.");
 
   return params;
 }
@@ -139,8 +153,18 @@ ResponseEvaluator::SetBufferOptions(const InputParameters& params)
     lbs_solver_.ReadFluxMoments(prefixes.GetParamValue<std::string>("flux_moments"), phi);
 
   std::vector<std::vector<double>> psi;
+  const auto angular_flux_file = params.GetParamValue<std::string>("angular_flux_file");
+  OpenSnInvalidArgumentIf(prefixes.Has("angular_fluxes") and not angular_flux_file.empty(),
+                          "Only one of the \"angular_fluxes\" prefix and \"angular_flux_file\" "
+                          "can be specified.");
   if (prefixes.Has("angular_fluxes"))
     lbs_solver_.ReadAngularFluxes(prefixes.GetParamValue<std::string>("angular_fluxes"), psi);
+  if (not angular_flux_file.empty())
+    lbs_solver_.ReadAngularFluxesParallel(
+      angular_flux_file,
+      psi,
+      params.GetParamVectorValue<size_t>("angular_flux_groups"),
+      params.GetParamVectorValue<size_t>("angular_flux_angles"));
 
   adjoint_buffers_[name] = {phi, psi};
   log.Log0Verbose1() << "Adjoint buffer " << name << " added to the stack.";
@@ -278,7 +302,7 @@ ResponseEvaluator::SetBoundarySourceOptions(const InputParameters& params)
     OpenSnInvalidArgumentIf(not params.Has("group_strength"),
                             "Parameter \"group_strength\" is required for "
                             "boundaries of type \"isotropic\".");
-    params.RequireParameterBlockTypeIs("values", ParameterBlockType::ARRAY);
+    params.RequireParameterBlockTypeIs("group_strength", ParameterBlockType::ARRAY);
 
     boundary_sources_[bid] = {BoundaryType::ISOTROPIC,
                               params.GetParamVectorValue<double>("group_strength")};
@@ -424,24 +448,29 @@ ResponseEvaluator::EvaluateResponse(const std::string& buffer) const
     }   // for subscriber
 
   // Distributed sources
+  std::vector<double> src_buffer;
   for (const auto& distributed_source : distributed_sources_)
-    for (const uint64_t local_id : distributed_source.Subscribers())
+  {
+    const auto& subscribers = distributed_source.Subscribers();
+    for (size_t s = 0; s < subscribers.size(); ++s)
     {
-      const auto& cell = grid.local_cells[local_id];
+      const auto& cell = grid.local_cells[subscribers[s]];
       const auto& transport_view = transport_views[cell.local_id_];
       const auto& fe_values = unit_cell_matrices[cell.local_id_];
       const auto& nodes = discretization.GetCellNodeLocations(cell);
+      const double* vals =
+        distributed_source.EvaluateSubscriber(s, cell, nodes, num_groups, src_buffer);
 
       const auto num_cell_nodes = transport_view.NumNodes();
       for (size_t i = 0; i < num_cell_nodes; ++i)
       {
         const auto& V_i = fe_values.intV_shapeI[i];
         const auto dof_map = transport_view.MapDOF(i, 0, 0);
-        const auto& vals = distributed_source(cell, nodes[i], num_groups);
         for (size_t g = 0; g < num_groups; ++g)
-          local_response += vals[g] * phi_dagger[dof_map + g] * V_i;
+          local_response += vals[i * num_groups + g] * phi_dagger[dof_map + g] * V_i;
       }
     }
+  }
 
   double global_response = 0.0;
   mpi_comm.all_reduce(local_response, global_response, mpi::op::sum<double>());
@@ -1,6 +1,7 @@
 #include "framework/math/dynamic_vector.h"
 #include "framework/math/dynamic_matrix.h"
 #include "framework/math/sparse_matrix/math_sparse_matrix.h"
+#include "framework/math/sparse_matrix/compressed_sparse_matrix.h"
 
 #include "framework/runtime.h"
 #include "framework/logging/log.h"
@@ -81,6 +82,34 @@ math_Test00(const InputParameters& params)
       opensn::log.Log() << entry.row_index << " " << entry.column_index << " " << entry.value;
   }
 
+  // CompressedSparseMatrix
+  {
+    SparseMatrix matrix(4, 4);
+    matrix.Insert(0, 0, 1.0);
+    matrix.Insert(0, 1, 1.1);
+    matrix.Insert(1, 1, 2.0);
+    matrix.Insert(1, 3, 2.1);
+    matrix.Insert(3, 2, 3.9);
+    matrix.Insert(3, 0, 4.0);
+
+    const CompressedSparseMatrix csr(matrix);
+    opensn::log.Log() << "----- CompressedSparseMatrix -----";
+    for (size_t i = 0; i < csr.NumRows(); ++i)
+      for (const auto& [row_index, column_index, value] : csr.Row(i))
+        opensn::log.Log() << row_index << " " << column_index << " " << value;
+
+    opensn::log.Log() << "----- CompressedSparseMatrix::Transpose() -----";
+    const auto csr_t = csr.Transpose();
+    for (size_t i = 0; i < csr_t.NumRows(); ++i)
+      for (const auto& [row_index, column_index, value] : csr_t.Row(i))
+        opensn::log.Log() << row_index << " " << column_index << " " << value;
+
+    opensn::log.Log() << "----- CompressedSparseMatrix storage -----";
+    opensn::log.Log() << csr.NumNonZeros() << " " << csr.ValueIJ(3, 0) << " "
+                      << csr.SharesStorageWith(CompressedSparseMatrix(matrix)) << " "
+                      << csr.SharesStorageWith(csr.Scaled(2.0));
+  }
+
   opensn::log.Log() << "GOLD_END";
   return ParameterBlock();
 }
@@ -0,0 +1,64 @@
+-- Compares batched boundary-id assignment against the per-face path. Each rule is applied
+-- per face and then batched; the second call must find every face already set.
+-- Setup mesh
+nodes={}
+N=10
+L=5
+xmin = -L/2
+dx = L/N
+for i=1,(N+1) do
+    k=i-1
+    nodes[i] = xmin + k*dx
+end
+
+meshgen1 = mesh.OrthogonalMeshGenerator.Create({ node_sets = {nodes,nodes,nodes} })
+mesh.MeshGenerator.Execute(meshgen1)
+
+epsilon = 1.0e-6
+function side_name(nx,ny,nz)
+    if (nx < -1.0+epsilon) then return "left" end
+    if (nx > 1.0-epsilon) then return "right" end
+    if (ny < -1.0+epsilon) then return "bottom" end
+    if (ny > 1.0-epsilon) then return "top" end
+    if (nz < -1.0+epsilon) then return "back" end
+    return "front"
+end
+
+function outer_name(x,y,z)
+    if (x < 0.0) then return "outer_left" end
+    return "outer_right"
+end
+
+-- Per-face rules
+function bnd_side(pt,normal,cur_bid)
+    return side_name(normal.x,normal.y,normal.z)
+end
+
+function bnd_outer(pt,normal,cur_bid)
+    return outer_name(pt.x,pt.y,pt.z)
+end
+
+-- Batched rules
+function bnd_side_batched(x,y,z,nx,ny,nz,ids)
+    names = {}
+    for f=1,#x do
+        names[f] = side_name(nx[f],ny[f],nz[f])
+    end
+    return names
+end
+
+function bnd_outer_batched(x,y,z,nx,ny,nz,ids)
+    names = {}
+    for f=1,#x do
+        names[f] = outer_name(x[f],y[f],z[f])
+    end
+    return names
+end
+
+-- All 600 boundary faces get new names, after which the batched call changes none
+mesh.SetBoundaryIDFromFunction("bnd_side")
+mesh.SetBoundaryIDFromFunction("bnd_side_batched", true)
+
+-- The same in the other order
+mesh.SetBoundaryIDFromFunction("bnd_outer_batched", true)
+mesh.SetBoundaryIDFromFunction("bnd_outer")
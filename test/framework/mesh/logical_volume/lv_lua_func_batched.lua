@@ -0,0 +1,36 @@
+-- test for a batched lua function used as a logical volume
+-- set up orthogonal 3D geometry
+nodes={}
+N=50
+L=5.0
+xmin = -L/2
+dx = L/N
+for i=1,(N+1) do
+  k=i-1
+  nodes[i] = xmin + k*dx
+end
+
+meshgen = mesh.OrthogonalMeshGenerator.Create
+({
+  node_sets = {nodes,nodes,nodes},
+})
+mesh.MeshGenerator.Execute(meshgen)
+
+-- assign mat ID 10 to whole domain
+vol0 = logvol.RPPLogicalVolume.Create({infx=true, infy=true, infz=true})
+mesh.SetMaterialIDFromLogicalVolume(vol0, 10)
+
+--Sets lua function describing a sphere (material 11), called once for all cells
+function MatIDFunction1(x,y,z,cur_ids)
+    local ids = {}
+    for i = 1, #x do
+        if (x[i]*x[i] + y[i]*y[i] + z[i]*z[i] < 1.0) then
+            ids[i] = 11
+        else
+            ids[i] = cur_ids[i]
+        end
+    end
+    return ids
+end
+-- assign mat ID 11 to lv using the batched lua function
+mesh.SetMaterialIDFromFunction("MatIDFunction1", true)
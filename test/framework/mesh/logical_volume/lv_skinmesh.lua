@@ -36,3 +36,10 @@ mesh.SetMaterialIDFromLogicalVolume(lv_skinmesh, 15)
 
 -- export to vtk
 mesh.ExportToVTK("lv_skinmesh_out")
+
+-- point queries against the skin mesh, including points on the surface and on its edges
+print("skin test 1:", logvol.PointSense(lv_skinmesh, {x = 0.1, y = 0.2, z = -0.3}))
+print("skin test 2:", logvol.PointSense(lv_skinmesh, {x = 0.6, y = 0.0, z = 0.0}))
+print("skin test 3:", logvol.PointSense(lv_skinmesh, {x = 0.5, y = 0.0, z = 0.0}))
+print("skin test 4:", logvol.PointSense(lv_skinmesh, {x = 0.0, y = 0.0, z = 0.0}))
+print("skin test 5:", logvol.PointSense(lv_skinmesh, {x = 0.4, y = 0.4, z = 0.55}))
@@ -0,0 +1,98 @@
+-- 2D diffusion with the linear solution u(x) = 2 - 2x/3, which CFEM reproduces exactly, probed at
+-- points, along a line and on a plane.
+--############################################### Setup mesh
+nodes={}
+N=10
+L=2
+xmin = -L/2
+dx = L/N
+for i=1,(N+1) do
+    k=i-1
+    nodes[i] = xmin + k*dx
+end
+
+meshgen1 = mesh.OrthogonalMeshGenerator.Create({ node_sets = {nodes,nodes} })
+mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+mesh.SetUniformMaterialID(0)
+
+D = {1.0}
+Q = {0.0}
+XSa = {0.0}
+function D_coef(i,pt)
+    return D[i+1]
+end
+function Q_ext(i,pt)
+    return Q[i+1]
+end
+function Sigma_a(i,pt)
+    return XSa[i+1]
+end
+
+-- Setboundary IDs
+-- xmin,xmax,ymin,ymax,zmin,zmax
+e_vol = logvol.RPPLogicalVolume.Create({xmin=0.99999,xmax=1000.0  , infy=true, infz=true})
+w_vol = logvol.RPPLogicalVolume.Create({xmin=-1000.0,xmax=-0.99999, infy=true, infz=true})
+n_vol = logvol.RPPLogicalVolume.Create({ymin=0.99999,ymax=1000.0  , infx=true, infz=true})
+s_vol = logvol.RPPLogicalVolume.Create({ymin=-1000.0,ymax=-0.99999, infx=true, infz=true})
+
+e_bndry = 0
+w_bndry = 1
+n_bndry = 2
+s_bndry = 3
+
+mesh.SetBoundaryIDFromLogicalVolume(e_vol,e_bndry)
+mesh.SetBoundaryIDFromLogicalVolume(w_vol,w_bndry)
+mesh.SetBoundaryIDFromLogicalVolume(n_vol,n_bndry)
+mesh.SetBoundaryIDFromLogicalVolume(s_vol,s_bndry)
+
+--############################################### Add material properties
+--#### CFEM solver
+phys1 = diffusion.CFEMSolverCreate()
+
+solver.SetBasicOption(phys1, "residual_tolerance", 1E-8)
+
+diffusion.CFEMSetBCProperty(phys1, "boundary_type", e_bndry, "robin", 0.25, 0.5, 0.0)
+diffusion.CFEMSetBCProperty(phys1, "boundary_type", n_bndry, "reflecting")
+diffusion.CFEMSetBCProperty(phys1, "boundary_type", s_bndry, "reflecting")
+diffusion.CFEMSetBCProperty(phys1, "boundary_type", w_bndry, "robin", 0.25, 0.5, 1.0)
+
+solver.Initialize(phys1)
+solver.Execute(phys1)
+
+--############################################### Get field functions
+fflist,count = solver.GetFieldFunctionList(phys1)
+
+--############################################### Point values
+-- Interior points, a vertex shared by cells on several processes, a domain corner and a point
+-- outside the mesh, which evaluates to zero
+points = {
+    {x=-0.5, y=0.1, z=0.0},
+    {x=0.25, y=0.3, z=0.0},
+    {x=0.0, y=0.0, z=0.0},
+    {x=1.0, y=-1.0, z=0.0},
+    {x=2.0, y=0.0, z=0.0}
+}
+values = fieldfunc.GetPointValues(fflist[1], points)
+for p=1,#points do
+    log.Log(LOG_0,string.format("Point-value-%d=%.6f", p, values[p][1]))
+end
+
+--############################################### Line values
+values = fieldfunc.GetLineValues(fflist[1], {x=-1.0, y=0.5, z=0.0}, {x=1.0, y=0.5, z=0.0}, 5)
+for p=1,#values do
+    log.Log(LOG_0,string.format("Line-value-%d=%.6f", p, values[p][1]))
+end
+
+--############################################### Plane values
+values = fieldfunc.GetPlaneValues(fflist[1], {x=-1.0, y=-1.0, z=0.0},
+                                  {x=2.0, y=0.0, z=0.0}, {x=0.0, y=2.0, z=0.0}, 3, 3)
+plane_sum = 0.0
+for p=1,#values do
+    plane_sum = plane_sum + values[p][1]
+end
+log.Log(LOG_0,string.format("Plane-value-1=%.6f", values[1][1]))
+log.Log(LOG_0,string.format("Plane-value-9=%.6f", values[9][1]))
+log.Log(LOG_0,string.format("Plane-count=%d", #values))
+log.Log(LOG_0,string.format("Plane-sum=%.6f", plane_sum))
@@ -16,14 +16,39 @@ mesh.MeshGenerator.Execute(meshgen1)
 mesh.SetUniformMaterialID(0)
 
 
-function D_coef(i,pt)
-    return 3.0 + pt.x + pt.y
-end
-function Q_ext(i,pt)
-    return pt.x*pt.x
-end
-function Sigma_a(i,pt)
-    return pt.x*pt.y*pt.y
+-- With batched=true the coefficients are evaluated for all points of a cell in one call
+if (batched) then
+    function D_coef(i,x,y,z)
+        local values = {}
+        for k = 1, #x do
+            values[k] = 3.0 + x[k] + y[k]
+        end
+        return values
+    end
+    function Q_ext(i,x,y,z)
+        local values = {}
+        for k = 1, #x do
+            values[k] = x[k]*x[k]
+        end
+        return values
+    end
+    function Sigma_a(i,x,y,z)
+        local values = {}
+        for k = 1, #x do
+            values[k] = x[k]*y[k]*y[k]
+        end
+        return values
+    end
+else
+    function D_coef(i,pt)
+        return 3.0 + pt.x + pt.y
+    end
+    function Q_ext(i,pt)
+        return pt.x*pt.x
+    end
+    function Sigma_a(i,pt)
+        return pt.x*pt.y*pt.y
+    end
 end
 
 -- Setboundary IDs
@@ -45,7 +70,7 @@ mesh.SetBoundaryIDFromLogicalVolume(s_vol,s_bndry)
 
 --############################################### Add material properties
 --#### CFEM solver
-phys1 = diffusion.CFEMSolverCreate()
+phys1 = diffusion.CFEMSolverCreate("CFEMDiffusionSolver", batched == true)
 
 diffusion.CFEMSetBCProperty(phys1,"boundary_type",e_bndry,"dirichlet",0.0)
 diffusion.CFEMSetBCProperty(phys1,"boundary_type",w_bndry,"dirichlet",0.0)
@@ -2,7 +2,7 @@
 #include "framework/math/spatial_discretization/finite_element/piecewise_linear/piecewise_linear_continuous.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/acceleration/acceleration.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/acceleration/diffusion_pwlc_solver.h"
-#include "modules/linear_boltzmann_solvers/lbs_solver/lbs_structs.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/unit_cell_matrix_store.h"
 #include "framework/field_functions/field_function_grid_based.h"
 #include "framework/runtime.h"
 #include "framework/logging/log.h"
@@ -142,9 +142,11 @@ acceleration_Diffusion_CFEM(const InputParameters&)
                                                                IntS_shapeI};
   } // for cell
 
+  const lbs::UnitCellMatrixStore unit_cell_matrix_store(std::move(unit_cell_matrices));
+
   // Make solver
   lbs::DiffusionPWLCSolver solver(
-    "SimTest92b_DSA_PWLC", sdm, OneDofPerNode, bcs, matid_2_xs_map, unit_cell_matrices, true);
+    "SimTest92b_DSA_PWLC", sdm, OneDofPerNode, bcs, matid_2_xs_map, unit_cell_matrix_store, true);
   // TODO: For this to work, add MMS support into `lbs/acceleration/DiffusionSolver`
   // solver.options.ref_solution_lua_function = "MMS_phi";
   // solver.options.source_lua_function = "MMS_q";
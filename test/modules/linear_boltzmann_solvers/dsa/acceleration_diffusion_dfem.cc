@@ -2,7 +2,7 @@
 #include "framework/math/spatial_discretization/finite_element/piecewise_linear/piecewise_linear_discontinuous.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/acceleration/acceleration.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/acceleration/diffusion_mip_solver.h"
-#include "modules/linear_boltzmann_solvers/lbs_solver/lbs_structs.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/unit_cell_matrix_store.h"
 #include "framework/field_functions/field_function_grid_based.h"
 #include "framework/runtime.h"
 #include "framework/logging/log.h"
@@ -153,6 +153,8 @@ acceleration_Diffusion_DFEM(const InputParameters&)
                                                                IntS_shapeI};
   } // for cell
 
+  const lbs::UnitCellMatrixStore unit_cell_matrix_store(std::move(unit_cell_matrices));
+
   auto mms_phi_function = CreateFunction("MMS_phi");
   opensn::function_stack.push_back(mms_phi_function);
 
@@ -161,7 +163,7 @@ acceleration_Diffusion_DFEM(const InputParameters&)
 
   // Make solver
   lbs::DiffusionMIPSolver solver(
-    "SimTest92_DSA", sdm, OneDofPerNode, bcs, matid_2_xs_map, unit_cell_matrices, true);
+    "SimTest92_DSA", sdm, OneDofPerNode, bcs, matid_2_xs_map, unit_cell_matrix_store, true);
   solver.options.verbose = true;
   solver.options.residual_tolerance = 1.0e-10;
   solver.options.perform_symmetry_check = true;
@@ -0,0 +1,54 @@
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/scheduler/group_subset_pipelining.h"
+
+#include "framework/runtime.h"
+#include "framework/logging/log.h"
+
+#include "lua/framework/console/console.h"
+
+using namespace opensn;
+
+namespace unit_tests
+{
+
+ParameterBlock sweep_Test00_PipelinedNumGroupSubsets(const InputParameters& params);
+
+RegisterWrapperFunctionNamespace(unit_tests,
+                                 sweep_Test00_PipelinedNumGroupSubsets,
+                                 nullptr,
+                                 sweep_Test00_PipelinedNumGroupSubsets);
+
+ParameterBlock
+sweep_Test00_PipelinedNumGroupSubsets(const InputParameters&)
+{
+  using lbs::PipelinedNumGroupSubsets;
+
+  opensn::log.Log() << "Testing PipelinedNumGroupSubsets";
+
+  // A single location deep sweep has no pipeline to fill
+  opensn::log.Log() << "Single location subsets="
+                    << PipelinedNumGroupSubsets(64, 1, 8, 1, 10, 1.0e-3, 1.0e-6);
+
+  // Without angle sets there is nothing to sweep
+  opensn::log.Log() << "No angle sets subsets="
+                    << PipelinedNumGroupSubsets(64, 1, 8, 5, 0, 1.0e-3, 1.0e-6);
+
+  // Messages are free, so the groups are split as finely as allowed
+  opensn::log.Log() << "Zero latency subsets="
+                    << PipelinedNumGroupSubsets(64, 4, 8, 5, 10, 1.0e-3, 0.0);
+
+  // sqrt(4 * (5 - 1) * 1.0e-4 / (4 * 1.0e-6)) = 20
+  opensn::log.Log() << "Optimum subsets="
+                    << PipelinedNumGroupSubsets(64, 1, 4, 5, 4, 1.0e-4, 1.0e-6);
+
+  // The optimum of 20 is limited to 64 / 8 = 8 subsets
+  opensn::log.Log() << "Limited optimum subsets="
+                    << PipelinedNumGroupSubsets(64, 8, 4, 5, 4, 1.0e-4, 1.0e-6);
+
+  // sqrt(1 * (2 - 1) * 1.0e-6 / (100 * 1.0e-6)) = 0.1, at least one subset
+  opensn::log.Log() << "Latency bound subsets="
+                    << PipelinedNumGroupSubsets(64, 1, 1, 2, 100, 1.0e-6, 1.0e-6);
+
+  return ParameterBlock();
+}
+
+} //  namespace unit_tests
@@ -0,0 +1 @@
+unit_tests.sweep_Test00_PipelinedNumGroupSubsets()
@@ -13,6 +13,8 @@
 --  QoI Value[9]= 2.07284e-07
 --  sum(QoI Value)= 2.21354e-05
 --  Inner Product=3.30607e-06
+-- With batched=true the response function is evaluated for all nodes of a cell in one call.
+-- With cache_values=true the adjoint source values are cached on initialization.
 num_procs = 4
 
 -- Check num_procs
@@ -160,12 +162,35 @@ function ResponseFunction(xyz, mat_id)
     end
     return response
 end
-response_func = opensn.LuaSpatialMaterialFunction.Create({ lua_function_name = "ResponseFunction" })
+function ResponseFunctionBatched(x, y, z, mat_id)
+    response = {}
+    for i = 1, #x do
+        for g = 1, num_groups do
+            if g == 6 then
+                response[(i - 1) * num_groups + g] = 1.0
+            else
+                response[(i - 1) * num_groups + g] = 0.0
+            end
+        end
+    end
+    return response
+end
+if (batched) then
+    response_func = opensn.LuaSpatialMaterialFunction.Create(
+            {
+                lua_function_name = "ResponseFunctionBatched",
+                batched = true
+            }
+    )
+else
+    response_func = opensn.LuaSpatialMaterialFunction.Create({ lua_function_name = "ResponseFunction" })
+end
 
 adjoint_source = lbs.DistributedSource.Create(
         {
             logical_volume_handle = qoi_vol,
-            function_handle = response_func
+            function_handle = response_func,
+            cache_values = (cache_values == true)
         }
 )
 
@@ -178,10 +203,17 @@ lbs.SetOptions(phys, adjoint_options)
 
 -- Adjoint solve, write results
 solver.Execute(ss_solver)
-lbs.WriteFluxMoments(phys, "adjoint_2d_3")
+adjoint_prefix = "adjoint_2d_3"
+if (batched) then
+    adjoint_prefix = adjoint_prefix .. "_batched"
+end
+if (cache_values) then
+    adjoint_prefix = adjoint_prefix .. "_cached"
+end
+lbs.WriteFluxMoments(phys, adjoint_prefix)
 
 -- Create response evaluator
-buffers = { { name = "buff", file_prefixes = { flux_moments = "adjoint_2d_3" } } }
+buffers = { { name = "buff", file_prefixes = { flux_moments = adjoint_prefix } } }
 pt_sources = { pt_src }
 response_options = {
     lbs_solver_handle = phys,
@@ -206,5 +238,5 @@ log.Log(LOG_0, string.format("Inner Product=%.5e", response))
 -- Cleanup
 MPIBarrier()
 if (location_id == 0) then
-    os.execute("rm adjoint_2d_3*")
+    os.execute("rm " .. adjoint_prefix .. "*")
 end
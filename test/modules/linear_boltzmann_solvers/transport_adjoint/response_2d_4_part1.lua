@@ -0,0 +1,135 @@
+-- 2D Transport adjoint solve with two multigroup groupsets. The adjoint angular fluxes are
+-- written to a shared file, which part 2 reads back on 2 processes to evaluate the response to a
+-- boundary source.
+-- SDM: PWLD
+num_procs = 4
+
+-- Check num_procs
+if (check_num_procs == nil and number_of_processes ~= num_procs) then
+    log.Log(LOG_0ERROR, "Incorrect amount of processors. " ..
+            "Expected " .. tostring(num_procs) ..
+            ". Pass check_num_procs=false to override if possible.")
+    os.exit(false)
+end
+
+-- Create mesh
+N = 60
+L = 5.0
+ds = L / N
+
+nodes = {}
+for i = 0, N do
+    nodes[i + 1] = i * ds
+end
+meshgen = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes, nodes } })
+mesh.MeshGenerator.Execute(meshgen)
+
+-- Set material IDs
+mesh.SetUniformMaterialID(0)
+
+vol1a = logvol.RPPLogicalVolume.Create(
+        {
+            infx = true,
+            ymin = 0.0, ymax = 0.8 * L,
+            infz = true
+        }
+)
+
+mesh.SetMaterialIDFromLogicalVolume(vol1a, 1)
+
+vol0 = logvol.RPPLogicalVolume.Create(
+        {
+            xmin = 2.5 - 0.166666, xmax = 2.5 + 0.166666,
+            infy = true,
+            infz = true
+        }
+)
+mesh.SetMaterialIDFromLogicalVolume(vol0, 0)
+
+vol1b = logvol.RPPLogicalVolume.Create(
+        {
+            xmin = -1 + 2.5, xmax = 1 + 2.5,
+            ymin = 0.9 * L, ymax = L,
+            infz = true
+        }
+)
+mesh.SetMaterialIDFromLogicalVolume(vol1b, 1)
+
+-- Create materials
+materials = {}
+materials[1] = mat.AddMaterial("Test Material1");
+materials[2] = mat.AddMaterial("Test Material2");
+
+-- Add cross sections to materials
+num_groups = 10
+mat.AddProperty(materials[1], TRANSPORT_XSECTIONS)
+mat.SetProperty(materials[1], TRANSPORT_XSECTIONS, OPENSN_XSFILE, "response_2d_3_mat1.xs")
+
+mat.AddProperty(materials[2], TRANSPORT_XSECTIONS)
+mat.SetProperty(materials[2], TRANSPORT_XSECTIONS, OPENSN_XSFILE, "response_2d_3_mat2.xs")
+
+-- Define QoI region
+qoi_vol = logvol.RPPLogicalVolume.Create(
+        {
+            xmin = 0.5, xmax = 0.8333,
+            ymin = 4.16666, ymax = 4.33333,
+            infz = true
+        }
+)
+
+-- Setup physics, with two multigroup groupsets
+pquad = aquad.CreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV, 12, 2)
+aquad.OptimizeForPolarSymmetry(pquad, 4.0 * math.pi)
+
+groupsets = {}
+for gs = 0, 1 do
+    groupsets[gs + 1] = {
+        groups_from_to = { 5 * gs, 5 * gs + 4 },
+        angular_quadrature_handle = pquad,
+        inner_linear_method = "gmres",
+        l_abs_tol = 1.0e-6,
+        l_max_its = 500,
+        gmres_restart_interval = 100,
+    }
+end
+
+-- Create adjoint source, the group 5 flux in the QoI region
+function ResponseFunction(xyz, mat_id)
+    response = {}
+    for g = 1, num_groups do
+        if g == 6 then
+            response[g] = 1.0
+        else
+            response[g] = 0.0
+        end
+    end
+    return response
+end
+response_func = opensn.LuaSpatialMaterialFunction.Create({ lua_function_name = "ResponseFunction" })
+
+adjoint_source = lbs.DistributedSource.Create(
+        {
+            logical_volume_handle = qoi_vol,
+            function_handle = response_func
+        }
+)
+
+lbs_block = {
+    num_groups = num_groups,
+    groupsets = groupsets,
+    options = {
+        scattering_order = 0,
+        save_angular_flux = true,
+        adjoint = true,
+        distributed_sources = { adjoint_source }
+    }
+}
+phys = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+
+-- Adjoint solve, write the angular fluxes
+ss_solver = lbs.SteadyStateSolver.Create({ lbs_solver_handle = phys })
+
+solver.Initialize(ss_solver)
+solver.Execute(ss_solver)
+
+lbs.WriteSharedAngularFluxes(phys, "adjoint_2d_4.psi")
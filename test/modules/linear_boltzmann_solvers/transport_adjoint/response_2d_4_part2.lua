@@ -0,0 +1,217 @@
+-- 2D Transport test with an isotropic boundary source FWD, evaluated against the adjoint angular
+-- fluxes that part 1 wrote to a shared file on 4 processes. The file is read back on 2 processes,
+-- both in full and as complementary subsets of the groups and of the angles of each groupset. The
+-- responses of complementary subsets must add up to the full response, which must match the
+-- forward QoI.
+-- SDM: PWLD
+num_procs = 2
+
+-- Check num_procs
+if (check_num_procs == nil and number_of_processes ~= num_procs) then
+    log.Log(LOG_0ERROR, "Incorrect amount of processors. " ..
+            "Expected " .. tostring(num_procs) ..
+            ". Pass check_num_procs=false to override if possible.")
+    os.exit(false)
+end
+
+-- Create mesh
+N = 60
+L = 5.0
+ds = L / N
+
+nodes = {}
+for i = 0, N do
+    nodes[i + 1] = i * ds
+end
+meshgen = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes, nodes } })
+mesh.MeshGenerator.Execute(meshgen)
+
+-- Set material IDs
+mesh.SetUniformMaterialID(0)
+
+vol1a = logvol.RPPLogicalVolume.Create(
+        {
+            infx = true,
+            ymin = 0.0, ymax = 0.8 * L,
+            infz = true
+        }
+)
+
+mesh.SetMaterialIDFromLogicalVolume(vol1a, 1)
+
+vol0 = logvol.RPPLogicalVolume.Create(
+        {
+            xmin = 2.5 - 0.166666, xmax = 2.5 + 0.166666,
+            infy = true,
+            infz = true
+        }
+)
+mesh.SetMaterialIDFromLogicalVolume(vol0, 0)
+
+vol1b = logvol.RPPLogicalVolume.Create(
+        {
+            xmin = -1 + 2.5, xmax = 1 + 2.5,
+            ymin = 0.9 * L, ymax = L,
+            infz = true
+        }
+)
+mesh.SetMaterialIDFromLogicalVolume(vol1b, 1)
+
+-- Create materials
+materials = {}
+materials[1] = mat.AddMaterial("Test Material1");
+materials[2] = mat.AddMaterial("Test Material2");
+
+-- Add cross sections to materials
+num_groups = 10
+mat.AddProperty(materials[1], TRANSPORT_XSECTIONS)
+mat.SetProperty(materials[1], TRANSPORT_XSECTIONS, OPENSN_XSFILE, "response_2d_3_mat1.xs")
+
+mat.AddProperty(materials[2], TRANSPORT_XSECTIONS)
+mat.SetProperty(materials[2], TRANSPORT_XSECTIONS, OPENSN_XSFILE, "response_2d_3_mat2.xs")
+
+-- Define QoI region
+qoi_vol = logvol.RPPLogicalVolume.Create(
+        {
+            xmin = 0.5, xmax = 0.8333,
+            ymin = 4.16666, ymax = 4.33333,
+            infz = true
+        }
+)
+
+-- Setup physics, with two multigroup groupsets
+pquad = aquad.CreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV, 12, 2)
+aquad.OptimizeForPolarSymmetry(pquad, 4.0 * math.pi)
+
+groupsets = {}
+for gs = 0, 1 do
+    groupsets[gs + 1] = {
+        groups_from_to = { 5 * gs, 5 * gs + 4 },
+        angular_quadrature_handle = pquad,
+        inner_linear_method = "gmres",
+        l_abs_tol = 1.0e-6,
+        l_max_its = 500,
+        gmres_restart_interval = 100,
+    }
+end
+
+-- Boundary source in all groups
+bsrc = {}
+for g = 1, num_groups do
+    bsrc[g] = (num_groups - g + 1) / num_groups / (4.0 * math.pi)
+end
+boundary_conditions = {
+    {
+        name = "xmin",
+        type = "isotropic",
+        group_strength = bsrc
+    }
+}
+
+lbs_block = {
+    num_groups = num_groups,
+    groupsets = groupsets,
+    options = {
+        scattering_order = 0,
+        boundary_conditions = boundary_conditions
+    }
+}
+phys = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+
+-- Forward solve
+ss_solver = lbs.SteadyStateSolver.Create({ lbs_solver_handle = phys })
+
+solver.Initialize(ss_solver)
+solver.Execute(ss_solver)
+
+-- Compute QoI
+ff = fieldfunc.GetHandleByName("phi_g005_m00")
+ffi = fieldfunc.FFInterpolationCreate(VOLUME)
+fieldfunc.SetProperty(ffi, OPERATION, OP_SUM)
+fieldfunc.SetProperty(ffi, LOGICAL_VOLUME, qoi_vol)
+fieldfunc.SetProperty(ffi, ADD_FIELDFUNCTION, ff)
+
+fieldfunc.Initialize(ffi)
+fieldfunc.Execute(ffi)
+fwd_qoi = fieldfunc.GetValue(ffi)
+
+-- Create response evaluator with the full adjoint angular fluxes, with the even and the odd
+-- groups, which take part of the groups of both groupsets, and with the first and the second half
+-- of the angles
+even_groups = { 0, 2, 4, 6, 8 }
+odd_groups = { 1, 3, 5, 7, 9 }
+
+num_angles = #aquad.GetProductQuadrature(pquad)
+first_angles = {}
+second_angles = {}
+for n = 0, num_angles - 1 do
+    if n < num_angles / 2 then
+        table.insert(first_angles, n)
+    else
+        table.insert(second_angles, n)
+    end
+end
+buffers = {
+    {
+        name = "all",
+        file_prefixes = {},
+        angular_flux_file = "adjoint_2d_4.psi"
+    },
+    {
+        name = "even",
+        file_prefixes = {},
+        angular_flux_file = "adjoint_2d_4.psi",
+        angular_flux_groups = even_groups
+    },
+    {
+        name = "odd",
+        file_prefixes = {},
+        angular_flux_file = "adjoint_2d_4.psi",
+        angular_flux_groups = odd_groups
+    },
+    {
+        name = "first_angles",
+        file_prefixes = {},
+        angular_flux_file = "adjoint_2d_4.psi",
+        angular_flux_angles = first_angles
+    },
+    {
+        name = "second_angles",
+        file_prefixes = {},
+        angular_flux_file = "adjoint_2d_4.psi",
+        angular_flux_angles = second_angles
+    }
+}
+response_options = {
+    lbs_solver_handle = phys,
+    options = {
+        buffers = buffers,
+        sources = { boundary = boundary_conditions }
+    }
+}
+evaluator = lbs.ResponseEvaluator.Create(response_options)
+
+-- Evaluate responses
+response = lbs.EvaluateResponse(evaluator, "all")
+even_response = lbs.EvaluateResponse(evaluator, "even")
+odd_response = lbs.EvaluateResponse(evaluator, "odd")
+first_angles_response = lbs.EvaluateResponse(evaluator, "first_angles")
+second_angles_response = lbs.EvaluateResponse(evaluator, "second_angles")
+
+-- Print results
+log.Log(LOG_0, string.format("QoI Value=%.5e", fwd_qoi))
+log.Log(LOG_0, string.format("Inner Product=%.5e", response))
+log.Log(LOG_0, string.format("Inner Product(even groups)=%.5e", even_response))
+log.Log(LOG_0, string.format("Inner Product(odd groups)=%.5e", odd_response))
+log.Log(LOG_0, string.format("Relative QoI difference=%.5e",
+        math.abs(response - fwd_qoi) / fwd_qoi))
+log.Log(LOG_0, string.format("Relative subset difference=%.5e",
+        math.abs(even_response + odd_response - response) / response))
+log.Log(LOG_0, string.format("Relative angle subset difference=%.5e",
+        math.abs(first_angles_response + second_angles_response - response) / response))
+
+-- Cleanup
+MPIBarrier()
+if (location_id == 0) then
+    os.execute("rm adjoint_2d_4.psi")
+end
@@ -2,6 +2,8 @@
 -- SDM: PWLD
 -- Test: WGS groups [0-62] Iteration    53 Residual 5.96018e-07 CONVERGED
 -- and   WGS groups [63-167] Iteration    59 Residual 5.96296e-07 CONVERGED
+-- With matrix_free=true the problem is solved again with the matrix-free DSA operators and the
+-- difference between the two solutions is reported.
 num_procs = 4
 
 
@@ -123,4 +125,43 @@ if (master_export == nil) then
   fieldfunc.ExportToVTKMulti(fflist,"ZPhi")
 end
 
+--############################################### Matrix-free DSA
+if (matrix_free) then
+  vol0 = logvol.RPPLogicalVolume.Create({infx=true, infy=true, infz=true})
+
+  function MaxValue(ff)
+    local ffi = fieldfunc.FFInterpolationCreate(VOLUME)
+    fieldfunc.SetProperty(ffi,OPERATION,OP_MAX)
+    fieldfunc.SetProperty(ffi,LOGICAL_VOLUME,vol0)
+    fieldfunc.SetProperty(ffi,ADD_FIELDFUNCTION,ff)
+    fieldfunc.Initialize(ffi)
+    fieldfunc.Execute(ffi)
+    return fieldfunc.GetValue(ffi)
+  end
+
+  for _,groupset in ipairs(lbs_block.groupsets) do
+    groupset.wgdsa_matrix_free = true
+    groupset.tgdsa_matrix_free = true
+    groupset.wgdsa_matrix_free_check = true
+    groupset.tgdsa_matrix_free_check = true
+  end
+
+  phys2 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+  lbs.SetOptions(phys2, lbs_options)
+  ss_solver2 = lbs.SteadyStateSolver.Create({lbs_solver_handle = phys2})
+
+  solver.Initialize(ss_solver2)
+  solver.Execute(ss_solver2)
+
+  fflist2,count2 = lbs.GetScalarFieldFunctionList(phys2)
+
+  max_diff = 0.0
+  for _,g in ipairs({1, 63, 64, num_groups}) do
+    ref = MaxValue(fflist[g])
+    diff = math.abs(MaxValue(fflist2[g]) - ref) / ref
+    max_diff = math.max(max_diff, diff)
+  end
+  log.Log(LOG_0,string.format("Matrix-free max relative difference=%.3e", max_diff))
+end
+
 --############################################### Plots
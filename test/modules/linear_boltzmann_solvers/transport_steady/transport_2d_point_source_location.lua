@@ -0,0 +1,80 @@
+-- 2D Transport test locating point sources on a 4x4 grid split over 4 processes.
+-- The first point source lies on the corner shared by all 4 partitions, so each process owns
+-- one subscribing cell and sees the other three as ghosts. The second lies inside a single cell
+-- and the third on a face between two cells of the same partition.
+-- Test: 4, 1 and 2 global subscribing cells with volume weights 0.25, 1 and 0.5
+num_procs = 4
+
+-- Check num_procs
+if (check_num_procs == nil and number_of_processes ~= num_procs) then
+    log.Log(LOG_0ERROR, "Incorrect amount of processors. " ..
+            "Expected " .. tostring(num_procs) ..
+            ". Pass check_num_procs=false to override if possible.")
+    os.exit(false)
+end
+
+-- Setup mesh
+N = 4
+L = 2.0
+ds = L / N
+
+nodes = {}
+for i = 0, N do
+    nodes[i + 1] = -0.5 * L + i * ds
+end
+meshgen = mesh.MeshGenerator.Create(
+        {
+            inputs = { mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes, nodes } }) },
+            partitioner = mesh.KBAGraphPartitioner.Create(
+                    {
+                        nx = 2, ny = 2,
+                        xcuts = { 0.0 }, ycuts = { 0.0 }
+                    }
+            )
+        }
+)
+mesh.MeshGenerator.Execute(meshgen)
+
+-- Set Material IDs
+mesh.SetUniformMaterialID(0)
+
+-- Add materials
+num_groups = 1
+
+materials = {}
+materials[1] = mat.AddMaterial("Test Material");
+
+mat.AddProperty(materials[1], TRANSPORT_XSECTIONS)
+mat.SetProperty(materials[1], TRANSPORT_XSECTIONS, SIMPLE_ONE_GROUP, 1.0, 0.5)
+
+-- Add sources
+src = { 1.0 }
+corner_src = lbs.PointSource.Create({ location = { 0.0, 0.0, 0.0 }, strength = src })
+interior_src = lbs.PointSource.Create({ location = { 0.5 * ds, 0.5 * ds, 0.0 }, strength = src })
+face_src = lbs.PointSource.Create({ location = { ds, 0.5 * ds, 0.0 }, strength = src })
+
+-- Setup physics
+pquad = aquad.CreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV, 2, 2)
+aquad.OptimizeForPolarSymmetry(pquad, 4.0 * math.pi)
+
+lbs_block = {
+    num_groups = num_groups,
+    groupsets = {
+        {
+            groups_from_to = { 0, num_groups - 1 },
+            angular_quadrature_handle = pquad,
+            inner_linear_method = "gmres",
+            l_abs_tol = 1.0e-6,
+            l_max_its = 100,
+        }
+    },
+    options = {
+        scattering_order = 0,
+        point_sources = { corner_src, interior_src, face_src }
+    }
+}
+phys = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+
+-- Initializing the solver locates the point sources
+ss_solver = lbs.SteadyStateSolver.Create({ lbs_solver_handle = phys })
+solver.Initialize(ss_solver)
@@ -1,8 +1,12 @@
 -- 3D Transport test with Vacuum and Incident-isotropic BC.
 -- SDM: PWLD
 -- Test: Max-value=5.28310e-01 and 8.04576e-04
+-- With threaded=true the sweeps use 3 threads per rank.
+-- With pipelined=true the number of group subsets is chosen for sweep pipelining.
 num_procs = 4
 if (reflecting == nil) then reflecting = true end
+if (threaded == nil) then threaded = false end
+if (pipelined == nil) then pipelined = false end
 
 
 
@@ -96,6 +100,15 @@ if (reflecting) then
   table.insert(lbs_options.boundary_conditions,
     {name = "zmax", type = "reflecting"})
 end
+if (pipelined) then
+  lbs_block.groupsets[1].auto_groupset_num_subsets = true
+end
+if (threaded) then
+  lbs_block.groupsets[1].groupset_num_subsets = 3
+  lbs_options.num_sweep_threads = 3
+  lbs_options.num_source_threads = 2
+  lbs_options.num_initialization_threads = 2
+end
 
 phys1 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
 lbs.SetOptions(phys1, lbs_options)
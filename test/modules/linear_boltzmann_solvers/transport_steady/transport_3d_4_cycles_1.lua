@@ -1,6 +1,10 @@
 -- 3D Transport test with Vacuum and Incident-isotropic BC.
 -- SDM: PWLD
 -- Test: Max-value=3.74343e-04
+-- With persistent_comm=true the sweeps use pre-posted persistent MPI requests.
+-- With spds_threads=N the sweep orderings are built with N threads.
+-- With sweep_ordering_cache=true the problem is solved a second time, reading the sweep orderings
+-- cached by the first solve.
 num_procs = 4
 
 
@@ -102,6 +106,15 @@ if (reflecting) then
   table.insert(lbs_options.boundary_conditions,
     {name = "zmax", type = "reflecting"})
 end
+if (persistent_comm) then
+  lbs_options.use_persistent_sweep_comm = true
+end
+if (spds_threads) then
+  lbs_options.num_sweep_ordering_threads = spds_threads
+end
+if (sweep_ordering_cache) then
+  lbs_options.sweep_ordering_cache_folder_name = "transport_3d_4_cycles_1_sweep_orderings"
+end
 
 phys1 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
 lbs.SetOptions(phys1, lbs_options)
@@ -154,6 +167,35 @@ maxval = fieldfunc.GetValue(curffi)
 
 log.Log(LOG_0,string.format("Max-value2=%.5e", maxval))
 
+--############################################### Solve again from the sweep ordering cache
+if (sweep_ordering_cache) then
+  phys2 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+  lbs.SetOptions(phys2, lbs_options)
+
+  ss_solver2 = lbs.SteadyStateSolver.Create({lbs_solver_handle = phys2})
+
+  solver.Initialize(ss_solver2)
+  solver.Execute(ss_solver2)
+
+  fflist2,count2 = lbs.GetScalarFieldFunctionList(phys2)
+
+  ffi2 = fieldfunc.FFInterpolationCreate(VOLUME)
+  fieldfunc.SetProperty(ffi2,OPERATION,OP_MAX)
+  fieldfunc.SetProperty(ffi2,LOGICAL_VOLUME,vol0)
+  fieldfunc.SetProperty(ffi2,ADD_FIELDFUNCTION,fflist2[20])
+
+  fieldfunc.Initialize(ffi2)
+  fieldfunc.Execute(ffi2)
+  maxval = fieldfunc.GetValue(ffi2)
+
+  log.Log(LOG_0,string.format("Cached Max-value2=%.5e", maxval))
+
+  MPIBarrier()
+  if (location_id == 0) then
+    os.execute("rm -r transport_3d_4_cycles_1_sweep_orderings")
+  end
+end
+
 --############################################### Exports
 if (master_export == nil) then
   ExportFieldFunctionToVTKG(fflist[1],"ZPhi3D","Phi")
@@ -1,4 +1,5 @@
 -- 3D Transport test with split-mesh + ortho mesh.
+-- With distributed_mesh=true the mesh is distributed by the DistributedMeshGenerator instead.
 -- SDM: PWLD
 -- Test: max-grp0(latest) =  1.131566e-01
 --       max-grp19(latest) = 7.340585e-04
@@ -52,13 +53,18 @@ for i = 1, (Nz+1) do
   zmesh[i] = zmin + k*dz
 end
 
-meshgen1 = mesh.SplitFileMeshGenerator.Create
-({
+meshgen_params =
+{
   inputs =
   {
     mesh.OrthogonalMeshGenerator.Create({ node_sets = {xmesh,ymesh,zmesh} })
   },
-})
+}
+if (distributed_mesh) then
+  meshgen1 = mesh.DistributedMeshGenerator.Create(meshgen_params)
+else
+  meshgen1 = mesh.SplitFileMeshGenerator.Create(meshgen_params)
+end
 
 mesh.MeshGenerator.Execute(meshgen1)
 
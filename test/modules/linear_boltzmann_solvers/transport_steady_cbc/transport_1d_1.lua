@@ -167,3 +167,8 @@ end
 if (location_id == 0 and master_export == nil) then
   local handle = io.popen("python3 ZLFFI00.py")
 end
+
+--############################################### Performance counters
+-- Downstream locations have to wait on upstream data at the start of every sweep
+num_idle_advances = solver.GetInfo(phys1, "num_idle_advances")
+log.Log(LOG_0,string.format("Idle advances recorded=%d", num_idle_advances > 0 and 1 or 0))